@@ -3,6 +3,10 @@
 #include "Engine/Component/TransformComponent.h"
 #include "Core/ImGui/ImGuiLayer.h"
 #include "Editor/UI//Layout/EditorLayout.h"
+#include "Engine/Render/Shader/Shader.h"
+#include "Engine/Render/Shader/ShaderLibrary.h"
+#include "Engine/Render/State/GLStateCache.h"
+#include "Engine/Render/Mesh/GeometryArena.h"
 #include <glm/gtc/matrix_transform.hpp>
 #include <GLFW/glfw3.h>
 #include "Editor/UI/Panels/InspectorPanel/ComponentDrawers.h"
@@ -101,6 +105,11 @@ int Application::Run() const {
         glClearColor(0.2f, 0.3f, 0.3f, 1.0f);
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
+        // Pick up shader variants the driver finished since the last frame
+        ShaderLibrary::GetInstance().PollPending();
+        // Compact mesh storage if freed meshes left it full of holes
+        GeometryArena::GetInstance().Maintain();
+
         // Update and draw the scene
         m_Scene->UpdateAll(deltaTime);
         //m_Scene->DrawAll();
@@ -113,6 +122,8 @@ int Application::Run() const {
             m_EditorLayout->RenderLayout();
         }
         ImGuiLayer::End();
+        Shader::EndFrameStats();
+        GLStateCache::GetInstance().EndFrame();
 
         m_WindowManager->SwapBuffers();
     }
@@ -0,0 +1,121 @@
+#include "JobSystem.h"
+#include <algorithm>
+
+namespace {
+    // Set while a thread executes chunks, so nested ParallelFor calls run inline
+    thread_local bool t_InsideJob = false;
+}
+
+JobSystem& JobSystem::Get() {
+    static JobSystem instance;
+    return instance;
+}
+
+JobSystem::JobSystem() {
+    // Leave one hardware thread for the caller (usually the main/render thread)
+    const unsigned hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+    const unsigned workerCount = hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+
+    m_Workers.reserve(workerCount);
+    for (unsigned i = 0; i < workerCount; ++i) {
+        m_Workers.emplace_back(&JobSystem::WorkerLoop, this);
+    }
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Stop = true;
+    }
+    m_WakeCondition.notify_all();
+
+    for (auto& worker : m_Workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+void JobSystem::ParallelFor(const size_t count, size_t grainSize, const RangeFunction& fn) {
+    if (count == 0) return;
+    grainSize = std::max<size_t>(1, grainSize);
+
+    // Small ranges, nested calls and machines without workers just run inline
+    if (count <= grainSize || m_Workers.empty() || t_InsideJob) {
+        fn(0, count);
+        return;
+    }
+
+    std::unique_lock<std::mutex> submitLock(m_SubmitMutex, std::try_to_lock);
+    if (!submitLock.owns_lock()) {
+        // Another thread is already using the pool
+        fn(0, count);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Job = &fn;
+        m_JobCount = count;
+        m_JobGrain = grainSize;
+        m_ChunkCount = GetChunkCount(count, grainSize);
+        m_NextChunk.store(0, std::memory_order_relaxed);
+        m_ChunksDone.store(0, std::memory_order_relaxed);
+        ++m_Generation;
+    }
+    m_WakeCondition.notify_all();
+
+    // The caller works too instead of idling
+    t_InsideJob = true;
+    RunChunks(fn);
+    t_InsideJob = false;
+
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    m_DoneCondition.wait(lock, [this] {
+        return m_ChunksDone.load(std::memory_order_acquire) == m_ChunkCount && m_ActiveWorkers == 0;
+    });
+    m_Job = nullptr;
+}
+
+void JobSystem::RunChunks(const RangeFunction& fn) {
+    for (;;) {
+        const size_t chunk = m_NextChunk.fetch_add(1, std::memory_order_relaxed);
+        if (chunk >= m_ChunkCount) break;
+
+        const size_t begin = chunk * m_JobGrain;
+        const size_t end = std::min(begin + m_JobGrain, m_JobCount);
+        fn(begin, end);
+
+        m_ChunksDone.fetch_add(1, std::memory_order_release);
+    }
+}
+
+void JobSystem::WorkerLoop() {
+    uint64_t seenGeneration = 0;
+
+    for (;;) {
+        const RangeFunction* job = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_WakeCondition.wait(lock, [this, seenGeneration] {
+                return m_Stop || m_Generation != seenGeneration;
+            });
+            if (m_Stop) return;
+
+            seenGeneration = m_Generation;
+            job = m_Job;
+            if (!job) continue; // Woke up after the job had already finished
+            ++m_ActiveWorkers;
+        }
+
+        t_InsideJob = true;
+        RunChunks(*job);
+        t_InsideJob = false;
+
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            --m_ActiveWorkers;
+        }
+        m_DoneCondition.notify_all();
+    }
+}
@@ -0,0 +1,76 @@
+#ifndef JOB_SYSTEM_H
+#define JOB_SYSTEM_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Small pool of worker threads for data-parallel loops
+ *
+ * Work is expressed as ParallelFor over an index range split into fixed-size
+ * chunks. The calling thread takes part in the work and the call returns only
+ * when every chunk has finished, so callers can treat it like a plain loop.
+ * Only one ParallelFor runs at a time; nested or concurrent calls run inline.
+ */
+class JobSystem {
+public:
+    using RangeFunction = std::function<void(size_t begin, size_t end)>;
+
+    // Get the singleton instance
+    static JobSystem& Get();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+    ~JobSystem();
+
+    /**
+     * @brief Run fn over [0, count) in chunks of grainSize
+     *
+     * @param count Number of items
+     * @param grainSize Items per chunk; small ranges run inline on the caller
+     * @param fn Called once per chunk with the chunk's [begin, end)
+     */
+    void ParallelFor(size_t count, size_t grainSize, const RangeFunction& fn);
+
+    /**
+     * @brief Number of chunks ParallelFor would split count into
+     */
+    [[nodiscard]] static size_t GetChunkCount(size_t count, size_t grainSize) {
+        return grainSize == 0 ? 0 : (count + grainSize - 1) / grainSize;
+    }
+
+    // Worker threads, not counting the calling thread
+    [[nodiscard]] size_t GetWorkerCount() const { return m_Workers.size(); }
+
+private:
+    JobSystem();
+
+    void WorkerLoop();
+    void RunChunks(const RangeFunction& fn);
+
+    std::vector<std::thread> m_Workers;
+
+    std::mutex m_SubmitMutex;   // Serializes ParallelFor calls
+    std::mutex m_Mutex;         // Guards the job description below
+    std::condition_variable m_WakeCondition;
+    std::condition_variable m_DoneCondition;
+
+    const RangeFunction* m_Job = nullptr;
+    size_t m_JobCount = 0;
+    size_t m_JobGrain = 1;
+    size_t m_ChunkCount = 0;
+    uint64_t m_Generation = 0;
+    size_t m_ActiveWorkers = 0;
+    bool m_Stop = false;
+
+    std::atomic<size_t> m_NextChunk{0};
+    std::atomic<size_t> m_ChunksDone{0};
+};
+
+#endif // JOB_SYSTEM_H
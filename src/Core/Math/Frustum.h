@@ -0,0 +1,182 @@
+#ifndef FRUSTUM_H
+#define FRUSTUM_H
+
+#include <glm/glm.hpp>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include "BoundingVolume.h"
+
+namespace Math {
+
+/**
+ * @brief A plane in Hessian normal form: dot(normal, p) + distance = 0
+ *
+ * Points with a positive signed distance lie on the side the normal points to.
+ */
+struct Plane {
+    glm::vec3 normal{0.0f, 1.0f, 0.0f};
+    float distance = 0.0f;
+
+    Plane() = default;
+    Plane(const glm::vec3& n, float d) : normal(n), distance(d) {}
+
+    /**
+     * @brief Build a plane from a (a, b, c, d) row and normalize it
+     */
+    static Plane FromCoefficients(const glm::vec4& coefficients) {
+        const glm::vec3 n(coefficients);
+        const float length = glm::length(n);
+        if (length <= std::numeric_limits<float>::epsilon()) {
+            return {glm::vec3(0.0f, 1.0f, 0.0f), 0.0f};
+        }
+        return {n / length, coefficients.w / length};
+    }
+
+    /**
+     * @brief Build a plane passing through three points (counter-clockwise winding faces the normal)
+     */
+    static Plane FromPoints(const glm::vec3& a, const glm::vec3& b, const glm::vec3& c) {
+        const glm::vec3 n = glm::cross(b - a, c - a);
+        const float length = glm::length(n);
+        if (length <= std::numeric_limits<float>::epsilon()) {
+            return {glm::vec3(0.0f, 1.0f, 0.0f), -a.y};
+        }
+        const glm::vec3 unit = n / length;
+        return {unit, -glm::dot(unit, a)};
+    }
+
+    [[nodiscard]] float GetSignedDistance(const glm::vec3& point) const {
+        return glm::dot(normal, point) + distance;
+    }
+};
+
+/**
+ * @brief A convex volume bounded by inward-facing planes
+ *
+ * The six planes of a camera frustum are extracted from a view-projection matrix
+ * (Gribb/Hartmann). Extra planes can be appended for convex sub-volumes such as
+ * portal frustums, up to kMaxPlanes.
+ */
+class Frustum {
+public:
+    static constexpr uint32_t kMaxPlanes = 16;
+
+    enum PlaneIndex : uint32_t {
+        Left = 0,
+        Right,
+        Bottom,
+        Top,
+        Near,
+        Far,
+        CameraPlaneCount
+    };
+
+    Frustum() = default;
+
+    explicit Frustum(const glm::mat4& viewProjection) {
+        SetFromMatrix(viewProjection);
+    }
+
+    /**
+     * @brief Extract the six clip planes of an OpenGL (-1..1 depth) view-projection matrix
+     */
+    void SetFromMatrix(const glm::mat4& m) {
+        // glm is column-major: m[column][row]
+        const glm::vec4 row0(m[0][0], m[1][0], m[2][0], m[3][0]);
+        const glm::vec4 row1(m[0][1], m[1][1], m[2][1], m[3][1]);
+        const glm::vec4 row2(m[0][2], m[1][2], m[2][2], m[3][2]);
+        const glm::vec4 row3(m[0][3], m[1][3], m[2][3], m[3][3]);
+
+        m_PlaneCount = CameraPlaneCount;
+        m_Planes[Left] = Plane::FromCoefficients(row3 + row0);
+        m_Planes[Right] = Plane::FromCoefficients(row3 - row0);
+        m_Planes[Bottom] = Plane::FromCoefficients(row3 + row1);
+        m_Planes[Top] = Plane::FromCoefficients(row3 - row1);
+        m_Planes[Near] = Plane::FromCoefficients(row3 + row2);
+        m_Planes[Far] = Plane::FromCoefficients(row3 - row2);
+    }
+
+    /**
+     * @brief Extract the sub-frustum behind an NDC rectangle (e.g. a marquee selection)
+     *
+     * Side planes pass through the rectangle's edges instead of the -1/1 clip
+     * bounds; near and far stay those of the full frustum.
+     */
+    void SetFromMatrix(const glm::mat4& m, const glm::vec2& ndcMin, const glm::vec2& ndcMax) {
+        SetFromMatrix(m);
+
+        const glm::vec4 row0(m[0][0], m[1][0], m[2][0], m[3][0]);
+        const glm::vec4 row1(m[0][1], m[1][1], m[2][1], m[3][1]);
+        const glm::vec4 row3(m[0][3], m[1][3], m[2][3], m[3][3]);
+
+        // x_ndc >= ndcMin.x  <=>  x_clip - ndcMin.x * w_clip >= 0, and so on
+        m_Planes[Left] = Plane::FromCoefficients(row0 - ndcMin.x * row3);
+        m_Planes[Right] = Plane::FromCoefficients(ndcMax.x * row3 - row0);
+        m_Planes[Bottom] = Plane::FromCoefficients(row1 - ndcMin.y * row3);
+        m_Planes[Top] = Plane::FromCoefficients(ndcMax.y * row3 - row1);
+    }
+
+    /**
+     * @brief Remove all planes (an empty frustum contains everything)
+     */
+    void Clear() { m_PlaneCount = 0; }
+
+    /**
+     * @brief Append a plane; ignored once kMaxPlanes is reached
+     */
+    void AddPlane(const Plane& plane) {
+        if (m_PlaneCount < kMaxPlanes) {
+            m_Planes[m_PlaneCount++] = plane;
+        }
+    }
+
+    [[nodiscard]] uint32_t GetPlaneCount() const { return m_PlaneCount; }
+    [[nodiscard]] const Plane& GetPlane(uint32_t index) const { return m_Planes[index]; }
+    [[nodiscard]] const std::array<Plane, kMaxPlanes>& GetPlanes() const { return m_Planes; }
+
+    /**
+     * @brief Conservative AABB test: false only if the box is fully outside one plane
+     */
+    [[nodiscard]] bool IntersectsAABB(const glm::vec3& center, const glm::vec3& extents) const {
+        for (uint32_t i = 0; i < m_PlaneCount; ++i) {
+            const Plane& plane = m_Planes[i];
+            const float d = plane.GetSignedDistance(center);
+            const float r = glm::dot(glm::abs(plane.normal), extents);
+            if (d + r < 0.0f) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    [[nodiscard]] bool IntersectsAABB(const AABB& aabb) const {
+        return IntersectsAABB(aabb.GetCenter(), aabb.GetExtents());
+    }
+
+    [[nodiscard]] bool IntersectsSphere(const glm::vec3& center, float radius) const {
+        for (uint32_t i = 0; i < m_PlaneCount; ++i) {
+            if (m_Planes[i].GetSignedDistance(center) < -radius) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    [[nodiscard]] bool ContainsPoint(const glm::vec3& point) const {
+        for (uint32_t i = 0; i < m_PlaneCount; ++i) {
+            if (m_Planes[i].GetSignedDistance(point) < 0.0f) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    std::array<Plane, kMaxPlanes> m_Planes{};
+    uint32_t m_PlaneCount = 0;
+};
+
+} // namespace Math
+
+#endif // FRUSTUM_H
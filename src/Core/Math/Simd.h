@@ -0,0 +1,13 @@
+#ifndef SIMD_H
+#define SIMD_H
+
+// SSE2 is part of the x86-64 baseline, so every 64-bit desktop target gets the
+// vector paths. Other targets fall back to the scalar loops next to them.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BLACK_SIMD_SSE 1
+#include <emmintrin.h>
+#else
+#define BLACK_SIMD_SSE 0
+#endif
+
+#endif // SIMD_H
@@ -12,16 +12,20 @@ void SelectionManager::SetSelectedObject(const std::shared_ptr<GameObject>& obje
 
         std::cout << "--------- Selection Change ---------" << std::endl;
 
-        // Clear selection state on previously selected object
+        // Clear selection state on previously selected objects
         if (m_SelectedObject) {
-            m_SelectedObject->isSelected = false;
             std::cout << "Deselected: " << m_SelectedObject->GetName() << std::endl;
         }
+        for (const auto& selected : m_SelectedObjects) {
+            selected->isSelected = false;
+        }
+        m_SelectedObjects.clear();
 
         m_SelectedObject = object;
 
         if (m_SelectedObject) {
             m_SelectedObject->isSelected = true;
+            m_SelectedObjects.push_back(m_SelectedObject);
             std::cout << "Selected: " << m_SelectedObject->GetName() << std::endl;
         } else {
             std::cout << "Selection cleared" << std::endl;
@@ -44,6 +48,54 @@ std::shared_ptr<GameObject> SelectionManager::GetSelectedObject() const {
     return m_SelectedObject;
 }
 
+void SelectionManager::SetSelectedObjects(const std::vector<std::shared_ptr<GameObject>>& objects) {
+    try {
+        for (const auto& selected : m_SelectedObjects) {
+            selected->isSelected = false;
+        }
+        m_SelectedObjects.clear();
+        m_SelectedObject = nullptr;
+
+        AddToSelection(objects);
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Exception in SetSelectedObjects: " << e.what() << std::endl;
+    }
+    catch (...) {
+        std::cerr << "Unknown exception in SetSelectedObjects" << std::endl;
+    }
+}
+
+void SelectionManager::AddToSelection(const std::vector<std::shared_ptr<GameObject>>& objects) {
+    // Marquee selections can hold thousands of objects, so log a summary only
+    m_SelectedObjects.reserve(m_SelectedObjects.size() + objects.size());
+    for (const auto& object : objects) {
+        if (!object || object->isSelected) continue;
+        object->isSelected = true;
+        m_SelectedObjects.push_back(object);
+    }
+
+    if (!m_SelectedObject && !m_SelectedObjects.empty()) {
+        m_SelectedObject = m_SelectedObjects.front();
+    }
+
+    std::cout << "Selection: " << m_SelectedObjects.size() << " object(s)" << std::endl;
+    NotifyListeners();
+}
+
+void SelectionManager::Deselect(const std::shared_ptr<GameObject>& object) {
+    if (!object || !object->isSelected) return;
+
+    object->isSelected = false;
+    m_SelectedObjects.erase(std::remove(m_SelectedObjects.begin(), m_SelectedObjects.end(), object),
+                            m_SelectedObjects.end());
+
+    if (m_SelectedObject == object) {
+        m_SelectedObject = m_SelectedObjects.empty() ? nullptr : m_SelectedObjects.front();
+    }
+    NotifyListeners();
+}
+
 void SelectionManager::ClearSelection() {
     SetSelectedObject(nullptr);
 }
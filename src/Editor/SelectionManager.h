@@ -12,8 +12,9 @@ using SelectionChangedCallback = std::function<void(std::shared_ptr<GameObject>)
 /**
  * @brief Manages selection state across the editor
  * 
- * This singleton class maintains the currently selected GameObject and notifies
- * listeners when the selection changes.
+ * This singleton class maintains the currently selected GameObjects and notifies
+ * listeners when the selection changes. Several objects can be selected at once
+ * (marquee selection); the primary object is the one the inspector and gizmo use.
  */
 class SelectionManager {
 public:
@@ -27,8 +28,21 @@ public:
     // Set the currently selected object and notify listeners
     void SetSelectedObject(const std::shared_ptr<GameObject>& object);
     
-    // Get the currently selected object
+    // Get the currently selected object (the primary one when several are selected)
     [[nodiscard]] std::shared_ptr<GameObject> GetSelectedObject() const;
+
+    // Replace the selection with several objects; the first becomes the primary
+    void SetSelectedObjects(const std::vector<std::shared_ptr<GameObject>>& objects);
+
+    // Add objects to the current selection, keeping the primary if there is one
+    void AddToSelection(const std::vector<std::shared_ptr<GameObject>>& objects);
+
+    // Remove a single object from the selection
+    void Deselect(const std::shared_ptr<GameObject>& object);
+
+    // All selected objects, primary first
+    [[nodiscard]] const std::vector<std::shared_ptr<GameObject>>& GetSelectedObjects() const { return m_SelectedObjects; }
+    [[nodiscard]] size_t GetSelectionCount() const { return m_SelectedObjects.size(); }
     
     // Clear the current selection
     void ClearSelection();
@@ -43,8 +57,11 @@ private:
     // Private constructor for singleton
     SelectionManager() = default;
     
-    // Currently selected object
+    // Currently selected (primary) object
     std::shared_ptr<GameObject> m_SelectedObject = nullptr;
+
+    // Every selected object, primary first; GameObject::isSelected mirrors membership
+    std::vector<std::shared_ptr<GameObject>> m_SelectedObjects;
     
     // List of registered listeners
     std::vector<SelectionChangedCallback> m_Listeners;
@@ -6,6 +6,7 @@
 
 #include "imgui.h"
 #include "Engine/Scene/Scene.h"
+#include "Engine/Render/State/GLStateCache.h"
 
 extern glm::mat4 gViewMatrix;
 extern glm::mat4 gProjectionMatrix;
@@ -36,7 +37,7 @@ extern glm::mat4 gProjectionMatrix;
         if (m_ViewportWidth != static_cast<int>(contentRegionAvail.x) ||
             m_ViewportHeight != static_cast<int>(contentRegionAvail.y)) {
             // Resize the framebuffer
-            glBindTexture(GL_TEXTURE_2D, m_TextureID);
+            GLStateCache::GetInstance().BindTexture(0, GL_TEXTURE_2D, m_TextureID);
             glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB,
                          static_cast<int>(contentRegionAvail.x),
                          static_cast<int>(contentRegionAvail.y),
@@ -55,8 +56,9 @@ extern glm::mat4 gProjectionMatrix;
 
         // Render scene to framebuffer
         if (m_FramebufferID > 0) {
-            glBindFramebuffer(GL_FRAMEBUFFER, m_FramebufferID);
-            glViewport(0, 0, m_ViewportWidth, m_ViewportHeight);
+            GLStateCache& state = GLStateCache::GetInstance();
+            state.BindFramebuffer(GL_FRAMEBUFFER, m_FramebufferID);
+            state.SetViewport(0, 0, m_ViewportWidth, m_ViewportHeight);
             glClearColor(0.2f, 0.2f, 0.2f, 1.0f);
             glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
@@ -65,7 +67,7 @@ extern glm::mat4 gProjectionMatrix;
                 m_Scene->DrawAll();
             }
 
-            glBindFramebuffer(GL_FRAMEBUFFER, 0);
+            state.BindFramebuffer(GL_FRAMEBUFFER, 0);
         }
 
         // Display the framebuffer texture in ImGui
@@ -91,12 +93,13 @@ extern glm::mat4 gProjectionMatrix;
 
     void GamePanel::SetupFramebuffer() {
         // Create framebuffer
+        GLStateCache& state = GLStateCache::GetInstance();
         glGenFramebuffers(1, &m_FramebufferID);
-        glBindFramebuffer(GL_FRAMEBUFFER, m_FramebufferID);
+        state.BindFramebuffer(GL_FRAMEBUFFER, m_FramebufferID);
 
         // Create a texture attachment
         glGenTextures(1, &m_TextureID);
-        glBindTexture(GL_TEXTURE_2D, m_TextureID);
+        state.BindTexture(0, GL_TEXTURE_2D, m_TextureID);
 
         // Set texture parameters
         glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, m_ViewportWidth, m_ViewportHeight,
@@ -119,7 +122,7 @@ extern glm::mat4 gProjectionMatrix;
         if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
             std::cerr << "ERROR: Game framebuffer not complete!" << std::endl;
 
-        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        state.BindFramebuffer(GL_FRAMEBUFFER, 0);
 
         std::cout << "GamePanel: Created framebuffer (" << m_ViewportWidth << "x" << m_ViewportHeight << ")" << std::endl;
     }
@@ -131,11 +134,13 @@ extern glm::mat4 gProjectionMatrix;
         }
 
         if (m_TextureID) {
+            GLStateCache::GetInstance().ForgetTexture(m_TextureID);
             glDeleteTextures(1, &m_TextureID);
             m_TextureID = 0;
         }
 
         if (m_FramebufferID) {
+            GLStateCache::GetInstance().ForgetFramebuffer(m_FramebufferID);
             glDeleteFramebuffers(1, &m_FramebufferID);
             m_FramebufferID = 0;
         }
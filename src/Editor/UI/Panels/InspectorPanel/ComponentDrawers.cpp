@@ -3,6 +3,9 @@
 #include "Engine/Component/TransformComponent.h"
 #include "Engine/Component/MeshComponent.h"
 #include "Engine/Component/MeshRendererComponent.h"
+#include "Engine/Component/CellComponent.h"
+#include "Engine/Component/PortalComponent.h"
+#include "Engine/Entity/GameObject.h"
 #include <imgui.h>
 #include <string>
 #include <unordered_map>
@@ -68,16 +71,64 @@ void DrawMeshComponent(BaseComponent* component) {
 // Mesh renderer component drawer
 void DrawMeshRendererComponent(BaseComponent* component) {
     ImGui::Text("Mesh Renderer Properties");
+    const auto material = static_cast<MeshRendererComponent*>(component)->GetMaterial();
 
     bool castShadows = true;
     ImGui::Checkbox("Cast Shadows", &castShadows);
 
-    bool receiveShadows = true;
-    ImGui::Checkbox("Receive Shadows", &receiveShadows);
+    // Switches the material to its shader variant without shadow sampling
+    bool receiveShadows = material ? material->GetReceiveShadows() : true;
+    if (ImGui::Checkbox("Receive Shadows", &receiveShadows) && material) {
+        material->SetReceiveShadows(receiveShadows);
+    }
 
     const char* materials[] = { "Default", "Metal", "Wood", "Glass", "Plastic" };
     int currentMaterial = 0;
     ImGui::Combo("Material", &currentMaterial, materials, IM_ARRAYSIZE(materials));
+
+    // Edits rewrite only this material's parameter block
+    if (!material) return;
+
+    glm::vec4 baseColor = material->GetParams().baseColor;
+    if (ImGui::ColorEdit4("Base Color", &baseColor[0])) {
+        material->SetBaseColor(baseColor);
+    }
+    float specular = material->GetParams().specularStrength;
+    float shininess = material->GetParams().shininess;
+    bool changed = ImGui::DragFloat("Specular", &specular, 0.01f, 0.0f, 1.0f);
+    changed |= ImGui::DragFloat("Shininess", &shininess, 0.5f, 1.0f, 256.0f);
+    if (changed) {
+        material->SetSpecular(specular, shininess);
+    }
+    ImGui::Text("Parameter block: %u", material->GetBlockIndex());
+}
+
+// Cell component drawer
+void DrawCellComponent(BaseComponent* component) {
+    auto* cell = static_cast<CellComponent*>(component);
+
+    glm::vec3 min = cell->GetLocalBounds().GetMin();
+    glm::vec3 max = cell->GetLocalBounds().GetMax();
+    bool changed = ImGui::DragFloat3("Min", &min[0], 0.1f);
+    changed |= ImGui::DragFloat3("Max", &max[0], 0.1f);
+    if (changed) {
+        cell->SetLocalBounds(Math::AABB(glm::min(min, max), glm::max(min, max)));
+    }
+}
+
+// Portal component drawer
+void DrawPortalComponent(BaseComponent* component) {
+    auto* portal = static_cast<PortalComponent*>(component);
+
+    glm::vec2 size = portal->GetSize();
+    if (ImGui::DragFloat2("Size", &size[0], 0.05f, 0.01f)) {
+        portal->SetSize(size);
+    }
+
+    const auto cellA = portal->GetCellA();
+    const auto cellB = portal->GetCellB();
+    ImGui::Text("Cell A: %s", cellA ? cellA->GetName().c_str() : "-");
+    ImGui::Text("Cell B: %s", cellB ? cellB->GetName().c_str() : "-");
 }
 
 // Rigid body component drawer
@@ -94,5 +145,9 @@ void ComponentDrawers::RegisterAllDrawers() {
                   std::function<void(BaseComponent*)>(DrawMeshComponent));
     RegisterDrawer("MeshRendererComponent", 
                   std::function<void(BaseComponent*)>(DrawMeshRendererComponent));
+    RegisterDrawer("CellComponent",
+                  std::function<void(BaseComponent*)>(DrawCellComponent));
+    RegisterDrawer("PortalComponent",
+                  std::function<void(BaseComponent*)>(DrawPortalComponent));
 
 }
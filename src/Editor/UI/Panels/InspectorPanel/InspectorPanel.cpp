@@ -3,6 +3,7 @@
 #include "Engine/Component/BaseComponent.h"
 #include "Editor/SelectionManager.h"
 #include "imgui.h"
+#include <algorithm>
 #include <utility>
 #include <glm/gtc/type_ptr.hpp> 
 
@@ -64,6 +65,21 @@ void InspectorPanel::DrawContent() {
         m_SelectedObject->SetActive(isActive);
     }
 
+    // Occluder checkbox
+    ImGui::Checkbox("Occluder", &m_SelectedObject->isOccluder);
+
+    // Static objects go into the scene's prebuilt BVH
+    bool isStatic = m_SelectedObject->IsStatic();
+    if (ImGui::Checkbox("Static", &isStatic)) {
+        m_SelectedObject->SetStatic(isStatic);
+    }
+
+    // Raycast layer (0..31)
+    int layer = static_cast<int>(m_SelectedObject->layer);
+    if (ImGui::InputInt("Layer", &layer)) {
+        m_SelectedObject->layer = static_cast<uint32_t>(std::clamp(layer, 0, 31));
+    }
+
     // Draw components
     ImGui::Separator();
     for (const auto& component : m_SelectedObject->GetComponents()) {
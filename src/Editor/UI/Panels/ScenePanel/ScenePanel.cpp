@@ -4,10 +4,17 @@
 
 #include "ScenePanel.h"
 #include <iostream>
+#include <algorithm>
 #include <glm/gtc/type_ptr.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 
 #include "Engine/Component/TransformComponent.h"
+#include "Engine/Render/Mesh/Mesh.h"
+#include "Engine/Render/Mesh/GeometryArena.h"
+#include "Engine/Render/Material/Material.h"
+#include "Engine/Render/Shader/ShaderLibrary.h"
+#include "Engine/Render/Shader/FrameUniformBuffer.h"
+#include "Engine/Render/State/GLStateCache.h"
 #include "Core/Math/TransformUtils.h"
 #include "Core/Camera/Camera.h"
 #include "Core/InputManager/InputManager.h"
@@ -39,15 +46,7 @@ void ScenePanel::SetScene(const std::shared_ptr<Scene> &scene) {
     }
     //**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//
     InitializeShadowMap();
-    //set default shader for all objects in the scene
-    if (m_Scene) {
-        const std::string shaderPath = "../src/shaders/";
-        auto defaultShader = std::make_shared<Shader>(
-            (shaderPath + "default.vert").c_str(),
-            (shaderPath + "default.frag").c_str()
-        );
-        m_Scene->SetDefaultShader(defaultShader);
-    }
+    // Scene materials pick their default shader variant themselves (Scene::UseDefaultShaders)
     //**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//
 
 }
@@ -168,8 +167,10 @@ bool ScenePanel::OnInputEvent(const InputEvent& event) {
                     return true;
                 }
 
-                // Handle object selection
-                SelectObjectAtMousePos();
+                // Seçim bırakınca yapılır: sürüklenirse dikdörtgen seçim, yoksa tek nesne seçimi
+                m_MarqueePending = true;
+                m_MarqueeActive = false;
+                m_MarqueeStart = m_MousePosInPanel;
                 return true;
             }
             return false;
@@ -259,11 +260,12 @@ void ScenePanel::UpdateCamera(float deltaTime) {
 }
 
 void ScenePanel::SetupFramebuffer() {
+    GLStateCache& state = GLStateCache::GetInstance();
     glGenFramebuffers(1, &m_FramebufferID);
-    glBindFramebuffer(GL_FRAMEBUFFER, m_FramebufferID);
+    state.BindFramebuffer(GL_FRAMEBUFFER, m_FramebufferID);
 
     glGenTextures(1, &m_TextureID);
-    glBindTexture(GL_TEXTURE_2D, m_TextureID);
+    state.BindTexture(0, GL_TEXTURE_2D, m_TextureID);
     glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, 1280, 720, 0, GL_RGB, GL_UNSIGNED_BYTE, nullptr);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
@@ -278,7 +280,10 @@ void ScenePanel::SetupFramebuffer() {
     if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
         std::cout << "ERROR: Framebuffer not complete!" << std::endl;
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    state.BindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    // Object ID'leri color attachment 1'e yazılır
+    m_ObjectPicker.Initialize(m_FramebufferID, 1280, 720);
 }
 
 void ScenePanel::DrawContent() {
@@ -306,6 +311,12 @@ void ScenePanel::DrawContent() {
         lastHeight = static_cast<int>(contentRegionAvail.y);
     }
 
+    // Finished GPU picks from earlier frames; never waits on the GPU
+    m_ObjectPicker.Update();
+    if (const std::optional<PickResult> click = m_ObjectPicker.TakeClickResult()) {
+        ApplyGpuPick(*click);
+    }
+
     //**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//
     //**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//
     // Işık pozisyonunuzu ve view matrisini güncelleyin (büyük projenizde ışık yönetimi nerede yapılıyorsa oradan alın)
@@ -315,11 +326,21 @@ void ScenePanel::DrawContent() {
     m_LightView = glm::lookAt(currentLightPos, glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(0.0f, 1.0f, 0.0f)); // Hedef noktayı sahnenin merkezi olarak varsaydım
     m_LightSpaceMatrix = m_LightProjection * m_LightView;*/
 
+    // Kamera matrisleri gölge geçişinden önce güncellenmeli: gölge atan objeler kamera frustum'una göre seçiliyor
+    m_ViewMatrix = glm::lookAt(m_CameraPosition, m_CameraPosition + m_CameraFront, m_CameraUp);
+    gViewMatrix = m_ViewMatrix; // Use the exact same matrix for global reference
+    if (m_Scene) {
+        m_Scene->SetViewMatrix(m_ViewMatrix);
+        m_Scene->SetProjectionMatrix(m_ProjectionMatrix);
+    }
+
     // --- Gölge Haritasını Render Etme Adımı ---
+    // Scene state goes through the cache: unchanged binds between passes are not sent again
+    GLStateCache& state = GLStateCache::GetInstance();
     if (m_ShadowMapFBO > 0) {
-        glEnable(GL_DEPTH_TEST); // Derinlik testini aç
-        glViewport(0, 0, m_ShadowMapWidth, m_ShadowMapHeight);
-        glBindFramebuffer(GL_FRAMEBUFFER, m_ShadowMapFBO);
+        state.SetDepthTest(true); // Derinlik testini aç
+        state.SetViewport(0, 0, m_ShadowMapWidth, m_ShadowMapHeight);
+        state.BindFramebuffer(GL_FRAMEBUFFER, m_ShadowMapFBO);
         glClear(GL_DEPTH_BUFFER_BIT); // Sadece derinlik buffer'ını temizle
 
 
@@ -349,47 +370,44 @@ void ScenePanel::DrawContent() {
             // m_Scene->DrawObjectsWithSpecificShader(m_ShadowMapShader); // Bu Scene'deki tüm objeleri lightSpaceMatrix ile çizsin
 
             m_Scene->DrawAll2ShadowMap(); // Bu fonksiyonun Scene sınıfınızda gölge haritası için objeleri çizen bir versiyon olması gerekir.
-            glBindFramebuffer(GL_FRAMEBUFFER, 0);
         }
     }
     // Varsayılan framebuffer'a geri dön
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-    glViewport(0, 0, static_cast<int>(contentRegionAvail.x), static_cast<int>(contentRegionAvail.y)); // Viewport'u panel boyutuna geri getir
+    state.BindFramebuffer(GL_FRAMEBUFFER, 0);
+    state.SetViewport(0, 0, static_cast<int>(contentRegionAvail.x), static_cast<int>(contentRegionAvail.y)); // Viewport'u panel boyutuna geri getir
     // --- Gölge Haritası Render Etme Adımı Sonu ---
     //**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//
     //**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//
 
 
     if (m_FramebufferID > 0) {
-        glBindFramebuffer(GL_FRAMEBUFFER, m_FramebufferID);
-        glViewport(0, 0, static_cast<int>(contentRegionAvail.x), static_cast<int>(contentRegionAvail.y));
+        state.BindFramebuffer(GL_FRAMEBUFFER, m_FramebufferID);
+        state.SetViewport(0, 0, static_cast<int>(contentRegionAvail.x), static_cast<int>(contentRegionAvail.y));
         glClearColor(0.17f, 0.1f, 0.3f, 1.0f);
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        m_ObjectPicker.BeginPass();
 
         if (m_Scene) {
             //**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//
-            //default shader'ı aktif et ve lightSpaceMatrix uniformunu ayarla
-            m_Scene->GetDefaultShader()->use();
-            glUniformMatrix4fv(glGetUniformLocation(m_Scene->GetDefaultShader()->ID, "lightSpaceMatrix"), 1, GL_FALSE, glm::value_ptr(m_LightSpaceMatrix));
-            glActiveTexture(GL_TEXTURE0 + 2);
-            glBindTexture(GL_TEXTURE_2D, m_ShadowMapTexture); // Gölge haritasını bağla
-            glUniform1i(glGetUniformLocation(m_Scene->GetDefaultShader()->ID, "shadowMap"), 2); // ShadowMap uniformunu ayarla
-            glActiveTexture(GL_TEXTURE0);
+            // lightSpaceMatrix FrameData bloğunda; shadowMap sampler'ı link sırasında bu birime bağlandı
+            state.BindTexture(FrameUniformBuffer::kShadowMapUnit, GL_TEXTURE_2D, m_ShadowMapTexture); // Gölge haritasını bağla
             //**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//
 
-            // Update camera matrices consistently for both rendering and ImGuizmo
-            m_ViewMatrix = glm::lookAt(m_CameraPosition, m_CameraPosition + m_CameraFront, m_CameraUp);
-            gViewMatrix = m_ViewMatrix; // Use the exact same matrix for global reference
-
-            m_Scene->SetViewMatrix(m_ViewMatrix);
-            m_Scene->SetProjectionMatrix(m_ProjectionMatrix);
+            // Camera matrices were already updated before the shadow pass
             m_Scene->DrawAll();
+            ObjectPicker::EndPass(); // The highlight reuses the material shader; keep it out of the ID buffer
 
             // Highlight selected object if any
             HighlightSelectedObject();
         }
 
-        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        // Hover: one pixel per frame, read back asynchronously
+        if (m_MouseInPanel && !m_IsRotating && !m_IsPanning) {
+            const glm::ivec2 pixel = GetMouseFramebufferPixel();
+            m_ObjectPicker.RequestPick(pixel.x, pixel.y, PickRequestType::Hover);
+        }
+
+        state.BindFramebuffer(GL_FRAMEBUFFER, 0);
         ImGui::Image(reinterpret_cast<ImTextureID>(reinterpret_cast<void *>(static_cast<intptr_t>(m_TextureID))),
                      contentRegionAvail, ImVec2(0, 1), ImVec2(1, 0));
 
@@ -410,6 +428,8 @@ void ScenePanel::DrawContent() {
 
         // Draw ImGuizmo if object is selected
         DrawGuizmo();
+
+        UpdateMarqueeSelection();
     }
 
     // Debug information
@@ -436,26 +456,102 @@ void ScenePanel::DrawContent() {
         ImGui::SetCursorPos(ImVec2(10, 70));
         ImGui::Text("NDC: %.2f, %.2f", ndcX, ndcY);
     }
+
+    // Frustum culling counters from the last DrawAll
+    if (m_Scene) {
+        const CullingStats& culling = m_Scene->GetCullingStats();
+        ImGui::SetCursorPos(ImVec2(10, 110));
+        ImGui::Text("Visible: %u / %u (culled %u)", culling.visible, culling.total, culling.culled);
+
+        const OcclusionStats& occlusion = m_Scene->GetOcclusionStats();
+        ImGui::SetCursorPos(ImVec2(10, 130));
+        ImGui::Text("Occluded: %u / %u (%u occluders, %u tris)", occlusion.occluded, occlusion.tested,
+                    occlusion.occluders, occlusion.triangles);
+
+        const ShadowCasterStats& shadow = m_Scene->GetShadowCasterStats();
+        ImGui::SetCursorPos(ImVec2(10, 150));
+        ImGui::Text("Shadow casters: %u / %u (in light frustum %u)", shadow.casters, shadow.total,
+                    shadow.inLightFrustum);
+
+        const PortalStats& portals = m_Scene->GetPortalStats();
+        ImGui::SetCursorPos(ImVec2(10, 170));
+        ImGui::Text("Cells: %u / %u (culled %u)", portals.visibleCells, portals.cells, portals.culled);
+
+        const MeshletStats& meshlets = Mesh::GetMeshletStats();
+        ImGui::SetCursorPos(ImVec2(10, 190));
+        ImGui::Text("Triangles: %u / %u (meshlets %u / %u, %u draws)", meshlets.visibleTriangles,
+                    meshlets.triangles, meshlets.visibleMeshlets, meshlets.meshlets, meshlets.draws);
+
+        // Binds of the sorted queue against drawing in hierarchy order
+        const RenderStateStats& sorted = m_Scene->GetCameraView().GetSortedStats();
+        const RenderStateStats& unsorted = m_Scene->GetCameraView().GetUnsortedStats();
+        ImGui::SetCursorPos(ImVec2(10, 210));
+        ImGui::Text("State changes: %u (unsorted %u; shader %u, material %u, mesh %u)", sorted.Total(),
+                    unsorted.Total(), sorted.shaderChanges, sorted.materialChanges, sorted.meshChanges);
+
+        const DrawCallStats& draws = m_Scene->GetDrawCallStats();
+        ImGui::SetCursorPos(ImVec2(10, 230));
+        ImGui::Text("Draw calls: %u (%u instanced, %u indirect for %u batches, %u instances, %u fallback)",
+                    draws.drawCalls, draws.instancedDraws, draws.indirectDraws, draws.indirectCommands,
+                    draws.instances, draws.fallbackDraws);
+
+        // Uniform name lookups; drawing uses handles resolved at link time
+        ImGui::SetCursorPos(ImVec2(10, 250));
+        ImGui::Text("Uniform lookups: %u", Shader::GetLookupCount());
+
+        // Main-thread time in shader compiles since start; async variants only add what the driver makes us wait
+        const ShaderLibraryStats& shaders = ShaderLibrary::GetInstance().GetStats();
+        ImGui::SetCursorPos(ImVec2(10, 270));
+        ImGui::Text("Shaders: %u compiled, %u cached, %u pending (%.1f ms blocking)", shaders.compiles,
+                    shaders.binaryLoads, shaders.pending, shaders.blockingMs);
+
+        const GLStateStats& glState = GLStateCache::GetInstance().GetStats();
+        ImGui::SetCursorPos(ImVec2(10, 290));
+        ImGui::Text("GL state calls: %u (elided %u)", glState.issued, glState.elided);
+
+        const GeometryArenaStats& arena = GeometryArena::GetInstance().GetStats();
+        ImGui::SetCursorPos(ImVec2(10, 310));
+        constexpr float kMiB = 1024.0f * 1024.0f;
+        ImGui::Text("Geometry arena: %u meshes, %.2f of %.1f MB (%.2f MB unpacked), %u defrags",
+                    arena.allocations, static_cast<float>(arena.vertexBytesUsed + arena.indexBytesUsed) / kMiB,
+                    static_cast<float>(arena.vertexBytesCapacity + arena.indexBytesCapacity) / kMiB,
+                    static_cast<float>(arena.unpackedBytes) / kMiB, arena.defragmentations);
+
+        ImGui::SetCursorPos(ImVec2(10, 330));
+        ImGui::Text("Selected: %zu", SelectionManager::GetInstance().GetSelectionCount());
+
+        if (m_MouseInPanel) {
+            const GameObject* hovered = GameObject::FindByInstanceID(m_ObjectPicker.GetHoveredID());
+            ImGui::SetCursorPos(ImVec2(10, 350));
+            ImGui::Text("Hovered: %s", hovered ? hovered->GetName().c_str() : "-");
+        }
+    }
 }
 
 void ScenePanel::ResizeFramebuffer(int width, int height) {
-    glBindTexture(GL_TEXTURE_2D, m_TextureID);
+    GLStateCache::GetInstance().BindTexture(0, GL_TEXTURE_2D, m_TextureID);
     glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, nullptr);
 
     glBindRenderbuffer(GL_RENDERBUFFER, m_DepthRenderBuffer);
     glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
 
+    m_ObjectPicker.Resize(width, height);
+    m_AwaitingGpuPick = false; // In-flight picks were dropped with the old ID buffer
+
     const float aspectRatio = static_cast<float>(width) / static_cast<float>(height);
     m_ProjectionMatrix = glm::perspective(glm::radians(45.0f), aspectRatio, 0.1f, 1000.0f);
     gProjectionMatrix = m_ProjectionMatrix;
 }
 
 void ScenePanel::CleanupResources() {
+    m_ObjectPicker.Cleanup();
     if (m_FramebufferID != 0) {
+        GLStateCache::GetInstance().ForgetFramebuffer(m_FramebufferID);
         glDeleteFramebuffers(1, &m_FramebufferID);
         m_FramebufferID = 0;
     }
     if (m_TextureID != 0) {
+        GLStateCache::GetInstance().ForgetTexture(m_TextureID);
         glDeleteTextures(1, &m_TextureID);
         m_TextureID = 0;
     }
@@ -542,10 +638,101 @@ void ScenePanel::SelectObjectAtMousePos() {
     std::cout << "----------------------------------------" << std::endl;
 }
 
+void ScenePanel::PickObjectAtMousePos() {
+    if (!m_MouseInPanel || !m_Scene) return;
+
+    // The ID buffer resolves the exact mesh under the cursor; the result arrives in a later frame
+    const glm::ivec2 pixel = GetMouseFramebufferPixel();
+    if (!m_AwaitingGpuPick && m_ObjectPicker.RequestPick(pixel.x, pixel.y, PickRequestType::Click)) {
+        m_AwaitingGpuPick = true;
+        return;
+    }
+
+    // No ID buffer or readback slot available: CPU ray pick against the bounds
+    SelectObjectAtMousePos();
+}
+
+void ScenePanel::ApplyGpuPick(const PickResult& result) {
+    m_AwaitingGpuPick = false;
+    if (!m_Scene) return;
+
+    // The object may have been deleted while the readback was in flight
+    std::shared_ptr<GameObject> hitObject;
+    if (GameObject* object = GameObject::FindByInstanceID(result.instanceID)) {
+        hitObject = object->weak_from_this().lock();
+        if (hitObject && !m_Scene->HasGameObject(hitObject)) hitObject = nullptr;
+    }
+
+    std::cout << "[GPU Pick] " << result.x << ", " << result.y << " -> "
+              << (hitObject ? hitObject->GetName() : std::string("No object selected")) << std::endl;
+    SelectionManager::GetInstance().SetSelectedObject(hitObject);
+}
+
+glm::ivec2 ScenePanel::GetMouseFramebufferPixel() const {
+    // Panel y grows downwards, GL rows start at the bottom
+    const int x = static_cast<int>(m_MousePosInPanel.x);
+    const int y = static_cast<int>(m_PanelSize.y) - 1 - static_cast<int>(m_MousePosInPanel.y);
+    return {x, y};
+}
+
 void ScenePanel::ClearSelection() {
-    if (m_SelectedObject) {
-        m_SelectedObject->isSelected = false;
-        m_SelectedObject = nullptr;
+    m_SelectedObject = nullptr;
+    SelectionManager::GetInstance().ClearSelection();
+}
+
+void ScenePanel::UpdateMarqueeSelection() {
+    if (!m_MarqueePending) return;
+
+    constexpr float dragThreshold = 4.0f; // Pixels before a click turns into a drag
+    const glm::vec2 current = glm::clamp(m_MousePosInPanel, glm::vec2(0.0f), m_PanelSize);
+    if (!m_MarqueeActive && glm::length(current - m_MarqueeStart) > dragThreshold) {
+        m_MarqueeActive = true;
+    }
+
+    if (m_MarqueeActive) {
+        const glm::vec2 minPos = glm::min(m_MarqueeStart, current);
+        const glm::vec2 maxPos = glm::max(m_MarqueeStart, current);
+        ImDrawList* drawList = ImGui::GetWindowDrawList();
+        const ImVec2 rectMin(m_PanelMin.x + minPos.x, m_PanelMin.y + minPos.y);
+        const ImVec2 rectMax(m_PanelMin.x + maxPos.x, m_PanelMin.y + maxPos.y);
+        drawList->AddRectFilled(rectMin, rectMax, IM_COL32(80, 140, 255, 40));
+        drawList->AddRect(rectMin, rectMax, IM_COL32(80, 140, 255, 200));
+    }
+
+    // Polled rather than waiting for MouseUp, which is not delivered once the cursor leaves the panel
+    if (InputManager::IsMouseButtonPressed(GLFW_MOUSE_BUTTON_LEFT)) return;
+
+    m_MarqueePending = false;
+    if (m_MarqueeActive) {
+        m_MarqueeActive = false;
+        const bool additive = InputManager::IsKeyPressed(GLFW_KEY_LEFT_SHIFT) ||
+                              InputManager::IsKeyPressed(GLFW_KEY_RIGHT_SHIFT);
+        SelectObjectsInRect(m_MarqueeStart, current, additive);
+    } else {
+        PickObjectAtMousePos();
+    }
+}
+
+void ScenePanel::SelectObjectsInRect(const glm::vec2& cornerA, const glm::vec2& cornerB, const bool additive) {
+    if (!m_Scene || m_PanelSize.x <= 0.0f || m_PanelSize.y <= 0.0f) return;
+
+    const glm::vec2 minPos = glm::min(cornerA, cornerB);
+    const glm::vec2 maxPos = glm::max(cornerA, cornerB);
+
+    // Panel y grows downwards, NDC y upwards
+    const glm::vec2 ndcMin(2.0f * minPos.x / m_PanelSize.x - 1.0f, 1.0f - 2.0f * maxPos.y / m_PanelSize.y);
+    const glm::vec2 ndcMax(2.0f * maxPos.x / m_PanelSize.x - 1.0f, 1.0f - 2.0f * minPos.y / m_PanelSize.y);
+
+    Math::Frustum frustum;
+    frustum.SetFromMatrix(m_ProjectionMatrix * m_ViewMatrix, ndcMin, ndcMax);
+
+    std::vector<std::shared_ptr<GameObject>> objects;
+    m_Scene->QueryFrustum(frustum, objects);
+
+    if (additive) {
+        SelectionManager::GetInstance().AddToSelection(objects);
+    } else {
+        SelectionManager::GetInstance().SetSelectedObjects(objects);
     }
 }
 
@@ -557,17 +744,37 @@ void ScenePanel::HighlightSelectedObject() {
         return;
     }
 
-    glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
-    glLineWidth(2.0f);
-    glDisable(GL_DEPTH_TEST);
+    GLStateCache& state = GLStateCache::GetInstance();
+    state.SetPolygonMode(GL_LINE);
+    state.SetLineWidth(2.0f);
+    state.SetDepthTest(false);
 
-    for (const auto& comp: selected->GetComponents()) {
-        comp->DrawWireframe();
+    // Outline from the frame's camera view; occluded items included, the depth test is off anyway
+    m_SelectedIDs.clear();
+    for (const auto& object : SelectionManager::GetInstance().GetSelectedObjects()) {
+        m_SelectedIDs.push_back(object->GetInstanceID());
+    }
+    // Sorted once, so each item is a binary search however large the selection
+    std::sort(m_SelectedIDs.begin(), m_SelectedIDs.end());
+
+    const RenderView& view = m_Scene->GetCameraView();
+    for (const RenderItem& item : view.GetItems()) {
+        if (!std::binary_search(m_SelectedIDs.begin(), m_SelectedIDs.end(), item.objectId)) continue;
+
+        // The same program DrawAll drew the item with
+        Shader* shader = item.shader;
+        if (!shader || !shader->IsReady()) continue; // Outlined once it has compiled
+        // Camera matrices are still in the FrameData block from DrawAll
+        const Shader::EngineUniforms& uniforms = shader->GetEngineUniforms();
+        shader->use();
+        shader->set(uniforms.model, item.VertexModel());
+        shader->set(uniforms.color, glm::vec4(1.0f, 1.0f, 1.0f, 1.0f)); // White outline
+        item.mesh->Draw();
     }
 
-    glLineWidth(1.0f);
-    glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
-    glEnable(GL_DEPTH_TEST);
+    state.SetLineWidth(1.0f);
+    state.SetPolygonMode(GL_FILL);
+    state.SetDepthTest(true);
 }
 
 
@@ -672,8 +879,9 @@ void ScenePanel::InitializeShadowMap() {
     glGenFramebuffers(1, &m_ShadowMapFBO);
 
     // Gölge haritası dokusu oluştur
+    GLStateCache& state = GLStateCache::GetInstance();
     glGenTextures(1, &m_ShadowMapTexture);
-    glBindTexture(GL_TEXTURE_2D, m_ShadowMapTexture);
+    state.BindTexture(0, GL_TEXTURE_2D, m_ShadowMapTexture);
     glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT, m_ShadowMapWidth, m_ShadowMapHeight, 0, GL_DEPTH_COMPONENT, GL_FLOAT, NULL);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
@@ -683,7 +891,7 @@ void ScenePanel::InitializeShadowMap() {
     glTexParameterfv(GL_TEXTURE_2D, GL_TEXTURE_BORDER_COLOR, borderColor);
 
     // Framebuffer'a derinlik dokusunu ata
-    glBindFramebuffer(GL_FRAMEBUFFER, m_ShadowMapFBO);
+    state.BindFramebuffer(GL_FRAMEBUFFER, m_ShadowMapFBO);
     glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, m_ShadowMapTexture, 0);
 
     // Sadece derinlik yazacağımız için renk buffer'larına yazmayı devre dışı bırak
@@ -698,7 +906,7 @@ void ScenePanel::InitializeShadowMap() {
     }*/
 
     // Varsayılan framebuffer'a geri dön
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    state.BindFramebuffer(GL_FRAMEBUFFER, 0);
 
     // Işık projeksiyon matrisini hesapla (ışık kaynağınızın türüne göre)
     // Bu değerleri sahnenizdeki objelerin kapsadığı alanı düşünerek ayarlayın.
@@ -716,16 +924,14 @@ void ScenePanel::InitializeShadowMap() {
 
 
     const std::string shaderPath = "../src/shaders/";
-    const auto shadowMapProgram = std::make_shared<Shader>(
-    (shaderPath + "shadowMap.vert").c_str(),
-    (shaderPath + "shadowMap.frag").c_str()
-    );
+    const auto shadowMapProgram = ShaderLibrary::GetInstance().Get(shaderPath + "shadowMap.vert",
+                                                                   shaderPath + "shadowMap.frag");
     m_Scene->SetShadowMapShader(shadowMapProgram);
 
-    // 3. Hesaplanan lightSpaceMatrix'i shadowMapProgram'a uniform olarak gönder
-    if (m_Scene && m_Scene->GetShadowMapShader()) { // m_Scene ve shader'ın varlığını kontrol et
-        m_Scene->GetShadowMapShader()->use(); // Shader'ı aktif et
-        glUniformMatrix4fv(glGetUniformLocation(m_Scene->GetShadowMapShader()->ID, "lightSpaceMatrix"), 1, GL_FALSE, glm::value_ptr(m_LightSpaceMatrix));
+    // lightSpaceMatrix shader'lara FrameData bloğuyla gider (Scene::DrawAll2ShadowMap/DrawAll).
+    // Gölge atacak objeleri seçmek için: ışık hedefe doğru ilerler, gölge en fazla projeksiyon derinliği kadar uzar
+    if (m_Scene) {
+        m_Scene->SetShadowLight(m_LightSpaceMatrix, -currentLightPos, 75.0f);
     }
 }
 //**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//
\ No newline at end of file
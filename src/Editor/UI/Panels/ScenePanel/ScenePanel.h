@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <string>
+#include <glm/vec2.hpp>
 #include <glm/vec3.hpp>
 #include <glm/mat4x4.hpp>
 
@@ -15,6 +16,7 @@
 #include "Core/InputManager/InputManager.h"
 #include "Core/Math/Ray.h" // Include the Ray class
 #include "Editor/SelectionManager.h"
+#include "Engine/Render/Picking/ObjectPicker.h"
 
 class ScenePanel final : public Panel {
 public:
@@ -69,6 +71,13 @@ private:
     unsigned int m_TextureID = 0;
     unsigned int m_DepthRenderBuffer = 0;
 
+    // Object-ID attachment and asynchronous readback for click/hover picking
+    ObjectPicker m_ObjectPicker;
+    bool m_AwaitingGpuPick = false; // A click was sent to the GPU and its result has not arrived yet
+    void PickObjectAtMousePos();
+    void ApplyGpuPick(const PickResult& result);
+    [[nodiscard]] glm::ivec2 GetMouseFramebufferPixel() const;
+
     //**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//
     //shadowMap properties
     unsigned int m_ShadowMapFBO = 0;
@@ -87,6 +96,13 @@ private:
     // Selection properties
     std::shared_ptr<GameObject> m_SelectedObject = nullptr;
 
+    // Marquee (rectangle) selection
+    bool m_MarqueePending = false; // Left button went down in the panel, not on the gizmo
+    bool m_MarqueeActive = false;  // Mouse moved far enough to count as a drag
+    glm::vec2 m_MarqueeStart = glm::vec2(0.0f);
+    void UpdateMarqueeSelection();
+    void SelectObjectsInRect(const glm::vec2& cornerA, const glm::vec2& cornerB, bool additive);
+
     // ImGuizmo implementation
     void DrawGuizmo();
     static void CustomizeImGuizmoStyle();
@@ -102,6 +118,7 @@ private:
     void UpdateCursor();
     std::shared_ptr<GameObject> FindObjectUnderMouse(const Math::Ray& ray);
     void HighlightSelectedObject();
+    std::vector<uint32_t> m_SelectedIDs; // Scratch for HighlightSelectedObject, sorted
 
     //**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//
     void InitializeShadowMap();
@@ -0,0 +1,12 @@
+#include "CellComponent.h"
+#include "TransformComponent.h"
+#include "../Entity/GameObject.h"
+
+Math::AABB CellComponent::GetWorldBounds() const {
+    if (!owner) return m_LocalBounds;
+
+    const auto transform = owner->GetComponent<TransformComponent>();
+    if (!transform) return m_LocalBounds;
+
+    return Math::TransformedAABB(m_LocalBounds, transform->GetModelMatrix()).GetWorldAABB();
+}
@@ -0,0 +1,33 @@
+#ifndef CELL_COMPONENT_H
+#define CELL_COMPONENT_H
+
+#include "BaseComponent.h"
+#include "Core/Math/BoundingVolume.h"
+#include <string>
+
+/**
+ * @brief Marks a room for portal culling; objects whose center is inside only draw while the room is visible
+ */
+class CellComponent final : public BaseComponent
+{
+public:
+    CellComponent() = default;
+    ~CellComponent() override = default;
+
+    // Hücre sınırları, sahibin yerel uzayında
+    void SetLocalBounds(const Math::AABB& bounds) { m_LocalBounds = bounds; }
+    [[nodiscard]] const Math::AABB& GetLocalBounds() const { return m_LocalBounds; }
+
+    /**
+     * @brief Local bounds moved through the owner's transform (axis-aligned box around the result)
+     */
+    [[nodiscard]] Math::AABB GetWorldBounds() const;
+
+    // Bileşen tipi bilgisi
+    [[nodiscard]] std::string GetTypeName() const override { return "CellComponent"; }
+
+private:
+    Math::AABB m_LocalBounds{glm::vec3(-0.5f), glm::vec3(0.5f)};
+};
+
+#endif // CELL_COMPONENT_H
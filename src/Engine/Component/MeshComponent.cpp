@@ -53,7 +53,10 @@ bool MeshComponent::LoadMesh(const std::string &path) {
         
         // Mark the bounding sphere as dirty since we have a new mesh
         m_boundingSphereDirty = true;
-        
+
+        // Sahneler çizim listelerinde mesh işaretçisini tutuyor
+        GameObject::MarkStructureChanged();
+
         return true;
     } catch ([[maybe_unused]] const std::exception &e) {
         m_isLoaded = false;
@@ -70,7 +73,10 @@ bool MeshComponent::SetMesh(const std::shared_ptr<Mesh>& mesh) {
         
         // Mark the bounding sphere as dirty since we have a new mesh
         m_boundingSphereDirty = true;
-        
+
+        // Sahneler çizim listelerinde mesh işaretçisini tutuyor
+        GameObject::MarkStructureChanged();
+
         return true;
     }
     m_isLoaded = false;
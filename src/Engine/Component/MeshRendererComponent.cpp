@@ -20,6 +20,12 @@ void MeshRendererComponent::OnDisable() {
     // Bileşen deaktif edildiğinde
 }
 
+void MeshRendererComponent::SetMaterial(const std::shared_ptr<Material>& material) {
+    m_material = material;
+    // Sahneler çizim listelerinde materyal işaretçisini tutuyor
+    GameObject::MarkStructureChanged();
+}
+
 void MeshRendererComponent::CacheComponents() {
     if (!owner) return;
 
@@ -40,20 +46,26 @@ void MeshRendererComponent::Draw() {
 
     const auto mesh = m_cachedMeshComponent->GetMesh();
     if (!mesh || !m_cachedTransform) return;
+    // Variant still compiling; Scene::DrawAll covers it with a fallback, this path just waits
+    if (const auto shader = m_material->GetShader(); shader && !shader->IsReady()) return;
 
     // Material'ı aktif et (shader'ı aktif eder ve varsa texture'u bağlar)
     m_material->Apply();
 
     // Material'ın shader'ı üzerinden uniform'ları güncelle
     if (auto shader = m_material->GetShader()) {
-        const glm::mat4 model = m_cachedTransform->GetModelMatrix();
-        shader->setMat4("model", model);
-        shader->setMat4("view", gViewMatrix);
-        shader->setMat4("projection", gProjectionMatrix);
+        const Shader::EngineUniforms& uniforms = shader->GetEngineUniforms();
+        // Positions may be stored quantized; the mesh's decode goes into the model matrix
+        const glm::mat4 model = m_cachedTransform->GetModelMatrix() * mesh->GetPositionDecode();
+        // Camera matrices come from the FrameData block of the current pass
+        shader->set(uniforms.model, model);
+        // Object-ID buffer for GPU picking (ignored by render targets without an ID attachment)
+        shader->set(uniforms.objectId, owner->GetInstanceID());
     }
 
-    // Mesh'i çiz
-    mesh->Draw();
+    // Mesh'i çiz; büyük mesh'lerde yalnızca görünen kümeler gönderilir
+    const glm::vec3 eye(glm::inverse(gViewMatrix)[3]);
+    mesh->Draw(gProjectionMatrix * gViewMatrix, m_cachedTransform->GetModelMatrix(), eye);
 }
 
 //**//**//**//**//**//**//**//**//**//**//**//**//
@@ -76,8 +88,8 @@ void MeshRendererComponent::Draw2ShadowMap() {
 
     // Material'ın shader'ı üzerinden uniform'ları güncelle
     if (auto shader = m_material->GetShadowMapShader()) {
-        const glm::mat4 model = m_cachedTransform->GetModelMatrix();
-        shader->setMat4("model", model);
+        const glm::mat4 model = m_cachedTransform->GetModelMatrix() * mesh->GetPositionDecode();
+        shader->set(shader->GetEngineUniforms().model, model);
     }
 
     // Mesh'i çiz
@@ -103,21 +115,19 @@ void MeshRendererComponent::DrawWireframe() {
 
     // Get the shader from material
     auto shader = m_material->GetShader();
-    if (!shader) return;
+    if (!shader || !shader->IsReady()) return;
 
     // Shader'ı aktif et
     shader->use();
 
     // Model matrisi
-    const glm::mat4 model = m_cachedTransform->GetModelMatrix();
-    shader->setMat4("model", model);
-
-    // Global kamera matrislerini uniform olarak ayarla
-    shader->setMat4("view", gViewMatrix);
-    shader->setMat4("projection", gProjectionMatrix);
+    const Shader::EngineUniforms& uniforms = shader->GetEngineUniforms();
+    const glm::mat4 model = m_cachedTransform->GetModelMatrix() * mesh->GetPositionDecode();
+    shader->set(uniforms.model, model);
+    // Kamera matrisleri FrameData bloğundan gelir
 
     // Set wireframe color (white outline)
-    shader->setVec4("color", glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));
+    shader->set(uniforms.color, glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));
 
     // Draw wireframe
     mesh->Draw();
@@ -26,7 +26,7 @@ public:
     [[nodiscard]] std::shared_ptr<Mesh> GetMesh() const;
     
     // Material setter/getter
-    void SetMaterial(const std::shared_ptr<Material>& material) { m_material = material; }
+    void SetMaterial(const std::shared_ptr<Material>& material);
     [[nodiscard]] std::shared_ptr<Material> GetMaterial() const { return m_material; }
 
     // BaseComponent overrides
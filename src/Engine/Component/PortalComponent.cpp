@@ -0,0 +1,23 @@
+#include "PortalComponent.h"
+#include "TransformComponent.h"
+#include "../Entity/GameObject.h"
+
+std::array<glm::vec3, 4> PortalComponent::GetWorldCorners() const {
+    const glm::vec2 half = m_Size * 0.5f;
+    std::array<glm::vec3, 4> corners = {
+        glm::vec3(-half.x, -half.y, 0.0f),
+        glm::vec3(half.x, -half.y, 0.0f),
+        glm::vec3(half.x, half.y, 0.0f),
+        glm::vec3(-half.x, half.y, 0.0f),
+    };
+
+    if (!owner) return corners;
+    const auto transform = owner->GetComponent<TransformComponent>();
+    if (!transform) return corners;
+
+    const glm::mat4 model = transform->GetModelMatrix();
+    for (glm::vec3& corner : corners) {
+        corner = glm::vec3(model * glm::vec4(corner, 1.0f));
+    }
+    return corners;
+}
@@ -0,0 +1,47 @@
+#ifndef PORTAL_COMPONENT_H
+#define PORTAL_COMPONENT_H
+
+#include "BaseComponent.h"
+#include <array>
+#include <memory>
+#include <string>
+#include <glm/glm.hpp>
+
+/**
+ * @brief An opening (door, window) between two cells
+ *
+ * The portal is a width x height rectangle in the owner's local XY plane,
+ * centered on its origin. Both cells are GameObjects with a CellComponent.
+ */
+class PortalComponent final : public BaseComponent
+{
+public:
+    PortalComponent() = default;
+    ~PortalComponent() override = default;
+
+    void SetSize(const glm::vec2& size) { m_Size = size; }
+    [[nodiscard]] const glm::vec2& GetSize() const { return m_Size; }
+
+    // Portalın bağladığı iki hücre
+    void SetCells(const std::shared_ptr<GameObject>& cellA, const std::shared_ptr<GameObject>& cellB) {
+        m_CellA = cellA;
+        m_CellB = cellB;
+    }
+    [[nodiscard]] std::shared_ptr<GameObject> GetCellA() const { return m_CellA.lock(); }
+    [[nodiscard]] std::shared_ptr<GameObject> GetCellB() const { return m_CellB.lock(); }
+
+    /**
+     * @brief Rectangle corners in world space, in winding order
+     */
+    [[nodiscard]] std::array<glm::vec3, 4> GetWorldCorners() const;
+
+    // Bileşen tipi bilgisi
+    [[nodiscard]] std::string GetTypeName() const override { return "PortalComponent"; }
+
+private:
+    glm::vec2 m_Size{1.0f, 2.0f};
+    std::weak_ptr<GameObject> m_CellA;
+    std::weak_ptr<GameObject> m_CellB;
+};
+
+#endif // PORTAL_COMPONENT_H
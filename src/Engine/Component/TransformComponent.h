@@ -2,6 +2,7 @@
 #define TRANSFORM_COMPONENT_H
 
 #include "BaseComponent.h"
+#include <cstdint>
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 
@@ -12,6 +13,7 @@ private:
     mutable glm::mat4 cachedModelMatrix = glm::mat4(1.0f);
     mutable bool matrixDirty = true;
     bool transformDirty = true; // Track any changes to transform properties
+    uint64_t version = 1;       // Bumped on every change; never cleared, unlike transformDirty
 
 public:
     glm::vec3 position {0.f, 0.f, 0.f};
@@ -27,12 +29,16 @@ public:
     
     // Clear dirty flag after consumers have updated
     void ClearTransformDirty() { transformDirty = false; }
+
+    // Change counter for caches that poll at their own pace (spatial grid, etc.)
+    [[nodiscard]] uint64_t GetVersion() const { return version; }
     
     // Position setter
     void SetPosition(const glm::vec3& newPosition) {
         position = newPosition;
         matrixDirty = true;
         transformDirty = true;
+        ++version;
         OnTransformChanged();
     }
 
@@ -41,6 +47,7 @@ public:
         rotation = newRotation;
         matrixDirty = true;
         transformDirty = true;
+        ++version;
         OnTransformChanged();
     }
 
@@ -49,6 +56,7 @@ public:
         scale = newScale;
         matrixDirty = true;
         transformDirty = true;
+        ++version;
         OnTransformChanged();
     }
 
@@ -71,6 +79,7 @@ public:
     void MarkDirty() {
         matrixDirty = true;
         transformDirty = true;
+        ++version;
     }
 
 private:
@@ -4,6 +4,18 @@
 #include "../Component/MeshComponent.h"
 #include "../Component/MeshRendererComponent.h"
 #include <iostream>
+#include <unordered_map>
+
+namespace {
+    // Live objects by instance id; objects are created and destroyed on the main thread
+    std::unordered_map<uint32_t, GameObject*>& GetInstanceRegistry() {
+        static std::unordered_map<uint32_t, GameObject*> registry;
+        return registry;
+    }
+
+    uint32_t s_NextInstanceID = 1; // 0 is reserved for "no object"
+    uint64_t s_StructureVersion = 1;
+}
 
 // Initialize GameObject with a default constructor that creates a default bounding box
 GameObject::GameObject() : name("GameObject"), isSelected(false), active(true) {
@@ -11,16 +23,47 @@ GameObject::GameObject() : name("GameObject"), isSelected(false), active(true) {
     Math::AABB localAABB(glm::vec3(-0.5f), glm::vec3(0.5f));
     m_BoundingBox.SetLocalAABB(localAABB);
     m_BoundingBoxDirty = true;
+
+    m_InstanceID = s_NextInstanceID++;
+    GetInstanceRegistry()[m_InstanceID] = this;
+}
+
+GameObject::~GameObject() {
+    GetInstanceRegistry().erase(m_InstanceID);
+    ++s_StructureVersion;
+}
+
+GameObject* GameObject::FindByInstanceID(const uint32_t instanceID) {
+    const auto& registry = GetInstanceRegistry();
+    const auto it = registry.find(instanceID);
+    return it != registry.end() ? it->second : nullptr;
+}
+
+uint64_t GameObject::GetStructureVersion() {
+    return s_StructureVersion;
+}
+
+void GameObject::MarkStructureChanged() {
+    ++s_StructureVersion;
+}
+
+void GameObject::SetStatic(const bool isStatic) {
+    if (m_IsStatic == isStatic) return;
+    m_IsStatic = isStatic;
+    ++s_StructureVersion;
 }
 
 void GameObject::Update(float deltaTime) {
     if (!active) return;
 
-    // Check if we need to update the bounding box
-    auto transform = GetComponent<TransformComponent>();
-    if (transform && transform->GetTransformDirty()) {
-        UpdateBoundingBox();
-        transform->ClearTransformDirty();
+    // Check if we need to update the bounding box; static objects only get edited
+    // through the transform setters, which update it themselves
+    if (!m_IsStatic || m_BoundingBoxDirty) {
+        auto transform = GetComponent<TransformComponent>();
+        if (transform && transform->GetTransformDirty()) {
+            UpdateBoundingBox();
+            transform->ClearTransformDirty();
+        }
     }
 
     for (const auto& comp : components) {
@@ -36,28 +79,41 @@ void GameObject::Update(float deltaTime) {
 void GameObject::Draw() {
     if (!active) return;
 
-    for (const auto& comp : components) {
-        comp->Draw();
-    }
+    DrawComponents();
 
     // Draw children recursively
     for (const auto& child : m_Children) {
         child->Draw();
     }
 }
-//**//**//**//**//**//**//**//**//**//**//**//**//**//**//
-void GameObject::Draw2ShadowMap() {
+
+void GameObject::DrawComponents() {
     if (!active) return;
 
     for (const auto& comp : components) {
-        comp->Draw2ShadowMap();
+        comp->Draw();
     }
+}
+
+//**//**//**//**//**//**//**//**//**//**//**//**//**//**//
+void GameObject::Draw2ShadowMap() {
+    if (!active) return;
+
+    DrawComponents2ShadowMap();
 
     // Draw children recursively
     for (const auto& child : m_Children) {
         child->Draw2ShadowMap();
     }
 }
+
+void GameObject::DrawComponents2ShadowMap() {
+    if (!active) return;
+
+    for (const auto& comp : components) {
+        comp->Draw2ShadowMap();
+    }
+}
 //**//**//**//**//**//**//**//**//**//**//**//**//**//**//
 
 void GameObject::DrawWireframe() {
@@ -95,6 +151,7 @@ void GameObject::AddChild(const std::shared_ptr<GameObject>& child) {
 
     // Bu nesnenin çocuk listesine ekle
     m_Children.push_back(child);
+    ++s_StructureVersion;
 }
 
 void GameObject::RemoveChild(const std::shared_ptr<GameObject>& child) {
@@ -107,6 +164,7 @@ void GameObject::RemoveChild(const std::shared_ptr<GameObject>& child) {
 
         // Listeden kaldır
         m_Children.erase(it);
+        ++s_StructureVersion;
     }
 }
 
@@ -123,6 +181,7 @@ void GameObject::SetParent(const std::shared_ptr<GameObject>& parent) {
 
     // Yeni parent'ı ayarla
     m_Parent = parent;
+    ++s_StructureVersion;
 
     // Eğer yeni bir parent varsa kendimizi onun çocuklarına ekle
     if (parent) {
@@ -142,6 +201,7 @@ void GameObject::SetParent(const std::shared_ptr<GameObject>& parent) {
 
 void GameObject::SetActive(bool isActive) {
     active = isActive;
+    ++s_StructureVersion;
 
     // Çocukları da aktif/pasif hale getir
     for (const auto& child : m_Children) {
@@ -190,6 +250,9 @@ void GameObject::UpdateBoundingBox() {
     // Update the transform of the bounding box
     m_BoundingBox.UpdateTransform(worldTransform);
     m_BoundingBoxDirty = false;
+
+    // A static object only gets here on its first update or an edit; scenes rebuild their static tree
+    if (m_IsStatic) ++s_StructureVersion;
 }
 
 bool GameObject::IntersectsRay(const Math::Ray& ray, float& t) const {
@@ -6,6 +6,7 @@
 #include <string>
 #include <algorithm>
 #include <type_traits>
+#include <cstdint>
 #include "Engine/Component/BaseComponent.h"
 #include "Core/Math/BoundingVolume.h" // Added for TransformedAABB
 #include "Core/Math/Ray.h"            // Added for Ray
@@ -15,6 +16,8 @@ public:
     std::string name;
     bool isSelected = false;
     bool active = true;
+    bool isOccluder = false; // Rasterized into the occlusion buffer; meant for large, solid meshes
+    uint32_t layer = 0;      // 0..31, matched against Scene::Raycast layer masks
     std::vector<std::shared_ptr<BaseComponent> > components;
 
     // Use the public name property consistently
@@ -22,7 +25,43 @@ public:
     void SetName(const std::string &newName) { name = newName; }
 
     GameObject(); // Non-default constructor
-    ~GameObject() = default;
+    ~GameObject();
+
+    /**
+     * @brief Unique non-zero id for the object's lifetime (0 means "no object")
+     *
+     * Written into the scene view's object-ID buffer for GPU picking.
+     */
+    [[nodiscard]] uint32_t GetInstanceID() const { return m_InstanceID; }
+
+    // Single-bit mask for this object's layer
+    [[nodiscard]] uint32_t GetLayerMask() const { return 1u << (layer & 31u); }
+
+    /**
+     * @brief Look up a live object by instance id, nullptr if it no longer exists
+     */
+    static GameObject* FindByInstanceID(uint32_t instanceID);
+
+    /**
+     * @brief Static objects never move at runtime
+     *
+     * Update skips their transform check, and Scene keeps them in a prebuilt BVH
+     * that is only rebuilt when one of them is edited.
+     */
+    [[nodiscard]] bool IsStatic() const { return m_IsStatic; }
+    void SetStatic(bool isStatic);
+
+    /**
+     * @brief Bumped on any change that invalidates a scene's static/dynamic split
+     *
+     * Covers hierarchy edits, SetActive, SetStatic, destruction, adding or
+     * removing components, mesh and material swaps and bounds updates of
+     * static objects. Moving dynamic objects leaves it unchanged.
+     */
+    static uint64_t GetStructureVersion();
+
+    // Bump the structure version; for components whose changes scenes cache (mesh, material)
+    static void MarkStructureChanged();
 
     void SetParent(const std::shared_ptr<GameObject>& parent);
 
@@ -35,6 +74,7 @@ public:
         auto newComponent = std::make_shared<T>();
         newComponent->owner = shared_from_this();
         components.push_back(newComponent); // Use components instead of m_components
+        MarkStructureChanged();
 
         // Initialize component
         newComponent->Start();
@@ -67,6 +107,7 @@ public:
 
         if (it != components.end()) {
             components.erase(it);
+            MarkStructureChanged();
             return true;
         }
         return false;
@@ -84,8 +125,12 @@ public:
 
     void Update(float deltaTime);
     void Draw();
+    // Draws only this object's components, without recursing into children
+    void DrawComponents();
     //**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//
     void Draw2ShadowMap(); // Added declaration for Draw2ShadowMap method
+    // Shadow pass counterpart of DrawComponents
+    void DrawComponents2ShadowMap();
     //**//**//**//**//**//**//**//**//**//**//**//**//**//
     void DrawWireframe();  // Added declaration for DrawWireframe method
 
@@ -119,6 +164,8 @@ private:
     std::weak_ptr<GameObject> m_Parent; // Weak reference to avoid circular dependencies
     Math::TransformedAABB m_BoundingBox; // The transformed bounding box for this object
     bool m_BoundingBoxDirty = true;     // Flag indicating if the bounding box needs updating
+    bool m_IsStatic = false;
+    uint32_t m_InstanceID = 0;
 };
 
 #endif
@@ -0,0 +1,64 @@
+#include "FrustumCuller.h"
+#include "Core/JobSystem/JobSystem.h"
+#include <algorithm>
+
+void FrustumCuller::Cull(const Spatial::BoundsSoA& bounds, const Math::Frustum& frustum,
+                         std::vector<uint32_t>& outVisible) {
+    outVisible.clear();
+    const auto count = static_cast<uint32_t>(bounds.Size());
+    CullRange(bounds, frustum, 0, count, outVisible);
+
+    m_Stats.total = count;
+    m_Stats.visible = static_cast<uint32_t>(outVisible.size());
+    m_Stats.culled = m_Stats.total - m_Stats.visible;
+}
+
+void FrustumCuller::Cull(const Spatial::BoundsSoA& bounds, const Spatial::Bvh& staticTree,
+                         const Spatial::Bvh& dynamicTree, const Math::Frustum& frustum,
+                         std::vector<uint32_t>& outVisible) {
+    outVisible.clear();
+    staticTree.CullFrustum(bounds, frustum, outVisible);
+    if (!dynamicTree.Empty() && dynamicTree.GetEnd() - dynamicTree.GetBegin() >= kParallelThreshold) {
+        CullRange(bounds, frustum, dynamicTree.GetBegin(), dynamicTree.GetEnd(), outVisible);
+    } else {
+        dynamicTree.CullFrustum(bounds, frustum, outVisible);
+    }
+
+    m_Stats.total = static_cast<uint32_t>(bounds.Size());
+    m_Stats.visible = static_cast<uint32_t>(outVisible.size());
+    m_Stats.culled = m_Stats.total - m_Stats.visible;
+}
+
+void FrustumCuller::CullRange(const Spatial::BoundsSoA& bounds, const Math::Frustum& frustum, const uint32_t begin,
+                              const uint32_t end, std::vector<uint32_t>& outVisible) {
+    const uint32_t count = end - begin;
+    if (count < kParallelThreshold) {
+        outVisible.reserve(outVisible.size() + count);
+        bounds.CullFrustum(frustum, begin, end, outVisible);
+        return;
+    }
+
+    const size_t chunkCount = JobSystem::GetChunkCount(count, kChunkSize);
+    if (m_ChunkResults.size() < chunkCount) {
+        m_ChunkResults.resize(chunkCount);
+    }
+    // ParallelFor may fall back to a single inline call covering every chunk
+    for (size_t chunk = 0; chunk < chunkCount; ++chunk) {
+        m_ChunkResults[chunk].clear();
+    }
+
+    JobSystem::Get().ParallelFor(count, kChunkSize, [&](const size_t chunkBegin, const size_t chunkEnd) {
+        auto& chunkVisible = m_ChunkResults[chunkBegin / kChunkSize];
+        bounds.CullFrustum(frustum, begin + static_cast<uint32_t>(chunkBegin), begin + static_cast<uint32_t>(chunkEnd),
+                           chunkVisible);
+    });
+
+    size_t visibleCount = outVisible.size();
+    for (size_t chunk = 0; chunk < chunkCount; ++chunk) {
+        visibleCount += m_ChunkResults[chunk].size();
+    }
+    outVisible.reserve(visibleCount);
+    for (size_t chunk = 0; chunk < chunkCount; ++chunk) {
+        outVisible.insert(outVisible.end(), m_ChunkResults[chunk].begin(), m_ChunkResults[chunk].end());
+    }
+}
@@ -0,0 +1,63 @@
+#ifndef FRUSTUM_CULLER_H
+#define FRUSTUM_CULLER_H
+
+#include <cstdint>
+#include <vector>
+#include "Core/Math/Frustum.h"
+#include "Engine/Spatial/BoundsSoA.h"
+#include "Engine/Spatial/Bvh.h"
+
+/**
+ * @brief Per-frame culling counters
+ */
+struct CullingStats {
+    uint32_t total = 0;
+    uint32_t visible = 0;
+    uint32_t culled = 0;
+};
+
+/**
+ * @brief Produces a compact list of visible indices from SoA bounds
+ *
+ * Large inputs are split into chunks that run on the JobSystem; each chunk
+ * writes into its own buffer and the buffers are concatenated in order, so the
+ * result is identical to the single-threaded pass.
+ */
+class FrustumCuller {
+public:
+    // Boxes per job chunk, and the input size below which everything runs inline
+    static constexpr uint32_t kChunkSize = 2048;
+    static constexpr uint32_t kParallelThreshold = 8192;
+
+    /**
+     * @brief Cull bounds against the frustum and write the visible indices
+     *
+     * @param bounds World-space bounds to test
+     * @param frustum Camera (or light) frustum
+     * @param outVisible Cleared and filled with ascending visible indices
+     */
+    void Cull(const Spatial::BoundsSoA& bounds, const Math::Frustum& frustum, std::vector<uint32_t>& outVisible);
+
+    /**
+     * @brief Same result as the linear Cull, but walks a static and a dynamic tree
+     *
+     * The trees must cover consecutive slot ranges of bounds, static first, so
+     * the visible indices come out ascending. A dynamic range of at least
+     * kParallelThreshold boxes skips its (refitted, looser) tree and takes the
+     * chunked linear pass instead.
+     */
+    void Cull(const Spatial::BoundsSoA& bounds, const Spatial::Bvh& staticTree, const Spatial::Bvh& dynamicTree,
+              const Math::Frustum& frustum, std::vector<uint32_t>& outVisible);
+
+    [[nodiscard]] const CullingStats& GetStats() const { return m_Stats; }
+
+private:
+    // Append the visible indices of bounds[begin, end), in chunks on the JobSystem when the range is large
+    void CullRange(const Spatial::BoundsSoA& bounds, const Math::Frustum& frustum, uint32_t begin, uint32_t end,
+                   std::vector<uint32_t>& outVisible);
+
+    std::vector<std::vector<uint32_t>> m_ChunkResults; // Reused between frames
+    CullingStats m_Stats;
+};
+
+#endif // FRUSTUM_CULLER_H
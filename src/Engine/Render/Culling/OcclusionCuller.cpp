@@ -0,0 +1,299 @@
+#include "OcclusionCuller.h"
+#include "Core/JobSystem/JobSystem.h"
+#include "Core/Math/Simd.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+    // Boxes per job when testing; each test touches only a handful of tiles
+    constexpr size_t kTestGrain = 128;
+
+    int RoundUpToTile(const int value) {
+        const int tile = OcclusionCuller::kTileSize;
+        return std::max(tile, (value + tile - 1) / tile * tile);
+    }
+}
+
+OcclusionCuller::OcclusionCuller() {
+    SetResolution(kDefaultWidth, kDefaultHeight);
+}
+
+void OcclusionCuller::SetResolution(const int width, const int height) {
+    // Multiples of the tile size also keep every row a multiple of 4 floats for SSE
+    m_Width = RoundUpToTile(width);
+    m_Height = RoundUpToTile(height);
+    m_TilesX = m_Width / kTileSize;
+    m_TilesY = m_Height / kTileSize;
+
+    m_Depth.assign(static_cast<size_t>(m_Width) * m_Height, 1.0f);
+    m_TileMaxDepth.assign(static_cast<size_t>(m_TilesX) * m_TilesY, 1.0f);
+    m_Rasterized = false;
+}
+
+void OcclusionCuller::BeginFrame(const glm::mat4& viewProjection) {
+    m_ViewProjection = viewProjection;
+    std::fill(m_Depth.begin(), m_Depth.end(), 1.0f);
+    std::fill(m_TileMaxDepth.begin(), m_TileMaxDepth.end(), 1.0f);
+    m_Triangles.clear();
+    m_Rasterized = false;
+    m_Stats = OcclusionStats{};
+}
+
+void OcclusionCuller::AddOccluder(const float* positions, const size_t vertexCount, const size_t strideBytes,
+                                  const uint32_t* indices, const size_t indexCount, const glm::mat4& modelMatrix) {
+    if (!positions || !indices || vertexCount == 0 || indexCount < 3) return;
+
+    const glm::mat4 modelViewProjection = m_ViewProjection * modelMatrix;
+    const auto* bytes = reinterpret_cast<const unsigned char*>(positions);
+
+    m_ClipVertices.resize(vertexCount);
+    for (size_t i = 0; i < vertexCount; ++i) {
+        const auto* p = reinterpret_cast<const float*>(bytes + i * strideBytes);
+        m_ClipVertices[i] = modelViewProjection * glm::vec4(p[0], p[1], p[2], 1.0f);
+    }
+
+    for (size_t i = 0; i + 2 < indexCount; i += 3) {
+        if (indices[i] >= vertexCount || indices[i + 1] >= vertexCount || indices[i + 2] >= vertexCount) continue;
+        ClipAndSetupTriangle(m_ClipVertices[indices[i]], m_ClipVertices[indices[i + 1]],
+                             m_ClipVertices[indices[i + 2]]);
+    }
+
+    ++m_Stats.occluders;
+}
+
+void OcclusionCuller::ClipAndSetupTriangle(const glm::vec4& c0, const glm::vec4& c1, const glm::vec4& c2) {
+    // Only the near plane (z >= -w) needs clipping; x/y are clamped to the screen
+    // during setup and depth beyond the far plane never wins the min test
+    const glm::vec4 in[3] = {c0, c1, c2};
+    const float d[3] = {c0.z + c0.w, c1.z + c1.w, c2.z + c2.w};
+
+    if (d[0] >= 0.0f && d[1] >= 0.0f && d[2] >= 0.0f) {
+        SetupTriangle(c0, c1, c2);
+        return;
+    }
+    if (d[0] < 0.0f && d[1] < 0.0f && d[2] < 0.0f) return;
+
+    glm::vec4 out[4];
+    int outCount = 0;
+    for (int i = 0; i < 3; ++i) {
+        const int j = (i + 1) % 3;
+        if (d[i] >= 0.0f) out[outCount++] = in[i];
+        if ((d[i] >= 0.0f) != (d[j] >= 0.0f)) {
+            const float t = d[i] / (d[i] - d[j]);
+            out[outCount++] = in[i] + (in[j] - in[i]) * t;
+        }
+    }
+
+    for (int i = 1; i + 1 < outCount; ++i) {
+        SetupTriangle(out[0], out[i], out[i + 1]);
+    }
+}
+
+void OcclusionCuller::SetupTriangle(const glm::vec4& c0, const glm::vec4& c1, const glm::vec4& c2) {
+    const auto toScreen = [this](const glm::vec4& clip) {
+        const float invW = 1.0f / clip.w;
+        return glm::vec3((clip.x * invW * 0.5f + 0.5f) * static_cast<float>(m_Width),
+                         (clip.y * invW * 0.5f + 0.5f) * static_cast<float>(m_Height),
+                         clip.z * invW * 0.5f + 0.5f);
+    };
+
+    glm::vec3 v[3] = {toScreen(c0), toScreen(c1), toScreen(c2)};
+
+    float area = (v[1].x - v[0].x) * (v[2].y - v[0].y) - (v[1].y - v[0].y) * (v[2].x - v[0].x);
+    if (std::abs(area) < 1e-8f) return;
+    // Occluders are rasterized double-sided; flip clockwise triangles to counter-clockwise
+    if (area < 0.0f) {
+        std::swap(v[1], v[2]);
+        area = -area;
+    }
+
+    TriangleSetup tri{};
+    tri.minX = std::max(0, static_cast<int>(std::floor(std::min({v[0].x, v[1].x, v[2].x}))));
+    tri.maxX = std::min(m_Width - 1, static_cast<int>(std::floor(std::max({v[0].x, v[1].x, v[2].x}))));
+    tri.minY = std::max(0, static_cast<int>(std::floor(std::min({v[0].y, v[1].y, v[2].y}))));
+    tri.maxY = std::min(m_Height - 1, static_cast<int>(std::floor(std::max({v[0].y, v[1].y, v[2].y}))));
+    if (tri.minX > tri.maxX || tri.minY > tri.maxY) return;
+
+    // Edge i is opposite vertex i, so its value divided by area is vertex i's barycentric weight
+    const float invArea = 1.0f / area;
+    tri.depthA = tri.depthB = tri.depthC = 0.0f;
+    for (int i = 0; i < 3; ++i) {
+        const glm::vec3& a = v[(i + 1) % 3];
+        const glm::vec3& b = v[(i + 2) % 3];
+        tri.edgeA[i] = a.y - b.y;
+        tri.edgeB[i] = b.x - a.x;
+        tri.edgeC[i] = (b.y - a.y) * a.x - (b.x - a.x) * a.y;
+
+        tri.depthA += tri.edgeA[i] * v[i].z * invArea;
+        tri.depthB += tri.edgeB[i] * v[i].z * invArea;
+        tri.depthC += tri.edgeC[i] * v[i].z * invArea;
+    }
+
+    m_Triangles.push_back(tri);
+}
+
+void OcclusionCuller::Rasterize() {
+    m_Stats.triangles = static_cast<uint32_t>(m_Triangles.size());
+
+    if (!m_Triangles.empty()) {
+        // One tile row per job: rows never overlap, so workers need no locking
+        JobSystem::Get().ParallelFor(static_cast<size_t>(m_TilesY), 1, [this](const size_t begin, const size_t end) {
+            for (size_t tileRow = begin; tileRow < end; ++tileRow) {
+                RasterizeTileRow(static_cast<int>(tileRow));
+            }
+        });
+    }
+
+    m_Rasterized = true;
+}
+
+void OcclusionCuller::RasterizeTileRow(const int tileRow) {
+    const int rowBegin = tileRow * kTileSize;
+    const int rowEnd = rowBegin + kTileSize;
+
+    for (const TriangleSetup& tri : m_Triangles) {
+        if (tri.maxY < rowBegin || tri.minY >= rowEnd) continue;
+        RasterizeTriangleRows(tri, rowBegin, rowEnd);
+    }
+
+    // Refresh the tile max depths of this row
+    for (int tileX = 0; tileX < m_TilesX; ++tileX) {
+        float maxDepth = 0.0f;
+        for (int y = rowBegin; y < rowEnd; ++y) {
+            const float* row = &m_Depth[static_cast<size_t>(y) * m_Width + tileX * kTileSize];
+            for (int x = 0; x < kTileSize; ++x) {
+                maxDepth = std::max(maxDepth, row[x]);
+            }
+        }
+        m_TileMaxDepth[static_cast<size_t>(tileRow) * m_TilesX + tileX] = maxDepth;
+    }
+}
+
+void OcclusionCuller::RasterizeTriangleRows(const TriangleSetup& tri, const int rowBegin, const int rowEnd) {
+    const int yBegin = std::max(rowBegin, tri.minY);
+    const int yEnd = std::min(rowEnd - 1, tri.maxY);
+    const int xBegin = tri.minX & ~3; // Rows are multiples of 4 floats, so aligned groups never overrun
+
+#if BLACK_SIMD_SSE
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 laneOffset = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f); // Pixel centers
+    const __m128 a0 = _mm_set1_ps(tri.edgeA[0]);
+    const __m128 a1 = _mm_set1_ps(tri.edgeA[1]);
+    const __m128 a2 = _mm_set1_ps(tri.edgeA[2]);
+    const __m128 depthA = _mm_set1_ps(tri.depthA);
+#endif
+
+    for (int y = yBegin; y <= yEnd; ++y) {
+        const float py = static_cast<float>(y) + 0.5f;
+        const float rowEdge0 = tri.edgeB[0] * py + tri.edgeC[0];
+        const float rowEdge1 = tri.edgeB[1] * py + tri.edgeC[1];
+        const float rowEdge2 = tri.edgeB[2] * py + tri.edgeC[2];
+        const float rowDepth = tri.depthB * py + tri.depthC;
+        float* depthRow = &m_Depth[static_cast<size_t>(y) * m_Width];
+
+#if BLACK_SIMD_SSE
+        const __m128 rowE0 = _mm_set1_ps(rowEdge0);
+        const __m128 rowE1 = _mm_set1_ps(rowEdge1);
+        const __m128 rowE2 = _mm_set1_ps(rowEdge2);
+        const __m128 rowZ = _mm_set1_ps(rowDepth);
+
+        for (int x = xBegin; x <= tri.maxX; x += 4) {
+            const __m128 px = _mm_add_ps(_mm_set1_ps(static_cast<float>(x)), laneOffset);
+            const __m128 e0 = _mm_add_ps(_mm_mul_ps(a0, px), rowE0);
+            const __m128 e1 = _mm_add_ps(_mm_mul_ps(a1, px), rowE1);
+            const __m128 e2 = _mm_add_ps(_mm_mul_ps(a2, px), rowE2);
+            const __m128 inside = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(e0, zero), _mm_cmpge_ps(e1, zero)),
+                                             _mm_cmpge_ps(e2, zero));
+            if (_mm_movemask_ps(inside) == 0) continue;
+
+            const __m128 depth = _mm_add_ps(_mm_mul_ps(depthA, px), rowZ);
+            const __m128 current = _mm_loadu_ps(depthRow + x);
+            const __m128 nearer = _mm_min_ps(current, depth);
+            _mm_storeu_ps(depthRow + x, _mm_or_ps(_mm_and_ps(inside, nearer), _mm_andnot_ps(inside, current)));
+        }
+#else
+        for (int x = xBegin; x <= tri.maxX; ++x) {
+            const float px = static_cast<float>(x) + 0.5f;
+            if (tri.edgeA[0] * px + rowEdge0 < 0.0f ||
+                tri.edgeA[1] * px + rowEdge1 < 0.0f ||
+                tri.edgeA[2] * px + rowEdge2 < 0.0f) continue;
+
+            const float depth = tri.depthA * px + rowDepth;
+            depthRow[x] = std::min(depthRow[x], depth);
+        }
+#endif
+    }
+}
+
+bool OcclusionCuller::IsVisible(const glm::vec3& center, const glm::vec3& extents) const {
+    if (!m_Rasterized || m_Triangles.empty()) return true;
+
+    glm::vec2 ndcMin(std::numeric_limits<float>::max());
+    glm::vec2 ndcMax(std::numeric_limits<float>::lowest());
+    float nearestDepth = std::numeric_limits<float>::max();
+
+    for (int corner = 0; corner < 8; ++corner) {
+        const glm::vec3 sign((corner & 1) ? 1.0f : -1.0f, (corner & 2) ? 1.0f : -1.0f, (corner & 4) ? 1.0f : -1.0f);
+        const glm::vec4 clip = m_ViewProjection * glm::vec4(center + sign * extents, 1.0f);
+
+        // Boxes crossing the near plane cover the camera; never hide them
+        if (clip.w <= 1e-5f || clip.z < -clip.w) return true;
+
+        const float invW = 1.0f / clip.w;
+        ndcMin = glm::min(ndcMin, glm::vec2(clip.x, clip.y) * invW);
+        ndcMax = glm::max(ndcMax, glm::vec2(clip.x, clip.y) * invW);
+        nearestDepth = std::min(nearestDepth, clip.z * invW * 0.5f + 0.5f);
+    }
+    nearestDepth -= kDepthBias;
+
+    const int x0 = std::max(0, static_cast<int>(std::floor((ndcMin.x * 0.5f + 0.5f) * static_cast<float>(m_Width))));
+    const int x1 = std::min(m_Width - 1, static_cast<int>(std::floor((ndcMax.x * 0.5f + 0.5f) * static_cast<float>(m_Width))));
+    const int y0 = std::max(0, static_cast<int>(std::floor((ndcMin.y * 0.5f + 0.5f) * static_cast<float>(m_Height))));
+    const int y1 = std::min(m_Height - 1, static_cast<int>(std::floor((ndcMax.y * 0.5f + 0.5f) * static_cast<float>(m_Height))));
+    // Off screen: that is the frustum culler's call, not ours
+    if (x0 > x1 || y0 > y1) return true;
+
+    for (int tileY = y0 / kTileSize; tileY <= y1 / kTileSize; ++tileY) {
+        for (int tileX = x0 / kTileSize; tileX <= x1 / kTileSize; ++tileX) {
+            // Whole tile is nearer than the box
+            if (m_TileMaxDepth[static_cast<size_t>(tileY) * m_TilesX + tileX] < nearestDepth) continue;
+
+            const int px0 = std::max(x0, tileX * kTileSize);
+            const int px1 = std::min(x1, tileX * kTileSize + kTileSize - 1);
+            const int py0 = std::max(y0, tileY * kTileSize);
+            const int py1 = std::min(y1, tileY * kTileSize + kTileSize - 1);
+            for (int y = py0; y <= py1; ++y) {
+                const float* depthRow = &m_Depth[static_cast<size_t>(y) * m_Width];
+                for (int x = px0; x <= px1; ++x) {
+                    if (depthRow[x] >= nearestDepth) return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+void OcclusionCuller::Cull(const Spatial::BoundsSoA& bounds, std::vector<uint32_t>& inOutVisible) {
+    const size_t count = inOutVisible.size();
+    m_Stats.tested = static_cast<uint32_t>(count);
+    m_Stats.occluded = 0;
+    if (!m_Rasterized || m_Triangles.empty() || count == 0) return;
+
+    m_Visibility.resize(count);
+    JobSystem::Get().ParallelFor(count, kTestGrain, [&](const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const uint32_t index = inOutVisible[i];
+            m_Visibility[i] = IsVisible(bounds.GetCenter(index), bounds.GetExtents(index)) ? 1 : 0;
+        }
+    });
+
+    size_t kept = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (m_Visibility[i]) {
+            inOutVisible[kept++] = inOutVisible[i];
+        }
+    }
+    inOutVisible.resize(kept);
+    m_Stats.occluded = static_cast<uint32_t>(count - kept);
+}
@@ -0,0 +1,118 @@
+#ifndef OCCLUSION_CULLER_H
+#define OCCLUSION_CULLER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <glm/glm.hpp>
+#include "Core/Math/BoundingVolume.h"
+#include "Engine/Spatial/BoundsSoA.h"
+
+/**
+ * @brief Per-frame occlusion counters
+ */
+struct OcclusionStats {
+    uint32_t occluders = 0;
+    uint32_t triangles = 0; // Occluder triangles after near-plane clipping
+    uint32_t tested = 0;
+    uint32_t occluded = 0;
+};
+
+/**
+ * @brief CPU software occlusion culler
+ *
+ * A few large occluder meshes are rasterized into a small depth buffer, then
+ * object bounds are tested against it: a box is hidden when every pixel its
+ * screen rectangle touches already holds something nearer than the box's
+ * nearest point. Rasterization runs per tile row on the JobSystem and shades
+ * four pixels per SSE step. No GL calls, so it works headless.
+ *
+ * Usage per frame: BeginFrame, AddOccluder..., Rasterize, then IsVisible/Cull.
+ */
+class OcclusionCuller {
+public:
+    static constexpr int kDefaultWidth = 256;
+    static constexpr int kDefaultHeight = 128;
+    static constexpr int kTileSize = 8; // Tiles keep a max depth for early accept/reject
+    // A box is only hidden behind depth this much nearer than its nearest point; interpolated
+    // depth across a face-on occluder rounds around its own box's depth
+    static constexpr float kDepthBias = 1.0e-5f;
+
+    OcclusionCuller();
+
+    /**
+     * @brief Set the depth buffer size; both sides are rounded up to kTileSize
+     */
+    void SetResolution(int width, int height);
+
+    /**
+     * @brief Clear the depth buffer and drop last frame's occluders
+     */
+    void BeginFrame(const glm::mat4& viewProjection);
+
+    /**
+     * @brief Queue an indexed triangle mesh as occluder
+     *
+     * @param positions First vertex position (x, y, z floats)
+     * @param vertexCount Number of vertices
+     * @param strideBytes Distance between consecutive positions, e.g. sizeof(Vertex)
+     * @param indices Triangle list indices
+     * @param indexCount Number of indices (a multiple of 3)
+     * @param modelMatrix Object to world transform
+     */
+    void AddOccluder(const float* positions, size_t vertexCount, size_t strideBytes,
+                     const uint32_t* indices, size_t indexCount, const glm::mat4& modelMatrix);
+
+    /**
+     * @brief Rasterize every queued occluder into the depth buffer
+     */
+    void Rasterize();
+
+    /**
+     * @brief Whether a world-space box may be visible (always true before Rasterize)
+     */
+    [[nodiscard]] bool IsVisible(const glm::vec3& center, const glm::vec3& extents) const;
+    [[nodiscard]] bool IsVisible(const Math::AABB& aabb) const {
+        return IsVisible(aabb.GetCenter(), aabb.GetExtents());
+    }
+
+    /**
+     * @brief Remove occluded entries from a list of indices into bounds, keeping order
+     */
+    void Cull(const Spatial::BoundsSoA& bounds, std::vector<uint32_t>& inOutVisible);
+
+    [[nodiscard]] bool HasOccluders() const { return !m_Triangles.empty(); }
+    [[nodiscard]] int GetWidth() const { return m_Width; }
+    [[nodiscard]] int GetHeight() const { return m_Height; }
+    // Depth in [0, 1] (1 = far), row 0 is the bottom of the screen
+    [[nodiscard]] float GetDepth(const int x, const int y) const { return m_Depth[y * m_Width + x]; }
+    [[nodiscard]] const OcclusionStats& GetStats() const { return m_Stats; }
+
+private:
+    // Screen-space triangle in edge-function form, ready for the rasterizer
+    struct TriangleSetup {
+        float edgeA[3], edgeB[3], edgeC[3]; // Inside when A*x + B*y + C >= 0 for all edges
+        float depthA, depthB, depthC;       // depth = A*x + B*y + C
+        int minX, maxX, minY, maxY;
+    };
+
+    void SetupTriangle(const glm::vec4& c0, const glm::vec4& c1, const glm::vec4& c2);
+    void ClipAndSetupTriangle(const glm::vec4& c0, const glm::vec4& c1, const glm::vec4& c2);
+    void RasterizeTileRow(int tileRow);
+    void RasterizeTriangleRows(const TriangleSetup& tri, int rowBegin, int rowEnd);
+
+    glm::mat4 m_ViewProjection = glm::mat4(1.0f);
+    int m_Width = 0, m_Height = 0;
+    int m_TilesX = 0, m_TilesY = 0;
+
+    std::vector<float> m_Depth;
+    std::vector<float> m_TileMaxDepth;
+    std::vector<TriangleSetup> m_Triangles;
+    std::vector<glm::vec4> m_ClipVertices; // Scratch for AddOccluder
+    std::vector<uint8_t> m_Visibility; // Scratch for Cull, written by workers
+    bool m_Rasterized = false;
+
+    OcclusionStats m_Stats;
+};
+
+#endif // OCCLUSION_CULLER_H
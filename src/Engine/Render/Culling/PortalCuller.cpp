@@ -0,0 +1,191 @@
+#include "PortalCuller.h"
+#include <algorithm>
+#include <limits>
+
+namespace {
+    // Clipping a polygon against one plane adds at most one vertex
+    constexpr uint32_t kMaxClipVertices = PortalCuller::kMaxPortalVertices + Math::Frustum::kMaxPlanes;
+
+    // Closer to the portal plane than this, the eye is standing in the doorway
+    constexpr float kEyeOnPortalDistance = 0.01f;
+
+    // Sutherland-Hodgman against one plane; keeps the side the normal points to
+    uint32_t ClipPolygon(const glm::vec3* in, const uint32_t inCount, const Math::Plane& plane, glm::vec3* out) {
+        uint32_t outCount = 0;
+        for (uint32_t i = 0; i < inCount && outCount + 2 <= kMaxClipVertices; ++i) {
+            const glm::vec3& previous = in[(i + inCount - 1) % inCount];
+            const glm::vec3& current = in[i];
+            const float previousDistance = plane.GetSignedDistance(previous);
+            const float currentDistance = plane.GetSignedDistance(current);
+
+            if ((previousDistance >= 0.0f) != (currentDistance >= 0.0f)) {
+                const float t = previousDistance / (previousDistance - currentDistance);
+                out[outCount++] = previous + (current - previous) * t;
+            }
+            if (currentDistance >= 0.0f) {
+                out[outCount++] = current;
+            }
+        }
+        return outCount;
+    }
+
+    bool ContainsPoint(const Math::AABB& bounds, const glm::vec3& point) {
+        return point.x >= bounds.GetMin().x && point.y >= bounds.GetMin().y && point.z >= bounds.GetMin().z &&
+               point.x <= bounds.GetMax().x && point.y <= bounds.GetMax().y && point.z <= bounds.GetMax().z;
+    }
+}
+
+void PortalCuller::Clear() {
+    m_Cells.clear();
+    m_Portals.clear();
+    m_Visible.clear();
+}
+
+uint32_t PortalCuller::AddCell(const Math::AABB& bounds) {
+    const auto index = static_cast<uint32_t>(m_Cells.size());
+    m_Cells.push_back({bounds, {}});
+    return index;
+}
+
+void PortalCuller::AddPortal(const uint32_t cellA, const uint32_t cellB, const std::span<const glm::vec3> corners) {
+    if (cellA >= m_Cells.size() || cellB >= m_Cells.size() || cellA == cellB || corners.size() < 3) return;
+
+    Portal portal;
+    portal.cells[0] = cellA;
+    portal.cells[1] = cellB;
+    portal.cornerCount = static_cast<uint32_t>(std::min<size_t>(corners.size(), kMaxPortalVertices));
+    std::copy_n(corners.begin(), portal.cornerCount, portal.corners);
+
+    const auto index = static_cast<uint32_t>(m_Portals.size());
+    m_Portals.push_back(portal);
+    m_Cells[cellA].portals.push_back(index);
+    m_Cells[cellB].portals.push_back(index);
+}
+
+uint32_t PortalCuller::FindCell(const glm::vec3& point) const {
+    // Smallest first, so a cell nested inside a larger one wins
+    uint32_t best = kNoCell;
+    float bestVolume = std::numeric_limits<float>::max();
+    for (uint32_t i = 0; i < m_Cells.size(); ++i) {
+        const Math::AABB& bounds = m_Cells[i].bounds;
+        if (!ContainsPoint(bounds, point)) continue;
+
+        const glm::vec3 size = bounds.GetMax() - bounds.GetMin();
+        const float volume = size.x * size.y * size.z;
+        if (volume < bestVolume) {
+            bestVolume = volume;
+            best = i;
+        }
+    }
+    return best;
+}
+
+void PortalCuller::ComputeVisibility(const glm::vec3& eye, const Math::Frustum& frustum) {
+    m_Eye = eye;
+    m_HasFarPlane = frustum.GetPlaneCount() >= Math::Frustum::CameraPlaneCount;
+    if (m_HasFarPlane) {
+        m_FarPlane = frustum.GetPlane(Math::Frustum::Far);
+    }
+
+    m_Stats = {};
+    m_Stats.cells = static_cast<uint32_t>(m_Cells.size());
+    m_Visible.assign(m_Cells.size(), 0);
+
+    const uint32_t startCell = FindCell(eye);
+    if (startCell == kNoCell) {
+        std::fill(m_Visible.begin(), m_Visible.end(), 1);
+    } else {
+        VisitCell(startCell, frustum, 0);
+    }
+
+    m_Stats.visibleCells = static_cast<uint32_t>(std::count(m_Visible.begin(), m_Visible.end(), 1));
+}
+
+void PortalCuller::VisitCell(const uint32_t cell, const Math::Frustum& frustum, const uint32_t depth) {
+    m_Visible[cell] = 1;
+    if (depth >= kMaxDepth) return;
+
+    for (const uint32_t portalIndex : m_Cells[cell].portals) {
+        Portal& portal = m_Portals[portalIndex];
+        if (portal.onPath) continue;
+
+        Math::Frustum portalFrustum;
+        if (!BuildPortalFrustum(portal, frustum, portalFrustum)) continue;
+        ++m_Stats.portalsPassed;
+
+        const uint32_t nextCell = portal.cells[0] == cell ? portal.cells[1] : portal.cells[0];
+        portal.onPath = true;
+        VisitCell(nextCell, portalFrustum, depth + 1);
+        portal.onPath = false;
+    }
+}
+
+bool PortalCuller::BuildPortalFrustum(const Portal& portal, const Math::Frustum& frustum,
+                                      Math::Frustum& outFrustum) const {
+    glm::vec3 polygon[kMaxClipVertices];
+    glm::vec3 clipped[kMaxClipVertices];
+    uint32_t count = portal.cornerCount;
+    std::copy_n(portal.corners, count, polygon);
+
+    for (uint32_t p = 0; p < frustum.GetPlaneCount(); ++p) {
+        count = ClipPolygon(polygon, count, frustum.GetPlane(p), clipped);
+        if (count < 3) return false;
+        std::copy_n(clipped, count, polygon);
+    }
+
+    // Newell's method gives a stable normal for any convex polygon
+    glm::vec3 normal(0.0f);
+    glm::vec3 centroid(0.0f);
+    for (uint32_t i = 0; i < count; ++i) {
+        const glm::vec3& a = polygon[i];
+        const glm::vec3& b = polygon[(i + 1) % count];
+        normal += glm::vec3((a.y - b.y) * (a.z + b.z), (a.z - b.z) * (a.x + b.x), (a.x - b.x) * (a.y + b.y));
+        centroid += a;
+    }
+    centroid /= static_cast<float>(count);
+    const float normalLength = glm::length(normal);
+    if (normalLength <= std::numeric_limits<float>::epsilon()) return false;
+    normal /= normalLength;
+
+    // Standing in the doorway: the edge planes would be degenerate, keep the current frustum
+    const float eyeDistance = glm::dot(normal, m_Eye - centroid);
+    if (std::abs(eyeDistance) < kEyeOnPortalDistance) {
+        outFrustum = frustum;
+        return true;
+    }
+
+    // Near plane: the portal itself, facing away from the eye
+    if (eyeDistance > 0.0f) normal = -normal;
+    outFrustum.Clear();
+    outFrustum.AddPlane(Math::Plane(normal, -glm::dot(normal, centroid)));
+    if (m_HasFarPlane) {
+        outFrustum.AddPlane(m_FarPlane);
+    }
+
+    // One plane through the eye and each edge, facing the portal's centroid.
+    // Edges beyond kMaxPlanes are dropped, which only makes the frustum larger.
+    for (uint32_t i = 0; i < count; ++i) {
+        const glm::vec3 edgeNormal = glm::cross(polygon[i] - m_Eye, polygon[(i + 1) % count] - m_Eye);
+        const float length = glm::length(edgeNormal);
+        if (length <= std::numeric_limits<float>::epsilon()) continue;
+
+        glm::vec3 n = edgeNormal / length;
+        if (glm::dot(n, centroid - m_Eye) < 0.0f) n = -n;
+        outFrustum.AddPlane(Math::Plane(n, -glm::dot(n, m_Eye)));
+    }
+    return true;
+}
+
+void PortalCuller::Cull(const Spatial::BoundsSoA& bounds, std::vector<uint32_t>& ioIndices) {
+    if (m_Cells.empty()) {
+        m_Stats.culled = 0;
+        return;
+    }
+
+    const size_t before = ioIndices.size();
+    std::erase_if(ioIndices, [&](const uint32_t index) {
+        const uint32_t cell = FindCell(bounds.GetCenter(index));
+        return cell != kNoCell && !m_Visible[cell];
+    });
+    m_Stats.culled = static_cast<uint32_t>(before - ioIndices.size());
+}
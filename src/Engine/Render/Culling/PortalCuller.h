@@ -0,0 +1,108 @@
+#ifndef PORTAL_CULLER_H
+#define PORTAL_CULLER_H
+
+#include <cstdint>
+#include <span>
+#include <vector>
+#include <glm/glm.hpp>
+#include "Core/Math/Frustum.h"
+#include "Engine/Spatial/BoundsSoA.h"
+
+/**
+ * @brief Per-frame cell/portal counters
+ */
+struct PortalStats {
+    uint32_t cells = 0;
+    uint32_t visibleCells = 0;
+    uint32_t portalsPassed = 0; // Portals the view went through, counted once per path
+    uint32_t culled = 0;        // Objects dropped because their cell is not visible
+};
+
+/**
+ * @brief Cell and portal visibility for indoor scenes (CPU only, deterministic)
+ *
+ * Cells are world-space boxes (rooms); portals are convex polygons (doors,
+ * windows) connecting two cells. Starting in the cell that contains the eye,
+ * every portal is clipped against the current frustum, and whatever is left
+ * becomes a narrower frustum for the cell behind it. Cells reached this way
+ * are visible; objects whose bounds center lies in any other cell are culled.
+ *
+ * Objects outside every cell are never culled, and when the eye is outside
+ * every cell all cells count as visible.
+ */
+class PortalCuller {
+public:
+    static constexpr uint32_t kNoCell = 0xFFFFFFFFu;
+    static constexpr uint32_t kMaxDepth = 16;         // Portals along one path
+    static constexpr uint32_t kMaxPortalVertices = 8;
+
+    /**
+     * @brief Remove every cell and portal
+     */
+    void Clear();
+
+    /**
+     * @brief Add a cell and return its index
+     */
+    uint32_t AddCell(const Math::AABB& bounds);
+
+    /**
+     * @brief Connect two cells through a convex polygon (any winding, extra vertices ignored)
+     */
+    void AddPortal(uint32_t cellA, uint32_t cellB, std::span<const glm::vec3> corners);
+
+    [[nodiscard]] uint32_t GetCellCount() const { return static_cast<uint32_t>(m_Cells.size()); }
+
+    /**
+     * @brief Smallest cell containing the point, or kNoCell
+     */
+    [[nodiscard]] uint32_t FindCell(const glm::vec3& point) const;
+
+    /**
+     * @brief Flood visibility from the eye's cell through the portals in view
+     *
+     * @param eye Camera position the frustum was built from
+     * @param frustum Camera frustum; its far plane is kept in every portal frustum
+     */
+    void ComputeVisibility(const glm::vec3& eye, const Math::Frustum& frustum);
+
+    [[nodiscard]] bool IsCellVisible(uint32_t cell) const { return cell < m_Visible.size() && m_Visible[cell]; }
+
+    /**
+     * @brief Remove the indices whose bounds center lies in a cell that is not visible
+     *
+     * The relative order of the kept indices is unchanged.
+     */
+    void Cull(const Spatial::BoundsSoA& bounds, std::vector<uint32_t>& ioIndices);
+
+    [[nodiscard]] const PortalStats& GetStats() const { return m_Stats; }
+
+private:
+    struct Cell {
+        Math::AABB bounds;
+        std::vector<uint32_t> portals;
+    };
+
+    struct Portal {
+        uint32_t cells[2] = {kNoCell, kNoCell};
+        glm::vec3 corners[kMaxPortalVertices];
+        uint32_t cornerCount = 0;
+        bool onPath = false; // Set while the current recursion goes through this portal
+    };
+
+    void VisitCell(uint32_t cell, const Math::Frustum& frustum, uint32_t depth);
+
+    // Clip the portal against the frustum and build the frustum behind it; false if nothing is left
+    bool BuildPortalFrustum(const Portal& portal, const Math::Frustum& frustum, Math::Frustum& outFrustum) const;
+
+    std::vector<Cell> m_Cells;
+    std::vector<Portal> m_Portals;
+    std::vector<uint8_t> m_Visible;
+
+    glm::vec3 m_Eye{0.0f};
+    Math::Plane m_FarPlane;
+    bool m_HasFarPlane = false;
+    PortalStats m_Stats;
+};
+
+#endif // PORTAL_CULLER_H
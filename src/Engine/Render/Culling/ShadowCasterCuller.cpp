@@ -0,0 +1,66 @@
+#include "ShadowCasterCuller.h"
+#include "Core/JobSystem/JobSystem.h"
+#include <algorithm>
+#include <iterator>
+
+void ShadowCasterCuller::Cull(const Spatial::BoundsSoA& bounds, const Math::Frustum& lightFrustum,
+                              const Math::Frustum& cameraFrustum, const glm::vec3& lightDirection,
+                              const float shadowLength, std::vector<uint32_t>& outCasters) {
+    outCasters.clear();
+    const auto count = static_cast<uint32_t>(bounds.Size());
+    const size_t chunkCount = count < kParallelThreshold ? 1 : JobSystem::GetChunkCount(count, kChunkSize);
+
+    if (m_ChunkResults.size() < chunkCount) {
+        m_ChunkResults.resize(chunkCount);
+    }
+    for (size_t chunk = 0; chunk < chunkCount; ++chunk) {
+        m_ChunkResults[chunk].inLight.clear();
+        m_ChunkResults[chunk].reachesView.clear();
+        m_ChunkResults[chunk].casters.clear();
+    }
+
+    if (chunkCount == 1) {
+        CullRange(bounds, lightFrustum, cameraFrustum, lightDirection, shadowLength, 0, count, m_ChunkResults[0]);
+    } else {
+        JobSystem::Get().ParallelFor(count, kChunkSize, [&](const size_t begin, const size_t end) {
+            // An inline fallback hands over the whole range, so split it back into chunks here
+            for (size_t chunkBegin = begin; chunkBegin < end; chunkBegin += kChunkSize) {
+                const size_t chunkEnd = std::min(chunkBegin + kChunkSize, end);
+                CullRange(bounds, lightFrustum, cameraFrustum, lightDirection, shadowLength,
+                          static_cast<uint32_t>(chunkBegin), static_cast<uint32_t>(chunkEnd),
+                          m_ChunkResults[chunkBegin / kChunkSize]);
+            }
+        });
+    }
+
+    uint32_t inLight = 0;
+    size_t casterCount = 0;
+    for (size_t chunk = 0; chunk < chunkCount; ++chunk) {
+        inLight += static_cast<uint32_t>(m_ChunkResults[chunk].inLight.size());
+        casterCount += m_ChunkResults[chunk].casters.size();
+    }
+    outCasters.reserve(casterCount);
+    for (size_t chunk = 0; chunk < chunkCount; ++chunk) {
+        const auto& casters = m_ChunkResults[chunk].casters;
+        outCasters.insert(outCasters.end(), casters.begin(), casters.end());
+    }
+
+    m_Stats.total = count;
+    m_Stats.inLightFrustum = inLight;
+    m_Stats.casters = static_cast<uint32_t>(outCasters.size());
+}
+
+void ShadowCasterCuller::CullRange(const Spatial::BoundsSoA& bounds, const Math::Frustum& lightFrustum,
+                                   const Math::Frustum& cameraFrustum, const glm::vec3& lightDirection,
+                                   const float shadowLength, const uint32_t begin, const uint32_t end,
+                                   ChunkResult& result) const {
+    bounds.CullFrustum(lightFrustum, begin, end, result.inLight);
+    if (result.inLight.empty()) return;
+
+    bounds.CullSweptFrustum(cameraFrustum, lightDirection, shadowLength, begin, end, result.reachesView);
+
+    // Both lists are ascending
+    std::set_intersection(result.inLight.begin(), result.inLight.end(),
+                          result.reachesView.begin(), result.reachesView.end(),
+                          std::back_inserter(result.casters));
+}
@@ -0,0 +1,63 @@
+#ifndef SHADOW_CASTER_CULLER_H
+#define SHADOW_CASTER_CULLER_H
+
+#include <cstdint>
+#include <vector>
+#include <glm/glm.hpp>
+#include "Core/Math/Frustum.h"
+#include "Engine/Spatial/BoundsSoA.h"
+
+/**
+ * @brief Per-frame shadow caster counters
+ */
+struct ShadowCasterStats {
+    uint32_t total = 0;          // Objects considered
+    uint32_t inLightFrustum = 0; // Inside the light's shadow volume
+    uint32_t casters = 0;        // Also able to shadow something the camera sees
+};
+
+/**
+ * @brief Selects the objects that need to be rendered into a directional shadow map
+ *
+ * An object is a caster when its box touches the light frustum and its box swept
+ * along the light direction reaches the camera frustum. Objects outside the view
+ * that still throw a shadow into it are kept; objects whose shadow can never be
+ * seen are dropped. Runs chunked on the JobSystem like FrustumCuller.
+ */
+class ShadowCasterCuller {
+public:
+    static constexpr uint32_t kChunkSize = 2048;
+    static constexpr uint32_t kParallelThreshold = 8192;
+
+    /**
+     * @brief Write the ascending indices of every shadow caster
+     *
+     * @param bounds World-space bounds to test
+     * @param lightFrustum Frustum of the light-space (shadow) projection
+     * @param cameraFrustum Frustum of the viewing camera
+     * @param lightDirection Normalized direction the light travels in
+     * @param shadowLength How far a shadow can reach along lightDirection
+     * @param outCasters Cleared and filled with caster indices
+     */
+    void Cull(const Spatial::BoundsSoA& bounds, const Math::Frustum& lightFrustum,
+              const Math::Frustum& cameraFrustum, const glm::vec3& lightDirection, float shadowLength,
+              std::vector<uint32_t>& outCasters);
+
+    [[nodiscard]] const ShadowCasterStats& GetStats() const { return m_Stats; }
+
+private:
+    struct ChunkResult {
+        std::vector<uint32_t> inLight;
+        std::vector<uint32_t> reachesView;
+        std::vector<uint32_t> casters;
+    };
+
+    void CullRange(const Spatial::BoundsSoA& bounds, const Math::Frustum& lightFrustum,
+                   const Math::Frustum& cameraFrustum, const glm::vec3& lightDirection, float shadowLength,
+                   uint32_t begin, uint32_t end, ChunkResult& result) const;
+
+    std::vector<ChunkResult> m_ChunkResults; // Reused between frames
+    ShadowCasterStats m_Stats;
+};
+
+#endif // SHADOW_CASTER_CULLER_H
@@ -1,13 +1,15 @@
 #include "Material.h"
 #include "Engine/Render/Texture/Texture.h"
+#include "Engine/Render/Shader/ShaderLibrary.h"
+#include "Engine/Entity/GameObject.h"
 #include <glm/glm.hpp>
 #include <filesystem>
 #include <iostream>
-
-// Define static variable for camera position
-glm::vec3 Material::s_CameraPosition = glm::vec3(0.0f);
+#include <utility>
 
 Material::Material() {
+    m_blockIndex = MaterialBlockPool::GetInstance().Acquire(m_params);
+
     // Use direct path to the Black_Engine root directory
     std::filesystem::path projectRoot = "C:/Users/EREN/CLionProjects/Black_Engine";
     std::filesystem::path vertPath = projectRoot / "src" / "shaders" / "simple.vert";
@@ -15,10 +17,8 @@ Material::Material() {
     std::cout << "Loading shaders from: " << vertPath.string() << " and " << fragPath.string() << std::endl;
     
     try {
-        m_shader = std::make_shared<Shader>(
-            vertPath.string().c_str(),
-            fragPath.string().c_str()
-        );
+        // Every material starts with the same programs; each variant is compiled once
+        SetShaderVariants(vertPath.string(), fragPath.string());
     } 
     catch (const std::exception& e) {
         std::cerr << "Failed to load shader: " << e.what() << std::endl;
@@ -34,34 +34,131 @@ Material::Material() {
     std::filesystem::path texturePath = projectRoot / "src" / "Engine" / "Render" / "Texture" / "TextureImages" / "planksSpec.png";
     std::cout << "Loading texture from: " << texturePath.string() << std::endl;
     if (std::filesystem::exists(texturePath) && std::filesystem::file_size(texturePath) > 0) {
-        m_texture = std::make_shared<Texture>(
-            texturePath.string().c_str(),
-            GL_TEXTURE_2D, GL_TEXTURE0, GL_RGBA, GL_UNSIGNED_BYTE
-        );
+        // One texture for every default material, so their objects can share an instanced draw
+        static std::weak_ptr<Texture> s_DefaultTexture;
+        std::shared_ptr<Texture> texture = s_DefaultTexture.lock();
+        if (!texture) {
+            texture = std::make_shared<Texture>(texturePath.string().c_str(),
+                                                GL_TEXTURE_2D, GL_TEXTURE0, GL_RGBA, GL_UNSIGNED_BYTE);
+            s_DefaultTexture = texture;
+        }
+        // Picks the HAS_TEXTURE variant
+        SetTexture(texture);
     } else {
         std::cerr << "[Material] Texture file missing or empty: " << texturePath << std::endl;
         m_texture = nullptr;
     }
 }
 
-// Implement SetCameraPosition to update the static camera position
-void Material::SetCameraPosition(const glm::vec3& camPos) {
-    s_CameraPosition = camPos;
+Material::~Material() {
+    MaterialBlockPool::GetInstance().Release(m_blockIndex);
+}
+
+void Material::SetShader(const std::shared_ptr<Shader>& shader) {
+    m_shader = shader;
+    m_instancedShader.reset();
+    m_vertexPath.clear();
+    m_fragmentPath.clear();
+    m_instancedVertexPath.clear();
+    GameObject::MarkStructureChanged();
+}
+
+void Material::SetShadowMapShader(const std::shared_ptr<Shader>& shader) {
+    m_shadowMapShader = shader;
+    GameObject::MarkStructureChanged();
+}
+
+void Material::SetInstancedShader(const std::shared_ptr<Shader>& shader) {
+    m_instancedShader = shader;
+    m_instancedVertexPath.clear();
+    GameObject::MarkStructureChanged();
+}
+
+void Material::SetShaderVariants(const std::string& vertexPath, const std::string& fragmentPath,
+                                 const std::string& instancedVertexPath) {
+    // Resolve first: a missing file throws before the material changes
+    ShaderLibrary& library = ShaderLibrary::GetInstance();
+    const ShaderFeatures features = GetFeatures();
+    std::shared_ptr<Shader> shader = library.GetVariant(vertexPath, fragmentPath, features, ShaderCompileMode::Async);
+    std::shared_ptr<Shader> instancedShader;
+    if (!instancedVertexPath.empty()) {
+        instancedShader = library.GetVariant(instancedVertexPath, fragmentPath, features, ShaderCompileMode::Async);
+    }
+
+    m_vertexPath = vertexPath;
+    m_fragmentPath = fragmentPath;
+    m_instancedVertexPath = instancedVertexPath;
+    m_shader = std::move(shader);
+    m_instancedShader = std::move(instancedShader);
+    GameObject::MarkStructureChanged();
+}
+
+ShaderFeatures Material::GetFeatures() const {
+    ShaderFeatures features = ShaderFeature::None;
+    if (m_texture) features |= ShaderFeature::HasTexture;
+    if (m_receiveShadows) features |= ShaderFeature::ReceiveShadows;
+    if (m_params.specularStrength > 0.0f) features |= ShaderFeature::Specular;
+    return features;
+}
+
+void Material::SetReceiveShadows(const bool receiveShadows) {
+    if (m_receiveShadows == receiveShadows) return;
+    m_receiveShadows = receiveShadows;
+    UpdateVariants();
+}
+
+void Material::UpdateVariants() {
+    if (m_vertexPath.empty()) return;
+    ShaderLibrary& library = ShaderLibrary::GetInstance();
+    const ShaderFeatures features = GetFeatures();
+    // Async: a toggle in the inspector must not stall the frame; the scene draws a fallback meanwhile
+    m_shader = library.GetVariant(m_vertexPath, m_fragmentPath, features, ShaderCompileMode::Async);
+    if (!m_instancedVertexPath.empty()) {
+        m_instancedShader = library.GetVariant(m_instancedVertexPath, m_fragmentPath, features, ShaderCompileMode::Async);
+    }
+    // Cached render items hold the previous variant (and a sort key built from it)
+    GameObject::MarkStructureChanged();
+}
+
+void Material::SetTexture(const std::shared_ptr<Texture>& texture) {
+    const bool hadTexture = m_texture != nullptr;
+    m_texture = texture;
+    if (hadTexture != (m_texture != nullptr)) UpdateVariants();
+}
+
+void Material::SetBaseColor(const glm::vec4& color) {
+    MaterialParams params = m_params;
+    params.baseColor = color;
+    SetParams(params);
+}
+
+void Material::SetSpecular(const float strength, const float shininess) {
+    MaterialParams params = m_params;
+    params.specularStrength = strength;
+    params.shininess = shininess;
+    SetParams(params);
+}
+
+void Material::SetParams(const MaterialParams& params) {
+    const bool specular = m_params.specularStrength > 0.0f;
+    m_params = params;
+    m_blockIndex = MaterialBlockPool::GetInstance().Update(m_blockIndex, m_params);
+    if (specular != (m_params.specularStrength > 0.0f)) UpdateVariants();
 }
 
 void Material::Apply() {
-    if (m_shader) {
-        m_shader->use();
-        
-        try {
-            m_shader->setVec3("camPos", s_CameraPosition); // Set uniform for camera position
-        } catch (const std::exception& e) {
-            // Ignore errors if the uniform doesn't exist in the shader
-            std::cerr << "Warning: " << e.what() << std::endl;
-        }
-        
-        // hasTexture uniformunu ayarla
-        m_shader->setBool("hasTexture", m_texture != nullptr);
+    ApplyWith(m_shader.get());
+}
+
+void Material::ApplyInstanced() {
+    ApplyWith(m_instancedShader.get());
+}
+
+void Material::ApplyWith(Shader* shader) {
+    if (shader) {
+        shader->use();
+        // Parameters live in the Materials block; the draw only selects ours
+        shader->set(shader->GetEngineUniforms().materialIndex, m_blockIndex);
     }
     
     if (m_texture) {
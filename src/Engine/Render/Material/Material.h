@@ -2,47 +2,96 @@
 #define MATERIAL_H
 
 #include <memory>
+#include <string>
 #include "Engine/Render/Shader/Shader.h"
+#include "Engine/Render/Shader/ShaderPermutation.h"
 #include "Engine/Render/Texture/Texture.h"
+#include "MaterialBlockPool.h"
 #include <glm/glm.hpp>
 
 class Material {
 public:
     Material(); // Custom constructor to assign default shader and texture
-    ~Material() = default;
+    ~Material();
+    // Owns a reference to its parameter block
+    Material(const Material&) = delete;
+    Material& operator=(const Material&) = delete;
 
-    void SetShader(const std::shared_ptr<Shader>& shader) { m_shader = shader; }
+    // Fixed program; drops the instanced variant, which belonged to the previous shader, and any variant sources.
+    // Every program change marks the structure changed: scenes cache the shader in their render views
+    void SetShader(const std::shared_ptr<Shader>& shader);
     //**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//
-    void SetShadowMapShader(const std::shared_ptr<Shader>& shader) { m_shadowMapShader = shader; }
+    void SetShadowMapShader(const std::shared_ptr<Shader>& shader);
     //**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//
     std::shared_ptr<Shader> GetShader() const { return m_shader; }
     //**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//
     std::shared_ptr<Shader> GetShadowMapShader() const { return m_shadowMapShader; }
     //**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//
 
-    void SetTexture(const std::shared_ptr<Texture>& texture) { m_texture = texture; }
+    // Variant of the shader that reads the model matrix per instance (e.g. default_instanced.vert);
+    // without one, objects sharing this material are drawn one by one
+    void SetInstancedShader(const std::shared_ptr<Shader>& shader);
+    std::shared_ptr<Shader> GetInstancedShader() const { return m_instancedShader; }
+
+    /**
+     * @brief Let the material pick its programs from the shader pair's permutations
+     *
+     * The variant follows GetFeatures and is switched whenever the texture, specular or shadow
+     * settings change. The instanced variant, if a vertex path is given, shares the fragment shader.
+     * New variants compile asynchronously: check Shader::IsReady before drawing with them.
+     */
+    void SetShaderVariants(const std::string& vertexPath, const std::string& fragmentPath,
+                           const std::string& instancedVertexPath = {});
+    [[nodiscard]] ShaderFeatures GetFeatures() const;
+
+    void SetReceiveShadows(bool receiveShadows);
+    [[nodiscard]] bool GetReceiveShadows() const { return m_receiveShadows; }
+
+    void SetTexture(const std::shared_ptr<Texture>& texture);
     std::shared_ptr<Texture> GetTexture() const { return m_texture; }
 
+    /**
+     * @brief Shading parameters, stored in the shared MaterialBlockPool
+     *
+     * Materials with equal parameters share a block; an edit rewrites (and re-uploads) only this
+     * material's block. Draws pass GetBlockIndex as the materialIndex uniform.
+     */
+    void SetBaseColor(const glm::vec4& color);
+    void SetSpecular(float strength, float shininess);
+    [[nodiscard]] const MaterialParams& GetParams() const { return m_params; }
+    [[nodiscard]] uint32_t GetBlockIndex() const { return m_blockIndex; }
+
     // Activates the material: activates the shader and binds the texture (if available)
     void Apply();
 
+    // Same as Apply, with the instanced shader
+    void ApplyInstanced();
+
+    // Same as Apply, with any program reading the Materials block (e.g. a fallback while ours compiles)
+    void ApplyWith(Shader* shader);
+
     //**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//
     void Apply2ShadowMap();
     //**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//
 
-    // Added to update the camera position for all materials
-    static void SetCameraPosition(const glm::vec3& camPos);
-
 private:
+    void SetParams(const MaterialParams& params);
+    void UpdateVariants();
+
     std::shared_ptr<Shader> m_shader;
+    std::shared_ptr<Shader> m_instancedShader;
     std::shared_ptr<Texture> m_texture;
+    MaterialParams m_params;
+    uint32_t m_blockIndex = MaterialBlockPool::kDefaultBlock;
+    bool m_receiveShadows = true;
+    // Variant sources; empty when the shaders were set directly
+    std::string m_vertexPath;
+    std::string m_fragmentPath;
+    std::string m_instancedVertexPath;
 
     //**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//
     std::shared_ptr<Shader> m_shadowMapShader; // Shader for shadow mapping
     //**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//
-
-
-    static glm::vec3 s_CameraPosition; // Static camera position
 };
 
 #endif // MATERIAL_H
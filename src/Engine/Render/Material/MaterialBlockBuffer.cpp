@@ -0,0 +1,32 @@
+#include "MaterialBlockBuffer.h"
+
+MaterialBlockBuffer::~MaterialBlockBuffer() {
+    if (m_ID) glDeleteBuffers(1, &m_ID);
+}
+
+void MaterialBlockBuffer::Upload(MaterialBlockPool& pool) {
+    const std::vector<MaterialParams>& blocks = pool.GetBlocks();
+    m_LastUploadCount = 0;
+
+    if (!m_ID) {
+        glGenBuffers(1, &m_ID);
+        glBindBuffer(GL_UNIFORM_BUFFER, m_ID);
+        // Whole capacity up front: the shader declares the full array
+        glBufferData(GL_UNIFORM_BUFFER, static_cast<GLsizeiptr>(pool.GetCapacity() * sizeof(MaterialParams)),
+                     nullptr, GL_DYNAMIC_DRAW);
+        glBufferSubData(GL_UNIFORM_BUFFER, 0, static_cast<GLsizeiptr>(blocks.size() * sizeof(MaterialParams)),
+                        blocks.data());
+        m_LastUploadCount = static_cast<uint32_t>(blocks.size());
+    } else {
+        glBindBuffer(GL_UNIFORM_BUFFER, m_ID);
+        for (const uint32_t index : pool.GetDirty()) {
+            glBufferSubData(GL_UNIFORM_BUFFER, static_cast<GLintptr>(index * sizeof(MaterialParams)),
+                            sizeof(MaterialParams), &blocks[index]);
+            ++m_LastUploadCount;
+        }
+    }
+    pool.ClearDirty();
+
+    glBindBufferBase(GL_UNIFORM_BUFFER, kBindingPoint, m_ID);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+}
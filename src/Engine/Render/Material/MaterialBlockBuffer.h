@@ -0,0 +1,35 @@
+#ifndef MATERIAL_BLOCK_BUFFER_H
+#define MATERIAL_BLOCK_BUFFER_H
+
+#include <cstdint>
+#include <glad/glad.h>
+#include "MaterialBlockPool.h"
+
+/**
+ * @brief Uniform buffer mirroring a MaterialBlockPool, bound at kBindingPoint
+ *
+ * Storage for the pool's whole capacity is allocated once; after the first
+ * upload only the blocks the pool reports dirty are written.
+ */
+class MaterialBlockBuffer {
+public:
+    static constexpr GLuint kBindingPoint = 1;
+    static constexpr const char* kBlockName = "Materials";
+
+    MaterialBlockBuffer() = default;
+    ~MaterialBlockBuffer();
+    MaterialBlockBuffer(const MaterialBlockBuffer&) = delete;
+    MaterialBlockBuffer& operator=(const MaterialBlockBuffer&) = delete;
+
+    // Writes pending blocks, clears the pool's dirty list and binds the buffer
+    void Upload(MaterialBlockPool& pool);
+
+    // Blocks written by the last Upload
+    [[nodiscard]] uint32_t GetLastUploadCount() const { return m_LastUploadCount; }
+
+private:
+    GLuint m_ID = 0;
+    uint32_t m_LastUploadCount = 0;
+};
+
+#endif // MATERIAL_BLOCK_BUFFER_H
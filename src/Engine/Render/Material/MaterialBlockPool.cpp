@@ -0,0 +1,99 @@
+#include "MaterialBlockPool.h"
+#include <cstring>
+#include <string_view>
+
+bool MaterialParams::operator==(const MaterialParams& other) const {
+    return std::memcmp(this, &other, sizeof(MaterialParams)) == 0;
+}
+
+size_t MaterialBlockPool::ParamsHash::operator()(const MaterialParams& params) const {
+    return std::hash<std::string_view>{}(
+        std::string_view(reinterpret_cast<const char*>(&params), sizeof(MaterialParams)));
+}
+
+MaterialBlockPool::MaterialBlockPool(const uint32_t capacity) : m_Capacity(capacity > 0 ? capacity : 1) {
+    m_Blocks.reserve(m_Capacity);
+    m_RefCounts.reserve(m_Capacity);
+
+    // Block 0: default parameters, pinned by the pool itself
+    m_Blocks.emplace_back();
+    m_RefCounts.push_back(1);
+    m_IsDirty.push_back(0);
+    m_Lookup.emplace(m_Blocks[kDefaultBlock], kDefaultBlock);
+    m_LiveCount = 1;
+    MarkDirty(kDefaultBlock);
+}
+
+MaterialBlockPool& MaterialBlockPool::GetInstance() {
+    static MaterialBlockPool instance;
+    return instance;
+}
+
+uint32_t MaterialBlockPool::Acquire(const MaterialParams& params) {
+    if (const auto it = m_Lookup.find(params); it != m_Lookup.end()) {
+        ++m_RefCounts[it->second];
+        return it->second;
+    }
+
+    uint32_t index;
+    if (!m_FreeList.empty()) {
+        index = m_FreeList.back();
+        m_FreeList.pop_back();
+        m_Blocks[index] = params;
+    } else if (m_Blocks.size() < m_Capacity) {
+        index = static_cast<uint32_t>(m_Blocks.size());
+        m_Blocks.push_back(params);
+        m_RefCounts.push_back(0);
+        m_IsDirty.push_back(0);
+    } else {
+        // Full: fall back to the default look rather than failing the material
+        ++m_RefCounts[kDefaultBlock];
+        return kDefaultBlock;
+    }
+
+    m_RefCounts[index] = 1;
+    m_Lookup.emplace(params, index);
+    ++m_LiveCount;
+    MarkDirty(index);
+    return index;
+}
+
+void MaterialBlockPool::Release(const uint32_t index) {
+    if (index >= m_RefCounts.size() || m_RefCounts[index] == 0) return;
+    if (--m_RefCounts[index] > 0) return;
+
+    // Stale contents stay on the GPU until the slot is reused; nothing refers to them
+    m_Lookup.erase(m_Blocks[index]);
+    m_FreeList.push_back(index);
+    --m_LiveCount;
+}
+
+uint32_t MaterialBlockPool::Update(const uint32_t index, const MaterialParams& params) {
+    if (index < m_Blocks.size() && m_Blocks[index] == params) return index;
+
+    const bool soleUser = index != kDefaultBlock && index < m_RefCounts.size() && m_RefCounts[index] == 1;
+    if (soleUser && m_Lookup.find(params) == m_Lookup.end()) {
+        m_Lookup.erase(m_Blocks[index]);
+        m_Blocks[index] = params;
+        m_Lookup.emplace(params, index);
+        MarkDirty(index);
+        return index;
+    }
+
+    const uint32_t updated = Acquire(params);
+    Release(index);
+    return updated;
+}
+
+void MaterialBlockPool::ClearDirty() {
+    for (const uint32_t index : m_Dirty) {
+        m_IsDirty[index] = 0;
+    }
+    m_Dirty.clear();
+}
+
+void MaterialBlockPool::MarkDirty(const uint32_t index) {
+    if (m_IsDirty[index]) return;
+    m_IsDirty[index] = 1;
+    m_Dirty.push_back(index);
+}
@@ -0,0 +1,86 @@
+#ifndef MATERIAL_BLOCK_POOL_H
+#define MATERIAL_BLOCK_POOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include <glm/glm.hpp>
+
+/**
+ * @brief Per-material shading parameters, one std140 array element of the Materials block
+ *
+ * 32 bytes, no implicit padding: the bytes are hashed and compared as they are.
+ * Keep in sync with MaterialBlock in default.frag/simple.frag.
+ */
+struct MaterialParams {
+    glm::vec4 baseColor{1.0f};
+    float specularStrength = 0.5f;
+    float shininess = 16.0f;
+    float padding[2] = {0.0f, 0.0f};
+
+    bool operator==(const MaterialParams& other) const;
+};
+static_assert(sizeof(MaterialParams) == 32, "MaterialParams must match the std140 array stride");
+
+/**
+ * @brief Deduplicated storage for MaterialParams, mirrored into one GPU buffer
+ *
+ * Materials with equal parameters share a block; a draw only needs the block
+ * index. Blocks are reference counted, and every block written since the last
+ * ClearDirty is listed so the GPU copy can be patched instead of re-uploaded.
+ * Block 0 holds the default parameters and is never released; it is also what
+ * Acquire returns when the pool is full.
+ */
+class MaterialBlockPool {
+public:
+    // 512 * 32 bytes = 16 KB, the minimum GL_MAX_UNIFORM_BLOCK_SIZE
+    static constexpr uint32_t kDefaultCapacity = 512;
+    static constexpr uint32_t kDefaultBlock = 0;
+
+    explicit MaterialBlockPool(uint32_t capacity = kDefaultCapacity);
+
+    // Shared by all materials
+    static MaterialBlockPool& GetInstance();
+
+    // Index of a block holding params, adding a reference
+    uint32_t Acquire(const MaterialParams& params);
+    void Release(uint32_t index);
+
+    /**
+     * @brief Change the parameters behind a reference to block index
+     *
+     * Rewrites the block in place when index is the only user, so an edit dirties
+     * one block and keeps its index; otherwise moves the reference to a matching or
+     * new block. Returns the index to use from now on.
+     */
+    uint32_t Update(uint32_t index, const MaterialParams& params);
+
+    [[nodiscard]] const MaterialParams& Get(uint32_t index) const { return m_Blocks[index]; }
+    [[nodiscard]] const std::vector<MaterialParams>& GetBlocks() const { return m_Blocks; }
+    [[nodiscard]] uint32_t GetCapacity() const { return m_Capacity; }
+    // Blocks with at least one reference
+    [[nodiscard]] uint32_t GetLiveCount() const { return m_LiveCount; }
+
+    // Blocks written since the last ClearDirty, in write order
+    [[nodiscard]] const std::vector<uint32_t>& GetDirty() const { return m_Dirty; }
+    void ClearDirty();
+
+private:
+    struct ParamsHash {
+        size_t operator()(const MaterialParams& params) const;
+    };
+
+    void MarkDirty(uint32_t index);
+
+    uint32_t m_Capacity;
+    std::vector<MaterialParams> m_Blocks;
+    std::vector<uint32_t> m_RefCounts;
+    std::vector<uint32_t> m_FreeList;
+    std::unordered_map<MaterialParams, uint32_t, ParamsHash> m_Lookup;
+    std::vector<uint32_t> m_Dirty;
+    std::vector<uint8_t> m_IsDirty;
+    uint32_t m_LiveCount = 0;
+};
+
+#endif // MATERIAL_BLOCK_POOL_H
@@ -0,0 +1,81 @@
+#include "ArenaAllocator.h"
+#include <algorithm>
+
+ArenaAllocator::ArenaAllocator(const uint32_t capacity) {
+    Grow(capacity);
+}
+
+uint32_t ArenaAllocator::Allocate(const uint32_t size) {
+    if (size == 0) return kInvalidOffset;
+
+    for (auto it = m_Free.begin(); it != m_Free.end(); ++it) {
+        if (it->second < size) continue;
+
+        const uint32_t offset = it->first;
+        const uint32_t remaining = it->second - size;
+        m_Free.erase(it);
+        if (remaining > 0) m_Free.emplace(offset + size, remaining);
+        m_Allocated.emplace(offset, size);
+        m_Used += size;
+        return offset;
+    }
+    return kInvalidOffset;
+}
+
+void ArenaAllocator::Free(const uint32_t offset) {
+    const auto it = m_Allocated.find(offset);
+    if (it == m_Allocated.end()) return;
+
+    const uint32_t size = it->second;
+    m_Allocated.erase(it);
+    m_Used -= size;
+    AddFree(offset, size);
+}
+
+void ArenaAllocator::Grow(const uint32_t capacity) {
+    if (capacity <= m_Capacity) return;
+    const uint32_t added = capacity - m_Capacity;
+    const uint32_t offset = m_Capacity;
+    m_Capacity = capacity;
+    AddFree(offset, added);
+}
+
+std::vector<ArenaAllocator::Move> ArenaAllocator::Compact() {
+    std::vector<Move> moves;
+    std::map<uint32_t, uint32_t> packed;
+    uint32_t cursor = 0;
+    for (const auto& [offset, size] : m_Allocated) {
+        if (offset != cursor) moves.push_back({offset, cursor, size});
+        packed.emplace_hint(packed.end(), cursor, size);
+        cursor += size;
+    }
+
+    m_Allocated = std::move(packed);
+    m_Free.clear();
+    if (cursor < m_Capacity) m_Free.emplace(cursor, m_Capacity - cursor);
+    return moves;
+}
+
+uint32_t ArenaAllocator::GetLargestFreeRange() const {
+    uint32_t largest = 0;
+    for (const auto& [offset, size] : m_Free) largest = std::max(largest, size);
+    return largest;
+}
+
+void ArenaAllocator::AddFree(uint32_t offset, uint32_t size) {
+    // Merge with the free range ending where this one starts, and the one starting where it ends
+    auto next = m_Free.lower_bound(offset);
+    if (next != m_Free.begin()) {
+        const auto previous = std::prev(next);
+        if (previous->first + previous->second == offset) {
+            offset = previous->first;
+            size += previous->second;
+            m_Free.erase(previous);
+        }
+    }
+    if (next != m_Free.end() && offset + size == next->first) {
+        size += next->second;
+        m_Free.erase(next);
+    }
+    m_Free.emplace(offset, size);
+}
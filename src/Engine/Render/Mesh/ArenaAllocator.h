@@ -0,0 +1,62 @@
+#ifndef ARENA_ALLOCATOR_H
+#define ARENA_ALLOCATOR_H
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+/**
+ * @brief Offset/size sub-allocator over one linear range; units are up to the owner
+ *
+ * First fit over an offset-ordered free list, and freed ranges merge with their
+ * free neighbours. Holds no memory itself: GeometryArena uses it for vertices
+ * and indices inside its GL buffers.
+ */
+class ArenaAllocator {
+public:
+    static constexpr uint32_t kInvalidOffset = UINT32_MAX;
+
+    explicit ArenaAllocator(uint32_t capacity = 0);
+
+    // Offset of a free range of size units, or kInvalidOffset if none is big enough (Grow and retry)
+    [[nodiscard]] uint32_t Allocate(uint32_t size);
+    // Offset must come from Allocate; anything else is ignored
+    void Free(uint32_t offset);
+
+    // New space goes at the end, merged with a trailing free range
+    void Grow(uint32_t capacity);
+
+    // Copy of size units from offset `from` to `to`
+    struct Move {
+        uint32_t from = 0;
+        uint32_t to = 0;
+        uint32_t size = 0;
+    };
+
+    /**
+     * @brief Pack the allocations to the front, in offset order, leaving one free range at the end
+     *
+     * Returns the copies that reproduce the new layout, in offset order; `to`
+     * never exceeds `from`, but a move may overlap its own source.
+     */
+    std::vector<Move> Compact();
+
+    [[nodiscard]] uint32_t GetCapacity() const { return m_Capacity; }
+    [[nodiscard]] uint32_t GetUsed() const { return m_Used; }
+    [[nodiscard]] uint32_t GetAllocationCount() const { return static_cast<uint32_t>(m_Allocated.size()); }
+    [[nodiscard]] uint32_t GetFreeRangeCount() const { return static_cast<uint32_t>(m_Free.size()); }
+    [[nodiscard]] uint32_t GetLargestFreeRange() const;
+
+    // Free space outside the largest free range: what Compact would win back for one big allocation
+    [[nodiscard]] uint32_t GetFragmentedSpace() const { return m_Capacity - m_Used - GetLargestFreeRange(); }
+
+private:
+    void AddFree(uint32_t offset, uint32_t size);
+
+    std::map<uint32_t, uint32_t> m_Free;      // Offset -> size, never adjacent
+    std::map<uint32_t, uint32_t> m_Allocated; // Offset -> size
+    uint32_t m_Capacity = 0;
+    uint32_t m_Used = 0;
+};
+
+#endif // ARENA_ALLOCATOR_H
@@ -0,0 +1,229 @@
+#include "GeometryArena.h"
+#include "Engine/Render/State/GLStateCache.h"
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <unordered_map>
+
+GeometryArena& GeometryArena::GetInstance() {
+    static GeometryArena instance;
+    return instance;
+}
+
+void GeometryArena::SetVertexFormat(const VertexFormat format) {
+    if (format == m_Format) return;
+    if (m_VertexArray) {
+        std::cerr << "GeometryArena: vertex format can only change before the first mesh upload" << std::endl;
+        return;
+    }
+    m_Format = format;
+    m_VertexStride = VertexPacking::Stride(format);
+}
+
+GeometryArena::Handle GeometryArena::Allocate(const std::vector<Vertex>& vertices,
+                                              const std::vector<unsigned int>& indices,
+                                              const glm::vec3& boundsMin, const glm::vec3& boundsMax) {
+    if (vertices.empty() || indices.empty()) return kInvalidHandle;
+    EnsureCreated();
+
+    const auto vertexCount = static_cast<uint32_t>(vertices.size());
+    const auto indexCount = static_cast<uint32_t>(indices.size());
+    const bool shortIndices = VertexPacking::UsesShortIndices(vertices.size());
+    const size_t indexBytes = indexCount * (shortIndices ? sizeof(GLushort) : sizeof(GLuint));
+    const auto indexWords = static_cast<uint32_t>((indexBytes + kIndexWordSize - 1) / kIndexWordSize);
+
+    uint32_t vertexOffset = m_Vertices.Allocate(vertexCount);
+    if (vertexOffset == ArenaAllocator::kInvalidOffset) {
+        GrowVertices(vertexCount);
+        vertexOffset = m_Vertices.Allocate(vertexCount);
+    }
+    uint32_t indexWord = m_Indices.Allocate(indexWords);
+    if (indexWord == ArenaAllocator::kInvalidOffset) {
+        GrowIndices(indexWords);
+        indexWord = m_Indices.Allocate(indexWords);
+    }
+
+    m_PackedVertices.clear();
+    VertexPacking::Pack(m_Format, &vertices[0].position.x, &vertices[0].normal.x, &vertices[0].texCoords.x,
+                        vertices.size(), sizeof(Vertex), boundsMin, boundsMax, m_PackedVertices);
+    const void* indexData = indices.data();
+    if (shortIndices) {
+        VertexPacking::NarrowIndices(indices.data(), indices.size(), m_ShortIndices);
+        indexData = m_ShortIndices.data();
+    }
+
+    // Copy targets: uploading must not touch the element binding of whatever VAO is bound
+    glBindBuffer(GL_COPY_WRITE_BUFFER, m_VertexBuffer);
+    glBufferSubData(GL_COPY_WRITE_BUFFER, static_cast<GLintptr>(vertexOffset * m_VertexStride),
+                    static_cast<GLsizeiptr>(m_PackedVertices.size()), m_PackedVertices.data());
+    glBindBuffer(GL_COPY_WRITE_BUFFER, m_IndexBuffer);
+    glBufferSubData(GL_COPY_WRITE_BUFFER, static_cast<GLintptr>(indexWord * kIndexWordSize),
+                    static_cast<GLsizeiptr>(indexBytes), indexData);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+    Handle handle;
+    if (!m_FreeHandles.empty()) {
+        handle = m_FreeHandles.back();
+        m_FreeHandles.pop_back();
+    } else {
+        handle = static_cast<Handle>(m_Slots.size());
+        m_Slots.emplace_back();
+    }
+    Slot& slot = m_Slots[handle];
+    slot.range.baseVertex = static_cast<int32_t>(vertexOffset);
+    slot.range.vertexCount = vertexCount;
+    slot.range.indexType = shortIndices ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+    slot.range.firstIndex = static_cast<uint32_t>(indexWord * kIndexWordSize / slot.range.IndexSize());
+    slot.range.indexCount = indexCount;
+    slot.indexWord = indexWord;
+    slot.indexWords = indexWords;
+    slot.live = true;
+    m_UnpackedBytes += vertices.size() * sizeof(Vertex) + indices.size() * sizeof(GLuint);
+    UpdateStats();
+    return handle;
+}
+
+void GeometryArena::Free(const Handle handle) {
+    if (handle >= m_Slots.size() || !m_Slots[handle].live) return;
+
+    // Bookkeeping only: the data stays until the range is reused or compacted away
+    Slot& slot = m_Slots[handle];
+    m_Vertices.Free(static_cast<uint32_t>(slot.range.baseVertex));
+    m_Indices.Free(slot.indexWord);
+    m_UnpackedBytes -= slot.range.vertexCount * sizeof(Vertex) + slot.range.indexCount * sizeof(GLuint);
+    slot.live = false;
+    m_FreeHandles.push_back(handle);
+    UpdateStats();
+}
+
+void GeometryArena::Bind() {
+    GLStateCache::GetInstance().BindVertexArray(m_VertexArray);
+}
+
+void GeometryArena::Maintain() {
+    if (!m_VertexArray) return;
+    const auto wasteful = [](const ArenaAllocator& allocator) {
+        return allocator.GetFragmentedSpace() * 4 > allocator.GetCapacity();
+    };
+    if (wasteful(m_Vertices) || wasteful(m_Indices)) Defragment();
+}
+
+void GeometryArena::Defragment() {
+    if (!m_VertexArray) return;
+
+    std::unordered_map<uint32_t, uint32_t> vertexMoves;
+    for (const ArenaAllocator::Move& move : m_Vertices.Compact()) vertexMoves.emplace(move.from, move.to);
+    std::unordered_map<uint32_t, uint32_t> indexMoves;
+    for (const ArenaAllocator::Move& move : m_Indices.Compact()) indexMoves.emplace(move.from, move.to);
+
+    // Fresh buffers: every live range is copied, moved or not
+    std::vector<ArenaAllocator::Move> vertexCopies;
+    std::vector<ArenaAllocator::Move> indexCopies;
+    for (Slot& slot : m_Slots) {
+        if (!slot.live) continue;
+        GeometryRange& range = slot.range;
+        const auto baseVertex = static_cast<uint32_t>(range.baseVertex);
+        const auto vertexIt = vertexMoves.find(baseVertex);
+        const uint32_t newBase = vertexIt != vertexMoves.end() ? vertexIt->second : baseVertex;
+        const auto indexIt = indexMoves.find(slot.indexWord);
+        const uint32_t newWord = indexIt != indexMoves.end() ? indexIt->second : slot.indexWord;
+
+        vertexCopies.push_back({baseVertex, newBase, range.vertexCount});
+        indexCopies.push_back({slot.indexWord, newWord, slot.indexWords});
+        range.baseVertex = static_cast<int32_t>(newBase);
+        range.firstIndex = static_cast<uint32_t>(newWord * kIndexWordSize / range.IndexSize());
+        slot.indexWord = newWord;
+    }
+
+    m_VertexBuffer = Reallocate(m_VertexBuffer, m_Vertices.GetCapacity(), m_VertexStride, vertexCopies);
+    m_IndexBuffer = Reallocate(m_IndexBuffer, m_Indices.GetCapacity(), kIndexWordSize, indexCopies);
+    LinkVertexArray();
+    ++m_Stats.defragmentations;
+    UpdateStats();
+}
+
+void GeometryArena::EnsureCreated() {
+    if (m_VertexArray) return;
+    glGenVertexArrays(1, &m_VertexArray);
+    m_Vertices.Grow(kInitialVertices);
+    m_Indices.Grow(kInitialIndexWords);
+    m_VertexBuffer = Reallocate(0, kInitialVertices, m_VertexStride, {});
+    m_IndexBuffer = Reallocate(0, kInitialIndexWords, kIndexWordSize, {});
+    LinkVertexArray();
+}
+
+GLuint GeometryArena::Reallocate(GLuint buffer, const uint32_t capacity, const size_t unitSize,
+                                 const std::vector<ArenaAllocator::Move>& moves) {
+    GLuint fresh = 0;
+    glGenBuffers(1, &fresh);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, fresh);
+    glBufferData(GL_COPY_WRITE_BUFFER, static_cast<GLsizeiptr>(capacity * unitSize), nullptr, GL_STATIC_DRAW);
+    if (buffer) {
+        // Copied on the GPU; the CPU copies in Mesh are not needed
+        glBindBuffer(GL_COPY_READ_BUFFER, buffer);
+        for (const ArenaAllocator::Move& move : moves) {
+            glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER,
+                                static_cast<GLintptr>(move.from * unitSize), static_cast<GLintptr>(move.to * unitSize),
+                                static_cast<GLsizeiptr>(move.size * unitSize));
+        }
+        glBindBuffer(GL_COPY_READ_BUFFER, 0);
+        glDeleteBuffers(1, &buffer);
+    }
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    return fresh;
+}
+
+void GeometryArena::GrowVertices(const uint32_t minimum) {
+    const uint32_t capacity = m_Vertices.GetCapacity();
+    const uint32_t grown = std::max(capacity * 2, capacity + minimum);
+    m_Vertices.Grow(grown);
+    m_VertexBuffer = Reallocate(m_VertexBuffer, grown, m_VertexStride, {{0, 0, capacity}});
+    LinkVertexArray();
+    ++m_Stats.grows;
+}
+
+void GeometryArena::GrowIndices(const uint32_t minimum) {
+    const uint32_t capacity = m_Indices.GetCapacity();
+    const uint32_t grown = std::max(capacity * 2, capacity + minimum);
+    m_Indices.Grow(grown);
+    m_IndexBuffer = Reallocate(m_IndexBuffer, grown, kIndexWordSize, {{0, 0, capacity}});
+    LinkVertexArray();
+    ++m_Stats.grows;
+}
+
+void GeometryArena::LinkVertexArray() {
+    GLStateCache::GetInstance().BindVertexArray(m_VertexArray);
+    glBindBuffer(GL_ARRAY_BUFFER, m_VertexBuffer);
+    // Position (0), octahedral normal (1), texture coordinates (2); instance attributes start at 3 (InstanceBuffer)
+    const auto stride = static_cast<GLsizei>(m_VertexStride);
+    if (m_Format == VertexFormat::Quantized) {
+        // Reaches the shader as [0, 1]; the model matrix scales it back over the mesh bounds
+        glVertexAttribPointer(0, 3, GL_UNSIGNED_SHORT, GL_TRUE, stride,
+                              reinterpret_cast<const void*>(offsetof(QuantizedVertex, position)));
+        glVertexAttribPointer(1, 2, GL_SHORT, GL_TRUE, stride,
+                              reinterpret_cast<const void*>(offsetof(QuantizedVertex, normal)));
+        glVertexAttribPointer(2, 2, GL_HALF_FLOAT, GL_FALSE, stride,
+                              reinterpret_cast<const void*>(offsetof(QuantizedVertex, texCoords)));
+    } else {
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, stride,
+                              reinterpret_cast<const void*>(offsetof(CompactVertex, position)));
+        glVertexAttribPointer(1, 2, GL_SHORT, GL_TRUE, stride,
+                              reinterpret_cast<const void*>(offsetof(CompactVertex, normal)));
+        glVertexAttribPointer(2, 2, GL_HALF_FLOAT, GL_FALSE, stride,
+                              reinterpret_cast<const void*>(offsetof(CompactVertex, texCoords)));
+    }
+    glEnableVertexAttribArray(0);
+    glEnableVertexAttribArray(1);
+    glEnableVertexAttribArray(2);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_IndexBuffer); // Recorded in the VAO
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void GeometryArena::UpdateStats() {
+    m_Stats.allocations = m_Vertices.GetAllocationCount();
+    m_Stats.vertexBytesUsed = m_Vertices.GetUsed() * m_VertexStride;
+    m_Stats.vertexBytesCapacity = m_Vertices.GetCapacity() * m_VertexStride;
+    m_Stats.indexBytesUsed = m_Indices.GetUsed() * kIndexWordSize;
+    m_Stats.indexBytesCapacity = m_Indices.GetCapacity() * kIndexWordSize;
+    m_Stats.unpackedBytes = m_UnpackedBytes;
+}
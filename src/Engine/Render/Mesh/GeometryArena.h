@@ -0,0 +1,133 @@
+#ifndef GEOMETRY_ARENA_H
+#define GEOMETRY_ARENA_H
+
+#include <cstdint>
+#include <vector>
+#include <glad/glad.h>
+#include "ArenaAllocator.h"
+#include "VertexPacking.h"
+#include "VBO/VBO.h"
+
+/**
+ * @brief Where a mesh lives in the arena: indices are relative to baseVertex
+ */
+struct GeometryRange {
+    int32_t baseVertex = 0;
+    uint32_t vertexCount = 0;
+    uint32_t firstIndex = 0; // In indices of indexType
+    uint32_t indexCount = 0;
+    GLenum indexType = GL_UNSIGNED_INT; // GL_UNSIGNED_SHORT whenever the mesh's vertices allow it
+
+    [[nodiscard]] size_t IndexSize() const { return indexType == GL_UNSIGNED_SHORT ? sizeof(GLushort) : sizeof(GLuint); }
+    // Offset argument of the glDraw*Elements* calls for index `index` of the range
+    [[nodiscard]] const void* IndexPointer(const uint32_t index = 0) const {
+        return reinterpret_cast<const void*>(static_cast<uintptr_t>(firstIndex + index) * IndexSize());
+    }
+};
+
+struct GeometryArenaStats {
+    uint32_t allocations = 0;
+    size_t vertexBytesUsed = 0;
+    size_t vertexBytesCapacity = 0;
+    size_t indexBytesUsed = 0;
+    size_t indexBytesCapacity = 0;
+    size_t unpackedBytes = 0;   // The same meshes as 32-byte Vertex and 32-bit indices
+    uint32_t grows = 0;         // Buffer reallocations since start
+    uint32_t defragmentations = 0;
+};
+
+/**
+ * @brief One vertex buffer and one index buffer shared by every Mesh, behind one VAO
+ *
+ * Meshes get a sub-range of each (ArenaAllocator) and draw with base-vertex
+ * calls, so switching meshes never rebinds a VAO and a whole run of different
+ * meshes can go out as one glMultiDrawElementsIndirect. Buffers grow by copying
+ * on the GPU; Maintain compacts them when freed meshes leave too many holes.
+ * Ranges move when that happens: look them up through the handle at draw time.
+ *
+ * Vertices are stored packed (VertexPacking): octahedral normals, half-float
+ * UVs and, in the default Quantized format, 16-bit positions over the mesh
+ * bounds that the model matrix decodes (Mesh::GetPositionDecode). Meshes with
+ * up to 64K vertices get 16-bit indices; both index types share one buffer.
+ *
+ * GL objects are created on the first allocation and live as long as the
+ * context; nothing touches GL during static destruction.
+ */
+class GeometryArena {
+public:
+    using Handle = uint32_t;
+    static constexpr Handle kInvalidHandle = UINT32_MAX;
+
+    static GeometryArena& GetInstance();
+
+    GeometryArena(const GeometryArena&) = delete;
+    GeometryArena& operator=(const GeometryArena&) = delete;
+
+    // Only before the first upload: every mesh in the arena shares one layout
+    void SetVertexFormat(VertexFormat format);
+    [[nodiscard]] VertexFormat GetVertexFormat() const { return m_Format; }
+
+    /**
+     * @brief Pack and upload both arrays; kInvalidHandle for empty geometry
+     *
+     * @param boundsMin, boundsMax Bounds of the vertex positions, for Quantized positions
+     */
+    Handle Allocate(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices,
+                    const glm::vec3& boundsMin, const glm::vec3& boundsMax);
+    void Free(Handle handle);
+
+    [[nodiscard]] const GeometryRange& GetRange(const Handle handle) const { return m_Slots[handle].range; }
+
+    // The shared VAO (through GLStateCache, so repeated binds cost nothing)
+    void Bind();
+
+    // Called once per frame: compacts when holes waste more than a quarter of either buffer
+    void Maintain();
+    // Packs every mesh to the front of fresh buffers
+    void Defragment();
+
+    [[nodiscard]] const GeometryArenaStats& GetStats() const { return m_Stats; }
+
+private:
+    GeometryArena() = default;
+
+    // First buffers; each grows to at least twice its size when full. Index space
+    // is handed out in 4-byte words so 32-bit ranges stay aligned next to 16-bit ones
+    static constexpr uint32_t kInitialVertices = 64 * 1024;
+    static constexpr uint32_t kInitialIndexWords = 128 * 1024;
+    static constexpr size_t kIndexWordSize = sizeof(GLuint);
+
+    struct Slot {
+        GeometryRange range;
+        uint32_t indexWord = 0; // Allocation in m_Indices
+        uint32_t indexWords = 0;
+        bool live = false;
+    };
+
+    void EnsureCreated();
+    // Reallocates a buffer to capacity units and copies the given ranges over (units of unitSize bytes)
+    static GLuint Reallocate(GLuint buffer, uint32_t capacity, size_t unitSize,
+                             const std::vector<ArenaAllocator::Move>& moves);
+    void GrowVertices(uint32_t minimum);
+    void GrowIndices(uint32_t minimum);
+    // Points the VAO at the current buffers
+    void LinkVertexArray();
+    void UpdateStats();
+
+    VertexFormat m_Format = VertexFormat::Quantized;
+    size_t m_VertexStride = sizeof(QuantizedVertex);
+    GLuint m_VertexArray = 0;
+    GLuint m_VertexBuffer = 0;
+    GLuint m_IndexBuffer = 0;
+    ArenaAllocator m_Vertices;
+    ArenaAllocator m_Indices; // In index words
+    // Reused upload staging
+    std::vector<uint8_t> m_PackedVertices;
+    std::vector<uint16_t> m_ShortIndices;
+    size_t m_UnpackedBytes = 0;
+    std::vector<Slot> m_Slots;
+    std::vector<Handle> m_FreeHandles;
+    GeometryArenaStats m_Stats;
+};
+
+#endif // GEOMETRY_ARENA_H
@@ -0,0 +1,37 @@
+#include "IndirectBuffer.h"
+#include <cstdint>
+
+IndirectBuffer::~IndirectBuffer() {
+    if (m_ID) glDeleteBuffers(1, &m_ID);
+}
+
+bool IndirectBuffer::IsSupported() {
+    static const bool supported = (GLAD_GL_VERSION_4_3 ||
+                                   (GLAD_GL_ARB_multi_draw_indirect && GLAD_GL_ARB_base_instance)) &&
+                                  glMultiDrawElementsIndirect != nullptr;
+    return supported;
+}
+
+void IndirectBuffer::Upload(const std::vector<DrawElementsIndirectCommand>& commands) {
+    if (commands.empty()) return;
+    if (!m_ID) glGenBuffers(1, &m_ID);
+
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, m_ID);
+    if (commands.size() > m_Capacity) {
+        m_Capacity = commands.size() + commands.size() / 2;
+    }
+    // Orphaned like InstanceBuffer: last frame's draws keep their storage
+    glBufferData(GL_DRAW_INDIRECT_BUFFER,
+                 static_cast<GLsizeiptr>(m_Capacity * sizeof(DrawElementsIndirectCommand)), nullptr, GL_STREAM_DRAW);
+    glBufferSubData(GL_DRAW_INDIRECT_BUFFER, 0,
+                    static_cast<GLsizeiptr>(commands.size() * sizeof(DrawElementsIndirectCommand)), commands.data());
+}
+
+void IndirectBuffer::Draw(const uint32_t first, const uint32_t count, const GLenum indexType) const {
+    if (count == 0) return;
+    // Stays bound between draws of the pass; nothing else uses the indirect binding
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, m_ID);
+    const uintptr_t offset = static_cast<uintptr_t>(first) * sizeof(DrawElementsIndirectCommand);
+    glMultiDrawElementsIndirect(GL_TRIANGLES, indexType, reinterpret_cast<const void*>(offset),
+                                static_cast<GLsizei>(count), 0);
+}
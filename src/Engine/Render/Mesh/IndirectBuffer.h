@@ -0,0 +1,49 @@
+#ifndef INDIRECT_BUFFER_H
+#define INDIRECT_BUFFER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <glad/glad.h>
+
+/**
+ * @brief One draw of glMultiDrawElementsIndirect, in the layout GL reads
+ */
+struct DrawElementsIndirectCommand {
+    uint32_t count = 0;
+    uint32_t instanceCount = 0;
+    uint32_t firstIndex = 0;
+    int32_t baseVertex = 0;
+    uint32_t baseInstance = 0; // Offsets the per-instance attributes (InstanceBuffer)
+};
+static_assert(sizeof(DrawElementsIndirectCommand) == 20, "Indirect command layout");
+
+/**
+ * @brief GL_DRAW_INDIRECT_BUFFER holding a pass's commands, submitted in ranges
+ *
+ * The whole queue goes up in one Upload; each run sharing a shader and material
+ * is then one Draw over its slice, however many meshes it covers. Needs
+ * multi-draw indirect and base instance (GL 4.3, or the ARB extensions).
+ */
+class IndirectBuffer {
+public:
+    IndirectBuffer() = default;
+    ~IndirectBuffer();
+    IndirectBuffer(const IndirectBuffer&) = delete;
+    IndirectBuffer& operator=(const IndirectBuffer&) = delete;
+
+    // Checked once, after the context is current
+    [[nodiscard]] static bool IsSupported();
+
+    void Upload(const std::vector<DrawElementsIndirectCommand>& commands);
+
+    // Commands [first, first + count) of the last upload, with the geometry arena's VAO bound;
+    // all of them must index with indexType (firstIndex counts in that type)
+    void Draw(uint32_t first, uint32_t count, GLenum indexType = GL_UNSIGNED_INT) const;
+
+private:
+    GLuint m_ID = 0;
+    size_t m_Capacity = 0; // In commands
+};
+
+#endif // INDIRECT_BUFFER_H
@@ -0,0 +1,45 @@
+#include "InstanceBuffer.h"
+#include <cstddef>
+#include <cstdint>
+
+InstanceBuffer::~InstanceBuffer() {
+    if (m_ID) glDeleteBuffers(1, &m_ID);
+}
+
+void InstanceBuffer::Upload(const std::vector<InstanceData>& instances) {
+    if (instances.empty()) return;
+    if (!m_ID) glGenBuffers(1, &m_ID);
+
+    glBindBuffer(GL_ARRAY_BUFFER, m_ID);
+    if (instances.size() > m_Capacity) {
+        // Headroom, so a slowly growing scene does not reallocate every frame
+        m_Capacity = instances.size() + instances.size() / 2;
+    }
+    // Fresh storage on every upload: the driver orphans the old one instead of waiting for last frame's draws
+    glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(m_Capacity * sizeof(InstanceData)), nullptr,
+                 GL_STREAM_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, static_cast<GLsizeiptr>(instances.size() * sizeof(InstanceData)),
+                    instances.data());
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void InstanceBuffer::BindAttributes(const uint32_t firstInstance) const {
+    glBindBuffer(GL_ARRAY_BUFFER, m_ID);
+    const uintptr_t base = static_cast<uintptr_t>(firstInstance) * sizeof(InstanceData);
+    constexpr auto stride = static_cast<GLsizei>(sizeof(InstanceData));
+
+    for (GLuint column = 0; column < 4; ++column) {
+        const GLuint location = kModelLocation + column;
+        glEnableVertexAttribArray(location);
+        glVertexAttribPointer(location, 4, GL_FLOAT, GL_FALSE, stride,
+                              reinterpret_cast<const void*>(base + offsetof(InstanceData, model) +
+                                                            column * sizeof(glm::vec4)));
+        glVertexAttribDivisor(location, 1);
+    }
+    glEnableVertexAttribArray(kObjectIdLocation);
+    glVertexAttribIPointer(kObjectIdLocation, 1, GL_UNSIGNED_INT, stride,
+                           reinterpret_cast<const void*>(base + offsetof(InstanceData, objectId)));
+    glVertexAttribDivisor(kObjectIdLocation, 1);
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
@@ -0,0 +1,38 @@
+#ifndef INSTANCE_BUFFER_H
+#define INSTANCE_BUFFER_H
+
+#include <vector>
+#include <glad/glad.h>
+#include "Engine/Render/View/InstanceBatch.h"
+
+/**
+ * @brief Vertex buffer streaming InstanceData to instanced draws
+ *
+ * The whole frame's instances go up in one Upload; each batch then points the
+ * per-instance attributes of the bound VAO at its own range, which works
+ * without base-instance draws.
+ */
+class InstanceBuffer {
+public:
+    // Model matrix in locations 3-6, object id in 7 (see default_instanced.vert)
+    static constexpr GLuint kModelLocation = 3;
+    static constexpr GLuint kObjectIdLocation = 7;
+
+    InstanceBuffer() = default;
+    ~InstanceBuffer();
+    InstanceBuffer(const InstanceBuffer&) = delete;
+    InstanceBuffer& operator=(const InstanceBuffer&) = delete;
+
+    void Upload(const std::vector<InstanceData>& instances);
+
+    /**
+     * @brief Point the bound VAO's instance attributes at instances [firstInstance, ...)
+     */
+    void BindAttributes(uint32_t firstInstance) const;
+
+private:
+    GLuint m_ID = 0;
+    size_t m_Capacity = 0; // In instances
+};
+
+#endif // INSTANCE_BUFFER_H
@@ -1,12 +1,15 @@
 #include "Mesh.h"
+#include "Engine/Render/State/GLStateCache.h"
+#include "MeshOptimizer.h"
 #include <iostream>
 #include <glad/glad.h>
 
+MeshletStats Mesh::s_MeshletStats;
 
 Mesh::~Mesh()
 {
-    // Yok edici
-    if (vao.ID) vao.Delete();
+    // Yok edici: aralık arenaya geri döner
+    GeometryArena::GetInstance().Free(m_Geometry);
 }
 
 void Mesh::Initialize(const std::vector<Vertex>& vertices,const std::vector<unsigned int>& indices)
@@ -14,42 +17,112 @@ void Mesh::Initialize(const std::vector<Vertex>& vertices,const std::vector<unsi
     // Store a copy of the mesh data for collision detection, ray casting, etc.
     m_Vertices = vertices;
     m_Indices = indices;
-    
-    indexCount = static_cast<unsigned int>(indices.size());
-    Mesh::vertices = vertices;
-    Mesh::indices = indices;
+    // Welded, in vertex cache and overdraw order, vertices in fetch order
+    MeshOptimizer::Optimize(m_Vertices, m_Indices);
 
+    // Büyük mesh'leri kümelere böl; üçgenler yalnızca yakın komşularıyla yer değiştirir, önbellek sırası korunur
+    m_Meshlets.clear();
+    if (m_Indices.size() / 3 >= kMinMeshletTriangles) {
+        Meshlets::BuildInPlace(m_Vertices, m_Indices, m_Meshlets);
+    }
 
-    vao.Bind();
+    indexCount = static_cast<unsigned int>(m_Indices.size());
 
-    // Create VBO on the heap with vertices
-    VBO vbo(Mesh::vertices);
+    // Bounds first: quantized positions are stored relative to them
+    CalculateBounds();
 
-    // Create EBO on the heap with indices
-    EBO ebo(Mesh::indices);
+    // Vertices and indices go packed into the shared arena; the vertex layout lives in its VAO
+    GeometryArena& arena = GeometryArena::GetInstance();
+    arena.Free(m_Geometry);
+    m_Geometry = arena.Allocate(m_Vertices, m_Indices, m_MinBounds, m_MaxBounds);
+    m_PositionDecode = VertexPacking::PositionDecode(arena.GetVertexFormat(), m_MinBounds, m_MaxBounds);
+    if (m_Geometry == GeometryArena::kInvalidHandle) indexCount = 0; // Nothing to draw
+}
 
-    // Position (layout=0)
-    vao.LinkAttrib(vbo, 0, 3, GL_FLOAT, sizeof(Vertex), (void*)0);
+void Mesh::Draw()
+{
+    Bind();
+    DrawBound();
+}
 
-    // Normal (layout=1)
-    vao.LinkAttrib(vbo, 1, 3, GL_FLOAT, sizeof(Vertex),(void*)(3 * sizeof(float)));
+void Mesh::Unbind()
+{
+    GLStateCache::GetInstance().BindVertexArray(0);
+}
 
-    // TexCoords (layout=2)
-    vao.LinkAttrib(vbo, 2, 2, GL_FLOAT, sizeof(Vertex), (void*)(6 * sizeof(float)));
+const GeometryRange& Mesh::GetGeometry() const
+{
+    static const GeometryRange empty;
+    return m_Geometry != GeometryArena::kInvalidHandle ? GeometryArena::GetInstance().GetRange(m_Geometry) : empty;
+}
 
-    glBindVertexArray(0);
+void Mesh::DrawBound()
+{
+    if (indexCount == 0) return;
+    const GeometryRange& geometry = GetGeometry();
+    glDrawElementsBaseVertex(GL_TRIANGLES, indexCount, geometry.indexType, geometry.IndexPointer(), geometry.baseVertex);
+}
 
-    // Calculate bounds after initialization
-    CalculateBounds();
+void Mesh::DrawBoundInstanced(const uint32_t instanceCount)
+{
+    if (indexCount == 0) return;
+    s_MeshletStats.triangles += indexCount / 3 * instanceCount;
+    s_MeshletStats.visibleTriangles += indexCount / 3 * instanceCount;
+    ++s_MeshletStats.draws;
+    const GeometryRange& geometry = GetGeometry();
+    glDrawElementsInstancedBaseVertex(GL_TRIANGLES, indexCount, geometry.indexType, geometry.IndexPointer(),
+                                      static_cast<GLsizei>(instanceCount), geometry.baseVertex);
 }
 
-void Mesh::Draw()
+DrawElementsIndirectCommand Mesh::MakeIndirectCommand(const uint32_t instanceCount, const uint32_t baseInstance) const
+{
+    s_MeshletStats.triangles += indexCount / 3 * instanceCount;
+    s_MeshletStats.visibleTriangles += indexCount / 3 * instanceCount;
+    const GeometryRange& geometry = GetGeometry();
+    DrawElementsIndirectCommand command;
+    command.count = indexCount;
+    command.instanceCount = instanceCount;
+    command.firstIndex = geometry.firstIndex;
+    command.baseVertex = geometry.baseVertex;
+    command.baseInstance = baseInstance;
+    return command;
+}
+
+void Mesh::Draw(const glm::mat4& viewProjection, const glm::mat4& model, const glm::vec3& eye)
 {
-    vao.Bind();
+    Bind();
+    DrawBound(viewProjection, model, eye);
+}
+
+void Mesh::DrawBound(const glm::mat4& viewProjection, const glm::mat4& model, const glm::vec3& eye)
+{
+    if (m_Meshlets.empty()) {
+        s_MeshletStats.triangles += indexCount / 3;
+        s_MeshletStats.visibleTriangles += indexCount / 3;
+        ++s_MeshletStats.draws;
+        DrawBound();
+        return;
+    }
 
-    glDrawElements(GL_TRIANGLES, indices.size(), GL_UNSIGNED_INT, nullptr);
+    // Cull in mesh space: the frustum of viewProjection * model and the eye moved by the inverse model
+    const Math::Frustum localFrustum(viewProjection * model);
+    const glm::vec3 localEye(glm::inverse(model) * glm::vec4(eye, 1.0f));
+    m_VisibleRanges.clear();
+    Meshlets::Cull(m_Meshlets, localFrustum, localEye, m_VisibleRanges, s_MeshletStats);
+    if (m_VisibleRanges.empty()) return;
+
+    // Meshlet offsets are within the mesh; the arena range adds the rest
+    const GeometryRange& geometry = GetGeometry();
+    m_DrawCounts.resize(m_VisibleRanges.size());
+    m_DrawOffsets.resize(m_VisibleRanges.size());
+    m_DrawBaseVertices.assign(m_VisibleRanges.size(), geometry.baseVertex);
+    for (size_t i = 0; i < m_VisibleRanges.size(); ++i) {
+        m_DrawCounts[i] = static_cast<GLsizei>(m_VisibleRanges[i].indexCount);
+        m_DrawOffsets[i] = geometry.IndexPointer(m_VisibleRanges[i].indexOffset);
+    }
 
-    glBindVertexArray(0);
+    glMultiDrawElementsBaseVertex(GL_TRIANGLES, m_DrawCounts.data(), geometry.indexType, m_DrawOffsets.data(),
+                                  static_cast<GLsizei>(m_DrawCounts.size()), m_DrawBaseVertices.data());
 }
 
 glm::vec3 Mesh::GetMinBounds() const
@@ -6,26 +6,75 @@
 #include <glm/glm.hpp>
 #include <limits>
 #include "VBO/VBO.h"
-#include "EBO/EBO.h"
-#include "VAO/VAO.h"
+#include "GeometryArena.h"
+#include "IndirectBuffer.h"
+#include "Meshlet.h"
 
 
 
+/**
+ * @brief Triangle mesh stored in the shared GeometryArena
+ *
+ * All meshes use the arena's VAO; draws address this mesh's range with base-vertex calls.
+ */
 class Mesh {
 public:
-    std::vector<Vertex> vertices;
-    std::vector<GLuint> indices;
-    VAO vao; // Fixed double semicolon and renamed to lowercase to avoid conflict
-
-
     /////////////////////////
     Mesh() = default; // Added default constructor
     ~Mesh();
+    // Owns GL objects; share it through std::shared_ptr (see PrimitiveCache) instead of copying
+    Mesh(const Mesh&) = delete;
+    Mesh& operator=(const Mesh&) = delete;
 
     void Initialize(const std::vector<Vertex> &vertices, const std::vector<unsigned int> &indices);
 
+    // Leaves the arena VAO bound: the state cache skips the rebind for the next mesh
     void Draw();
 
+    /**
+     * @brief Draw only the meshlets that can be visible from the camera (one multi-draw)
+     *
+     * Meshes too small to be split fall back to Draw. Counts go into GetMeshletStats.
+     *
+     * @param eye Camera position in world space
+     */
+    void Draw(const glm::mat4& viewProjection, const glm::mat4& model, const glm::vec3& eye);
+
+    /**
+     * @brief Same as the culled Draw, but expects Bind() to have been called
+     *
+     * Every mesh shares the arena VAO, so a sorted queue binds it once per pass.
+     */
+    void DrawBound(const glm::mat4& viewProjection, const glm::mat4& model, const glm::vec3& eye);
+    void DrawBound();
+
+    // Whole mesh, instanceCount times; the instance attributes must be bound too
+    void DrawBoundInstanced(uint32_t instanceCount);
+
+    void Bind() { GeometryArena::GetInstance().Bind(); }
+    static void Unbind();
+
+    // Whole mesh as one command of a multi-draw indirect; its triangles go into GetMeshletStats
+    [[nodiscard]] DrawElementsIndirectCommand MakeIndirectCommand(uint32_t instanceCount, uint32_t baseInstance) const;
+    // Where the mesh lives in the arena; moves when the arena is defragmented
+    [[nodiscard]] const GeometryRange& GetGeometry() const;
+    /**
+     * @brief Mesh-space transform of the stored positions (VertexPacking::PositionDecode)
+     *
+     * Shaders get model * GetPositionDecode() as their model matrix; culling and
+     * picking keep using the plain model matrix and the float CPU copy.
+     */
+    [[nodiscard]] const glm::mat4& GetPositionDecode() const { return m_PositionDecode; }
+
+    // Meshes with fewer triangles are drawn whole; a single cluster would only add culling work
+    static constexpr uint32_t kMinMeshletTriangles = 2 * Meshlets::kMaxTriangles;
+
+    [[nodiscard]] const std::vector<Meshlet>& GetMeshlets() const { return m_Meshlets; }
+
+    // Counters of every culled Draw since the last reset (the scene resets them each frame)
+    static const MeshletStats& GetMeshletStats() { return s_MeshletStats; }
+    static void ResetMeshletStats() { s_MeshletStats = {}; }
+
     [[nodiscard]] unsigned int GetIndexCount() const { return indexCount; }
     
     // Add accessor methods for vertices and indices
@@ -42,15 +91,25 @@ private:
     // of raw OpenGL IDs
     unsigned int indexCount = 0;
     
-    // Store the mesh data for ray intersection and other operations
+    // Store the mesh data for ray intersection and other operations (the only CPU copy)
     std::vector<Vertex> m_Vertices;
     std::vector<unsigned int> m_Indices;
+    GeometryArena::Handle m_Geometry = GeometryArena::kInvalidHandle;
+    glm::mat4 m_PositionDecode{1.0f};
     
     // Bounds information
     glm::vec3 m_MinBounds = glm::vec3(std::numeric_limits<float>::max());
     glm::vec3 m_MaxBounds = glm::vec3(std::numeric_limits<float>::lowest());
     bool m_BoundsDirty = true;
 
+    // Clusters over m_Indices, which Initialize reorders so each one is contiguous
+    std::vector<Meshlet> m_Meshlets;
+    std::vector<MeshletRange> m_VisibleRanges;
+    std::vector<GLsizei> m_DrawCounts;
+    std::vector<const void*> m_DrawOffsets;
+    std::vector<GLint> m_DrawBaseVertices;
+    static MeshletStats s_MeshletStats;
+
 private:
 
     /////////////////////////
@@ -0,0 +1,295 @@
+#include "MeshOptimizer.h"
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <glm/glm.hpp>
+
+namespace {
+    // FNV-1a over a vertex's bytes
+    uint64_t HashBytes(const uint8_t* bytes, const size_t size) {
+        uint64_t hash = 14695981039346656037ull;
+        for (size_t i = 0; i < size; ++i) {
+            hash ^= bytes[i];
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    /**
+     * FIFO post-transform cache: a vertex is cached if it missed fewer than
+     * cacheSize misses ago and after the last Reset.
+     */
+    class FifoCache {
+    public:
+        FifoCache(const size_t vertexCount, const uint32_t cacheSize) : m_Stamps(vertexCount, 0), m_CacheSize(cacheSize) {}
+
+        // True on a miss (the vertex is transformed and enters the cache)
+        bool Access(const uint32_t vertex) {
+            const uint32_t stamp = m_Stamps[vertex];
+            if (stamp > m_ResetAt && m_Transforms - stamp < m_CacheSize) return false;
+            m_Stamps[vertex] = ++m_Transforms;
+            return true;
+        }
+
+        void Reset() { m_ResetAt = m_Transforms; }
+        [[nodiscard]] uint32_t GetTransforms() const { return m_Transforms; }
+
+    private:
+        std::vector<uint32_t> m_Stamps; // Miss count right after the vertex's last miss; 0 = never
+        uint32_t m_CacheSize;
+        uint32_t m_Transforms = 0;
+        uint32_t m_ResetAt = 0;
+    };
+
+    glm::vec3 Position(const float* positions, const uint32_t vertex, const size_t strideBytes) {
+        const auto* p = reinterpret_cast<const float*>(reinterpret_cast<const uint8_t*>(positions) + vertex * strideBytes);
+        return glm::vec3(p[0], p[1], p[2]);
+    }
+
+    // Tipsify's clusters, each split once the part so far has no more than maxAcmr starting cold
+    void SplitClusters(const uint32_t* indices, const size_t triangleCount, const size_t vertexCount,
+                       const std::vector<uint32_t>& clusters, const float maxAcmr, const uint32_t cacheSize,
+                       std::vector<uint32_t>& outStarts) {
+        outStarts.clear();
+        FifoCache cache(vertexCount, cacheSize);
+        for (size_t c = 0; c < clusters.size(); ++c) {
+            const uint32_t end = c + 1 < clusters.size() ? clusters[c + 1] : static_cast<uint32_t>(triangleCount);
+            uint32_t start = clusters[c];
+            uint32_t misses = 0;
+            outStarts.push_back(start);
+            cache.Reset();
+            for (uint32_t t = start; t < end; ++t) {
+                for (int k = 0; k < 3; ++k) misses += cache.Access(indices[t * 3 + k]);
+                const auto triangles = static_cast<float>(t - start + 1);
+                if (t + 1 < end && static_cast<float>(misses) <= maxAcmr * triangles) {
+                    start = t + 1;
+                    misses = 0;
+                    outStarts.push_back(start);
+                    cache.Reset();
+                }
+            }
+        }
+    }
+
+    // The parts starting at starts, far-out and outward-facing ones first
+    void SortClusters(const uint32_t* indices, const size_t triangleCount, const float* positions,
+                      const size_t strideBytes, const std::vector<uint32_t>& starts, std::vector<uint32_t>& outSorted) {
+        // Area-weighted centroid and normal of every cluster, and of the mesh
+        struct Cluster {
+            uint32_t start;
+            uint32_t end;
+            glm::vec3 centroid{0.0f};
+            glm::vec3 normal{0.0f};
+            float area = 0.0f;
+            float sortKey = 0.0f;
+        };
+        std::vector<Cluster> parts(starts.size());
+        glm::vec3 meshCentroid(0.0f);
+        float meshArea = 0.0f;
+        for (size_t i = 0; i < starts.size(); ++i) {
+            Cluster& part = parts[i];
+            part.start = starts[i];
+            part.end = i + 1 < starts.size() ? starts[i + 1] : static_cast<uint32_t>(triangleCount);
+            for (uint32_t t = part.start; t < part.end; ++t) {
+                const glm::vec3 a = Position(positions, indices[t * 3], strideBytes);
+                const glm::vec3 b = Position(positions, indices[t * 3 + 1], strideBytes);
+                const glm::vec3 c = Position(positions, indices[t * 3 + 2], strideBytes);
+                const glm::vec3 normal = glm::cross(b - a, c - a);
+                const float area = glm::length(normal);
+                part.normal += normal;
+                part.centroid += (a + b + c) * (area / 3.0f);
+                part.area += area;
+            }
+            meshCentroid += part.centroid;
+            meshArea += part.area;
+            if (part.area > 0.0f) part.centroid /= part.area;
+        }
+        if (meshArea > 0.0f) meshCentroid /= meshArea;
+
+        // Far out and facing outwards: likely in front of the rest from any view
+        for (Cluster& part : parts) {
+            const float length = glm::length(part.normal);
+            part.sortKey = length > 0.0f ? glm::dot(part.centroid - meshCentroid, part.normal / length) : 0.0f;
+        }
+        std::stable_sort(parts.begin(), parts.end(),
+                         [](const Cluster& a, const Cluster& b) { return a.sortKey > b.sortKey; });
+
+        outSorted.clear();
+        outSorted.reserve(triangleCount * 3);
+        for (const Cluster& part : parts) {
+            outSorted.insert(outSorted.end(), indices + part.start * 3, indices + part.end * 3);
+        }
+    }
+}
+
+namespace MeshOptimizer {
+
+size_t BuildWeldRemap(const void* vertices, const size_t vertexCount, const size_t strideBytes,
+                      std::vector<uint32_t>& outRemap) {
+    outRemap.assign(vertexCount, 0);
+    size_t tableSize = 1;
+    while (tableSize < vertexCount * 2) tableSize <<= 1;
+    const size_t mask = tableSize - 1;
+    // Open addressing; each entry is the first vertex seen with its bytes
+    std::vector<uint32_t> table(tableSize, UINT32_MAX);
+
+    const auto* bytes = static_cast<const uint8_t*>(vertices);
+    size_t distinct = 0;
+    for (size_t i = 0; i < vertexCount; ++i) {
+        const uint8_t* vertex = bytes + i * strideBytes;
+        size_t slot = HashBytes(vertex, strideBytes) & mask;
+        while (true) {
+            const uint32_t entry = table[slot];
+            if (entry == UINT32_MAX) {
+                table[slot] = static_cast<uint32_t>(i);
+                outRemap[i] = static_cast<uint32_t>(distinct++);
+                break;
+            }
+            if (std::memcmp(bytes + entry * strideBytes, vertex, strideBytes) == 0) {
+                outRemap[i] = outRemap[entry];
+                break;
+            }
+            slot = (slot + 1) & mask;
+        }
+    }
+    return distinct;
+}
+
+size_t BuildFetchRemap(const uint32_t* indices, const size_t indexCount, const size_t vertexCount,
+                       std::vector<uint32_t>& outRemap) {
+    outRemap.assign(vertexCount, UINT32_MAX);
+    uint32_t next = 0;
+    for (size_t i = 0; i < indexCount; ++i) {
+        if (outRemap[indices[i]] == UINT32_MAX) outRemap[indices[i]] = next++;
+    }
+    return next;
+}
+
+void RemapIndices(uint32_t* indices, const size_t indexCount, const std::vector<uint32_t>& remap) {
+    for (size_t i = 0; i < indexCount; ++i) indices[i] = remap[indices[i]];
+}
+
+void OptimizeVertexCache(uint32_t* indices, const size_t indexCount, const size_t vertexCount,
+                         std::vector<uint32_t>* outClusters, const uint32_t cacheSize) {
+    const size_t triangleCount = indexCount / 3;
+    if (outClusters) outClusters->assign(triangleCount > 0 ? 1 : 0, 0);
+    if (triangleCount == 0 || vertexCount == 0) return;
+
+    // Triangles around every vertex
+    std::vector<uint32_t> offsets(vertexCount + 1, 0);
+    for (size_t i = 0; i < triangleCount * 3; ++i) ++offsets[indices[i] + 1];
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    std::vector<uint32_t> adjacency(triangleCount * 3);
+    std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+    for (size_t i = 0; i < triangleCount * 3; ++i) adjacency[fill[indices[i]]++] = static_cast<uint32_t>(i / 3);
+
+    std::vector<uint32_t> live(vertexCount); // Triangles not yet emitted
+    for (size_t v = 0; v < vertexCount; ++v) live[v] = offsets[v + 1] - offsets[v];
+    std::vector<uint32_t> timestamps(vertexCount, 0);
+    std::vector<uint8_t> emitted(triangleCount, 0);
+    std::vector<uint32_t> deadEnd;
+    std::vector<uint32_t> candidates;
+    std::vector<uint32_t> output;
+    output.reserve(triangleCount * 3);
+    deadEnd.reserve(triangleCount * 3);
+
+    uint32_t time = cacheSize + 1;
+    size_t cursor = 0;
+    while (cursor < vertexCount && live[cursor] == 0) ++cursor;
+    int64_t fanning = static_cast<int64_t>(cursor);
+
+    while (fanning >= 0) {
+        // Emit every remaining triangle around the fanning vertex
+        candidates.clear();
+        const auto f = static_cast<uint32_t>(fanning);
+        for (uint32_t a = offsets[f]; a < offsets[f + 1]; ++a) {
+            const uint32_t triangle = adjacency[a];
+            if (emitted[triangle]) continue;
+            emitted[triangle] = 1;
+            for (int k = 0; k < 3; ++k) {
+                const uint32_t v = indices[triangle * 3 + k];
+                output.push_back(v);
+                deadEnd.push_back(v);
+                candidates.push_back(v);
+                --live[v];
+                if (time - timestamps[v] > cacheSize) timestamps[v] = time++;
+            }
+        }
+
+        // Next: the candidate that has been cached longest and still fits with its remaining triangles
+        int64_t next = -1;
+        int64_t best = -1;
+        for (const uint32_t v : candidates) {
+            if (live[v] == 0) continue;
+            int64_t priority = 0;
+            if (time - timestamps[v] + 2 * live[v] <= cacheSize) priority = time - timestamps[v];
+            if (priority > best) {
+                best = priority;
+                next = v;
+            }
+        }
+
+        if (next < 0) {
+            // Dead end: a recent vertex with triangles left, else the next one in index order
+            while (!deadEnd.empty() && next < 0) {
+                const uint32_t v = deadEnd.back();
+                deadEnd.pop_back();
+                if (live[v] > 0) next = v;
+            }
+            while (next < 0 && cursor < vertexCount) {
+                if (live[cursor] > 0) next = static_cast<int64_t>(cursor);
+                else ++cursor;
+            }
+            if (next >= 0 && outClusters) outClusters->push_back(static_cast<uint32_t>(output.size() / 3));
+        }
+        fanning = next;
+    }
+
+    std::copy(output.begin(), output.end(), indices);
+}
+
+void OptimizeOverdraw(uint32_t* indices, const size_t indexCount, const float* positions, const size_t vertexCount,
+                      const size_t strideBytes, const std::vector<uint32_t>& clusters, const float threshold,
+                      const uint32_t cacheSize) {
+    const size_t triangleCount = indexCount / 3;
+    if (triangleCount == 0 || clusters.empty()) return;
+
+    // Splitting only looks at each part on its own, so check what the sorted whole costs and
+    // split less until it fits; if Tipsify's own clusters do not, its order is kept
+    const float meshAcmr = AnalyzeVertexCache(indices, triangleCount * 3, vertexCount, cacheSize).acmr;
+    std::vector<uint32_t> starts;
+    std::vector<uint32_t> sorted;
+    for (float split = threshold;; split -= kOverdrawSplitStep) {
+        SplitClusters(indices, triangleCount, vertexCount, clusters, split * meshAcmr, cacheSize, starts);
+        SortClusters(indices, triangleCount, positions, strideBytes, starts, sorted);
+        if (AnalyzeVertexCache(sorted.data(), sorted.size(), vertexCount, cacheSize).acmr <= threshold * meshAcmr) {
+            std::copy(sorted.begin(), sorted.end(), indices);
+            return;
+        }
+        if (starts.size() == clusters.size()) return;
+    }
+}
+
+VertexCacheStats AnalyzeVertexCache(const uint32_t* indices, const size_t indexCount, const size_t vertexCount,
+                                    const uint32_t cacheSize) {
+    VertexCacheStats stats;
+    const size_t triangleCount = indexCount / 3;
+    if (triangleCount == 0) return stats;
+
+    FifoCache cache(vertexCount, cacheSize);
+    std::vector<uint8_t> referenced(vertexCount, 0);
+    size_t referencedCount = 0;
+    for (size_t i = 0; i < triangleCount * 3; ++i) {
+        cache.Access(indices[i]);
+        if (!referenced[indices[i]]) {
+            referenced[indices[i]] = 1;
+            ++referencedCount;
+        }
+    }
+    stats.transforms = cache.GetTransforms();
+    stats.acmr = static_cast<float>(stats.transforms) / static_cast<float>(triangleCount);
+    stats.atvr = static_cast<float>(stats.transforms) / static_cast<float>(referencedCount);
+    return stats;
+}
+
+} // namespace MeshOptimizer
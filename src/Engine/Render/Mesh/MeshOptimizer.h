@@ -0,0 +1,125 @@
+#ifndef MESH_OPTIMIZER_H
+#define MESH_OPTIMIZER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Post-transform vertex cache behaviour of an index buffer (FIFO simulation)
+ */
+struct VertexCacheStats {
+    uint32_t transforms = 0; // Cache misses: vertex shader invocations
+    float acmr = 0.0f;       // Average cache miss ratio: transforms per triangle (0.5 is ideal for grids, 3 is worst)
+    float atvr = 0.0f;       // Average transform to vertex ratio: transforms per referenced vertex (1 is ideal)
+};
+
+/**
+ * @brief Reorders a mesh for the GPU without changing what it looks like
+ *
+ * Mesh::Initialize runs every mesh through Optimize once, when it is created
+ * (primitives are created once per PrimitiveCache entry):
+ *  1. Weld: bitwise-identical vertices become one
+ *  2. Vertex cache: Tipsify (Sander, Nehab, Barczak 2007) triangle order for a FIFO cache
+ *  3. Overdraw: Tipsify's clusters, split where their own cache behaviour allows,
+ *     sorted so outward-facing clusters far from the centre draw first, as long as
+ *     the ACMR stays within kOverdrawThreshold of step 2's
+ *  4. Vertex fetch: vertices in the order the indices first use them
+ *
+ * Works on raw arrays so it stays free of GL; vertices are stride-separated.
+ */
+namespace MeshOptimizer {
+
+// Matches what the analysis models; real caches are similar or larger
+constexpr uint32_t kCacheSize = 16;
+// The overdraw order may make the mesh's ACMR up to this much worse than the cache order's
+constexpr float kOverdrawThreshold = 1.05f;
+// How much stricter each retry splits clusters when the sorted mesh missed that bound
+constexpr float kOverdrawSplitStep = 0.05f;
+
+/**
+ * @brief Map every vertex to the first vertex with the same bytes
+ *
+ * @param outRemap Old index -> new index, new indices dense in first-seen order
+ * @return Number of distinct vertices
+ */
+size_t BuildWeldRemap(const void* vertices, size_t vertexCount, size_t strideBytes, std::vector<uint32_t>& outRemap);
+
+/**
+ * @brief Map vertices to the order the indices first reference them; unreferenced ones get UINT32_MAX
+ *
+ * @return Number of referenced vertices
+ */
+size_t BuildFetchRemap(const uint32_t* indices, size_t indexCount, size_t vertexCount, std::vector<uint32_t>& outRemap);
+
+void RemapIndices(uint32_t* indices, size_t indexCount, const std::vector<uint32_t>& remap);
+
+// Moves vertex i to remap[i] and shrinks to newCount; UINT32_MAX entries are dropped
+template <typename V>
+void RemapVertices(std::vector<V>& vertices, const std::vector<uint32_t>& remap, const size_t newCount) {
+    std::vector<V> remapped(newCount);
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        if (remap[i] != UINT32_MAX) remapped[remap[i]] = vertices[i];
+    }
+    vertices.swap(remapped);
+}
+
+/**
+ * @brief Reorder triangles for the post-transform vertex cache (Tipsify)
+ *
+ * @param outClusters If set, the first triangle of each run Tipsify started at a
+ *                    dead end; OptimizeOverdraw sorts these
+ */
+void OptimizeVertexCache(uint32_t* indices, size_t indexCount, size_t vertexCount,
+                         std::vector<uint32_t>* outClusters = nullptr, uint32_t cacheSize = kCacheSize);
+
+/**
+ * @brief Reorder the clusters of OptimizeVertexCache to draw likely occluders first
+ *
+ * Clusters are split further wherever the part so far already has an ACMR
+ * within threshold of the whole mesh, then sorted by how far they face away
+ * from the mesh centroid, a view-independent guess at what covers what.
+ * If the sorted mesh's ACMR is more than threshold times the input's, the
+ * split is retried kOverdrawSplitStep stricter; once no cluster is split and
+ * the bound is still missed, the input order is kept.
+ *
+ * @param positions float3 positions with strideBytes between vertices
+ */
+void OptimizeOverdraw(uint32_t* indices, size_t indexCount, const float* positions, size_t vertexCount,
+                      size_t strideBytes, const std::vector<uint32_t>& clusters,
+                      float threshold = kOverdrawThreshold, uint32_t cacheSize = kCacheSize);
+
+[[nodiscard]] VertexCacheStats AnalyzeVertexCache(const uint32_t* indices, size_t indexCount, size_t vertexCount,
+                                                  uint32_t cacheSize = kCacheSize);
+
+// Step 4 alone; run it again after anything else reorders triangles (e.g. Meshlets::Build)
+template <typename V>
+void OptimizeVertexFetch(std::vector<V>& vertices, std::vector<uint32_t>& indices) {
+    std::vector<uint32_t> remap;
+    const size_t count = BuildFetchRemap(indices.data(), indices.size(), vertices.size(), remap);
+    RemapIndices(indices.data(), indices.size(), remap);
+    RemapVertices(vertices, remap, count);
+}
+
+/**
+ * @brief All four steps; V needs a glm::vec3 (or three floats) member called position
+ */
+template <typename V>
+void Optimize(std::vector<V>& vertices, std::vector<uint32_t>& indices) {
+    if (vertices.empty() || indices.size() < 3) return;
+
+    std::vector<uint32_t> remap;
+    const size_t welded = BuildWeldRemap(vertices.data(), vertices.size(), sizeof(V), remap);
+    RemapIndices(indices.data(), indices.size(), remap);
+    RemapVertices(vertices, remap, welded);
+
+    std::vector<uint32_t> clusters;
+    OptimizeVertexCache(indices.data(), indices.size(), vertices.size(), &clusters);
+    OptimizeOverdraw(indices.data(), indices.size(), &vertices[0].position.x, vertices.size(), sizeof(V), clusters);
+
+    OptimizeVertexFetch(vertices, indices);
+}
+
+} // namespace MeshOptimizer
+
+#endif // MESH_OPTIMIZER_H
@@ -0,0 +1,265 @@
+#include "Meshlet.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <unordered_map>
+
+namespace {
+    constexpr uint32_t kNone = 0xFFFFFFFFu;
+
+    // Weight of a candidate's normal deviation from the meshlet's average, in "new vertices"
+    constexpr float kConeWeight = 2.0f;
+
+    // Below this the normals spread past ~84 degrees and the cone cannot reject anything useful
+    constexpr float kMinConeDot = 0.1f;
+
+    glm::vec3 ReadVec3(const float* base, const size_t strideBytes, const uint32_t index) {
+        const auto* p = reinterpret_cast<const float*>(reinterpret_cast<const char*>(base) + index * strideBytes);
+        return {p[0], p[1], p[2]};
+    }
+
+    struct PositionKey {
+        uint32_t x, y, z;
+        bool operator==(const PositionKey&) const = default;
+    };
+
+    struct PositionKeyHash {
+        size_t operator()(const PositionKey& key) const {
+            return (key.x * 73856093u) ^ (key.y * 19349663u) ^ (key.z * 83492791u);
+        }
+    };
+
+    // Same id for vertices at the same position, so seams do not break adjacency
+    std::vector<uint32_t> WeldPositions(const float* positions, const size_t vertexCount, const size_t strideBytes) {
+        std::vector<uint32_t> positionIds(vertexCount);
+        std::unordered_map<PositionKey, uint32_t, PositionKeyHash> ids;
+        ids.reserve(vertexCount);
+        for (uint32_t v = 0; v < vertexCount; ++v) {
+            const glm::vec3 p = ReadVec3(positions, strideBytes, v);
+            PositionKey key{};
+            std::memcpy(&key.x, &p.x, sizeof(float));
+            std::memcpy(&key.y, &p.y, sizeof(float));
+            std::memcpy(&key.z, &p.z, sizeof(float));
+            positionIds[v] = ids.try_emplace(key, static_cast<uint32_t>(ids.size())).first->second;
+        }
+        return positionIds;
+    }
+
+    // Bounding sphere and normal cone over the meshlet's source triangles
+    void ComputeBounds(const float* positions, const size_t strideBytes, const uint32_t* indices,
+                       const std::vector<glm::vec3>& faceNormals, const std::vector<uint32_t>& triangles,
+                       Meshlet& meshlet) {
+        glm::vec3 min(std::numeric_limits<float>::max());
+        glm::vec3 max(std::numeric_limits<float>::lowest());
+        glm::vec3 normalSum(0.0f);
+        for (const uint32_t t : triangles) {
+            for (int k = 0; k < 3; ++k) {
+                const glm::vec3 p = ReadVec3(positions, strideBytes, indices[t * 3 + k]);
+                min = glm::min(min, p);
+                max = glm::max(max, p);
+            }
+            normalSum += faceNormals[t];
+        }
+
+        meshlet.center = (min + max) * 0.5f;
+        float radiusSquared = 0.0f;
+        for (const uint32_t t : triangles) {
+            for (int k = 0; k < 3; ++k) {
+                const glm::vec3 offset = ReadVec3(positions, strideBytes, indices[t * 3 + k]) - meshlet.center;
+                radiusSquared = std::max(radiusSquared, glm::dot(offset, offset));
+            }
+        }
+        meshlet.radius = std::sqrt(radiusSquared);
+
+        meshlet.coneCutoff = 1.0f;
+        const float normalLength = glm::length(normalSum);
+        if (normalLength <= std::numeric_limits<float>::epsilon()) return;
+        meshlet.coneAxis = normalSum / normalLength;
+
+        float minDot = 1.0f;
+        for (const uint32_t t : triangles) {
+            if (faceNormals[t] == glm::vec3(0.0f)) continue; // Degenerate triangles are never visible
+            minDot = std::min(minDot, glm::dot(meshlet.coneAxis, faceNormals[t]));
+        }
+        if (minDot > kMinConeDot) {
+            meshlet.coneCutoff = std::sqrt(1.0f - minDot * minDot);
+        }
+    }
+}
+
+namespace Meshlets {
+
+void Build(const float* positions, const float* normals, const size_t vertexCount, const size_t strideBytes,
+           const uint32_t* indices, const size_t indexCount,
+           std::vector<uint32_t>& outIndices, std::vector<Meshlet>& outMeshlets) {
+    outIndices.clear();
+    outMeshlets.clear();
+    const auto triangleCount = static_cast<uint32_t>(indexCount / 3);
+    if (triangleCount == 0 || vertexCount == 0) return;
+    outIndices.reserve(static_cast<size_t>(triangleCount) * 3);
+
+    std::vector<glm::vec3> faceNormals(triangleCount);
+    std::vector<glm::vec3> centroids(triangleCount);
+    for (uint32_t t = 0; t < triangleCount; ++t) {
+        const uint32_t* corner = indices + t * 3;
+        const glm::vec3 a = ReadVec3(positions, strideBytes, corner[0]);
+        const glm::vec3 b = ReadVec3(positions, strideBytes, corner[1]);
+        const glm::vec3 c = ReadVec3(positions, strideBytes, corner[2]);
+        centroids[t] = (a + b + c) / 3.0f;
+
+        glm::vec3 normal = glm::cross(b - a, c - a);
+        const float length = glm::length(normal);
+        if (length <= std::numeric_limits<float>::epsilon()) continue;
+        normal /= length;
+        if (normals) {
+            // Lighting follows the authored normals, so "back-facing" should too
+            const glm::vec3 authored = ReadVec3(normals, strideBytes, corner[0]) +
+                                       ReadVec3(normals, strideBytes, corner[1]) +
+                                       ReadVec3(normals, strideBytes, corner[2]);
+            if (glm::dot(normal, authored) < 0.0f) normal = -normal;
+        }
+        faceNormals[t] = normal;
+    }
+
+    // Position -> triangles, in compressed rows
+    const std::vector<uint32_t> positionIds = WeldPositions(positions, vertexCount, strideBytes);
+    const uint32_t positionCount = *std::max_element(positionIds.begin(), positionIds.end()) + 1;
+    std::vector<uint32_t> adjacencyOffsets(positionCount + 1, 0);
+    for (size_t i = 0; i < static_cast<size_t>(triangleCount) * 3; ++i) {
+        ++adjacencyOffsets[positionIds[indices[i]] + 1];
+    }
+    for (uint32_t p = 0; p < positionCount; ++p) {
+        adjacencyOffsets[p + 1] += adjacencyOffsets[p];
+    }
+    std::vector<uint32_t> adjacency(adjacencyOffsets.back());
+    std::vector<uint32_t> fill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+    for (uint32_t t = 0; t < triangleCount; ++t) {
+        for (int k = 0; k < 3; ++k) {
+            adjacency[fill[positionIds[indices[t * 3 + k]]]++] = t;
+        }
+    }
+
+    std::vector<uint8_t> emitted(triangleCount, 0);
+    std::vector<uint32_t> vertexMeshlet(vertexCount, kNone);       // Meshlet that already holds the vertex
+    std::vector<uint32_t> candidateMeshlet(triangleCount, kNone); // Meshlet whose candidate list holds the triangle
+    std::vector<uint32_t> candidates;
+    std::vector<uint32_t> meshletTriangles;
+    uint32_t seed = 0;
+
+    uint32_t emittedTriangles = 0;
+    while (emittedTriangles < triangleCount) {
+        // Lowest triangle left, so meshlets follow the input order of their first triangle
+        while (emitted[seed]) ++seed;
+
+        const auto meshletId = static_cast<uint32_t>(outMeshlets.size());
+        Meshlet meshlet;
+        meshlet.indexOffset = static_cast<uint32_t>(outIndices.size());
+        uint32_t vertices = 0;
+        uint32_t triangles = 0;
+        glm::vec3 normalSum(0.0f);
+        glm::vec3 centroidSum(0.0f);
+        candidates.clear();
+        meshletTriangles.clear();
+
+        uint32_t next = seed;
+        while (next != kNone) {
+            emitted[next] = 1;
+            meshletTriangles.push_back(next);
+            ++triangles;
+            normalSum += faceNormals[next];
+            centroidSum += centroids[next];
+            for (int k = 0; k < 3; ++k) {
+                const uint32_t index = indices[next * 3 + k];
+                if (vertexMeshlet[index] != meshletId) {
+                    vertexMeshlet[index] = meshletId;
+                    ++vertices;
+                }
+
+                const uint32_t position = positionIds[index];
+                for (uint32_t a = adjacencyOffsets[position]; a < adjacencyOffsets[position + 1]; ++a) {
+                    const uint32_t neighbour = adjacency[a];
+                    if (emitted[neighbour] || candidateMeshlet[neighbour] == meshletId) continue;
+                    // Unemitted triangles all come after the seed; far ones would break the input's cache reuse
+                    if (neighbour - seed >= Meshlets::kOrderWindow) continue;
+                    candidateMeshlet[neighbour] = meshletId;
+                    candidates.push_back(neighbour);
+                }
+            }
+            if (triangles == Meshlets::kMaxTriangles) break;
+
+            // Fewest new vertices first, then the closest normal, then the closest centroid
+            const float axisLength = glm::length(normalSum);
+            const glm::vec3 axis = axisLength > 0.0f ? normalSum / axisLength : glm::vec3(0.0f);
+            const glm::vec3 centroid = centroidSum / static_cast<float>(triangles);
+            next = kNone;
+            float bestScore = std::numeric_limits<float>::max();
+            float bestDistance = std::numeric_limits<float>::max();
+            size_t kept = 0;
+            for (const uint32_t candidate : candidates) {
+                if (emitted[candidate]) continue;
+
+                uint32_t newVertices = 0;
+                for (int k = 0; k < 3; ++k) {
+                    newVertices += vertexMeshlet[indices[candidate * 3 + k]] != meshletId;
+                }
+                // The meshlet only grows, so a triangle that does not fit now never will
+                if (vertices + newVertices > Meshlets::kMaxVertices) continue;
+                candidates[kept++] = candidate;
+
+                const float score = static_cast<float>(newVertices) +
+                                    kConeWeight * (1.0f - glm::dot(faceNormals[candidate], axis));
+                const glm::vec3 offset = centroids[candidate] - centroid;
+                const float distance = glm::dot(offset, offset);
+                if (score < bestScore || (score == bestScore && distance < bestDistance)) {
+                    bestScore = score;
+                    bestDistance = distance;
+                    next = candidate;
+                }
+            }
+            candidates.resize(kept);
+        }
+
+        // Input order inside the meshlet: keeps a cache-optimized mesh's locality
+        std::sort(meshletTriangles.begin(), meshletTriangles.end());
+        for (const uint32_t t : meshletTriangles) {
+            outIndices.insert(outIndices.end(), indices + t * 3, indices + t * 3 + 3);
+        }
+        emittedTriangles += triangles;
+        meshlet.indexCount = triangles * 3;
+        ComputeBounds(positions, strideBytes, indices, faceNormals, meshletTriangles, meshlet);
+        outMeshlets.push_back(meshlet);
+    }
+}
+
+bool IsVisible(const Meshlet& meshlet, const Math::Frustum& frustum, const glm::vec3& eye) {
+    if (!frustum.IntersectsSphere(meshlet.center, meshlet.radius)) return false;
+
+    // Every triangle faces away if the eye lies inside the negated cone, widened by the sphere
+    const glm::vec3 toCenter = meshlet.center - eye;
+    return glm::dot(toCenter, meshlet.coneAxis) < meshlet.coneCutoff * glm::length(toCenter) + meshlet.radius;
+}
+
+void Cull(const std::span<const Meshlet> meshlets, const Math::Frustum& frustum, const glm::vec3& eye,
+          std::vector<MeshletRange>& outRanges, MeshletStats& stats) {
+    const size_t firstRange = outRanges.size();
+    for (const Meshlet& meshlet : meshlets) {
+        stats.triangles += meshlet.indexCount / 3;
+        if (!IsVisible(meshlet, frustum, eye)) continue;
+
+        ++stats.visibleMeshlets;
+        stats.visibleTriangles += meshlet.indexCount / 3;
+        if (outRanges.size() > firstRange) {
+            MeshletRange& last = outRanges.back();
+            if (last.indexOffset + last.indexCount == meshlet.indexOffset) {
+                last.indexCount += meshlet.indexCount;
+                continue;
+            }
+        }
+        outRanges.push_back({meshlet.indexOffset, meshlet.indexCount});
+    }
+    stats.meshlets += static_cast<uint32_t>(meshlets.size());
+    stats.draws += static_cast<uint32_t>(outRanges.size() - firstRange);
+}
+
+} // namespace Meshlets
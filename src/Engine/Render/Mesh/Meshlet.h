@@ -0,0 +1,103 @@
+#ifndef MESHLET_H
+#define MESHLET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+#include <glm/glm.hpp>
+#include "Core/Math/Frustum.h"
+#include "MeshOptimizer.h"
+
+/**
+ * @brief A small cluster of a mesh's triangles with its own culling bounds
+ *
+ * Everything is in mesh (local) space. The triangles are indices
+ * [indexOffset, indexOffset + indexCount) of the mesh's reordered index buffer.
+ */
+struct Meshlet {
+    glm::vec3 center{0.0f}; // Bounding sphere
+    float radius = 0.0f;
+    glm::vec3 coneAxis{0.0f, 0.0f, 1.0f}; // Average facing direction
+    float coneCutoff = 1.0f;              // Sine of the normal spread; 1 never backface culls
+    uint32_t indexOffset = 0;
+    uint32_t indexCount = 0;
+};
+
+/**
+ * @brief Contiguous run of visible meshlets, in indices
+ */
+struct MeshletRange {
+    uint32_t indexOffset = 0;
+    uint32_t indexCount = 0;
+};
+
+/**
+ * @brief Triangles and draws of the meshes drawn since the last reset
+ */
+struct MeshletStats {
+    uint32_t meshlets = 0;
+    uint32_t visibleMeshlets = 0;
+    uint32_t triangles = 0;        // Of every mesh drawn
+    uint32_t visibleTriangles = 0; // Actually submitted
+    uint32_t draws = 0;            // Sub-draws after merging neighbouring meshlets
+};
+
+namespace Meshlets {
+
+constexpr uint32_t kMaxTriangles = 124;
+constexpr uint32_t kMaxVertices = 64;
+// A meshlet only takes triangles this close after its first one in input order
+constexpr uint32_t kOrderWindow = 64;
+
+/**
+ * @brief Split an indexed triangle list into meshlets
+ *
+ * Meshlets grow greedily over triangles that share a position with the
+ * meshlet, preferring ones that add few new vertices and face the same way,
+ * so the normal cones stay narrow. Seams with split normals or UVs still
+ * count as connected. Each meshlet starts at the first triangle left and only
+ * takes triangles within kOrderWindow of it, so a cache-optimized input order
+ * (MeshOptimizer::Optimize) keeps its ACMR.
+ *
+ * @param normals Vertex normals with the same stride as positions; face normals
+ *                are flipped to agree with them. nullptr trusts counter-clockwise winding.
+ * @param outIndices The same triangles reordered so every meshlet is contiguous,
+ *                   in input order within each meshlet
+ */
+void Build(const float* positions, const float* normals, size_t vertexCount, size_t strideBytes,
+           const uint32_t* indices, size_t indexCount,
+           std::vector<uint32_t>& outIndices, std::vector<Meshlet>& outMeshlets);
+
+/**
+ * @brief Build on a mesh's own buffers, then put its vertices back in fetch order
+ *
+ * What Mesh::Initialize runs after MeshOptimizer::Optimize; V needs glm::vec3
+ * position and normal members.
+ */
+template <typename V>
+void BuildInPlace(std::vector<V>& vertices, std::vector<uint32_t>& indices, std::vector<Meshlet>& outMeshlets) {
+    const std::vector<uint32_t> ordered = std::move(indices);
+    Build(&vertices[0].position.x, &vertices[0].normal.x, vertices.size(), sizeof(V),
+          ordered.data(), ordered.size(), indices, outMeshlets);
+    // Meshlets only keep index ranges, so vertices can follow the new triangle order
+    MeshOptimizer::OptimizeVertexFetch(vertices, indices);
+}
+
+/**
+ * @brief True if any part of the meshlet can be front-facing inside the frustum
+ *
+ * @param frustum Frustum in mesh space, e.g. built from viewProjection * model
+ * @param eye Camera position in mesh space
+ */
+[[nodiscard]] bool IsVisible(const Meshlet& meshlet, const Math::Frustum& frustum, const glm::vec3& eye);
+
+/**
+ * @brief Append the visible meshlets as ranges, merging neighbours that are contiguous
+ */
+void Cull(std::span<const Meshlet> meshlets, const Math::Frustum& frustum, const glm::vec3& eye,
+          std::vector<MeshletRange>& outRanges, MeshletStats& stats);
+
+} // namespace Meshlets
+
+#endif // MESHLET_H
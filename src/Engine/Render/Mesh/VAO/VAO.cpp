@@ -1,4 +1,5 @@
 #include"VAO.h"
+#include "Engine/Render/State/GLStateCache.h"
 
 VAO::VAO()
 {
@@ -15,16 +16,17 @@ void VAO::LinkAttrib(VBO& VBO, GLuint layout, GLuint numComponents, GLenum type,
 }
 void VAO::Bind()
 {
-    // Bind the VAO
-    glBindVertexArray(ID);
+    // Bind the VAO (skipped if it is already bound)
+    GLStateCache::GetInstance().BindVertexArray(ID);
 }
 void VAO::Unbind()
 {
     // Unbind the VAO
-    glBindVertexArray(0);
+    GLStateCache::GetInstance().BindVertexArray(0);
 }
 void VAO::Delete()
 {
     // Delete the VAO
+    GLStateCache::GetInstance().ForgetVertexArray(ID);
     glDeleteVertexArrays(1, &ID);
 }
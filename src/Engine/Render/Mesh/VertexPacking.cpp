@@ -0,0 +1,142 @@
+#include "VertexPacking.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace {
+    float SignNotZero(const float value) { return value >= 0.0f ? 1.0f : -1.0f; }
+
+    int16_t ToSnorm16(const float value) {
+        return static_cast<int16_t>(std::lround(std::clamp(value, -1.0f, 1.0f) * 32767.0f));
+    }
+
+    uint16_t ToUnorm16(const float value) {
+        return static_cast<uint16_t>(std::lround(std::clamp(value, 0.0f, 1.0f) * 65535.0f));
+    }
+
+    const float* Advance(const float* base, const size_t index, const size_t strideBytes) {
+        return reinterpret_cast<const float*>(reinterpret_cast<const uint8_t*>(base) + index * strideBytes);
+    }
+
+    void PackAttributes(const float* normal, const float* texCoords, int16_t outNormal[2], uint16_t outTexCoords[2]) {
+        const glm::vec2 encoded = VertexPacking::OctEncode(glm::vec3(normal[0], normal[1], normal[2]));
+        outNormal[0] = ToSnorm16(encoded.x);
+        outNormal[1] = ToSnorm16(encoded.y);
+        outTexCoords[0] = VertexPacking::ToHalf(texCoords[0]);
+        outTexCoords[1] = VertexPacking::ToHalf(texCoords[1]);
+    }
+}
+
+namespace VertexPacking {
+
+size_t Stride(const VertexFormat format) {
+    return format == VertexFormat::Quantized ? sizeof(QuantizedVertex) : sizeof(CompactVertex);
+}
+
+glm::vec2 OctEncode(const glm::vec3& normal) {
+    const float length = std::abs(normal.x) + std::abs(normal.y) + std::abs(normal.z);
+    if (length == 0.0f) return glm::vec2(0.0f); // Decodes to +Z
+    const glm::vec3 n = normal / length;
+    if (n.z >= 0.0f) return glm::vec2(n.x, n.y);
+    // Lower hemisphere folds over the diagonals
+    return glm::vec2((1.0f - std::abs(n.y)) * SignNotZero(n.x), (1.0f - std::abs(n.x)) * SignNotZero(n.y));
+}
+
+glm::vec3 OctDecode(const glm::vec2& encoded) {
+    glm::vec3 n(encoded.x, encoded.y, 1.0f - std::abs(encoded.x) - std::abs(encoded.y));
+    if (n.z < 0.0f) {
+        const float x = n.x;
+        n.x = (1.0f - std::abs(n.y)) * SignNotZero(x);
+        n.y = (1.0f - std::abs(x)) * SignNotZero(n.y);
+    }
+    return glm::normalize(n);
+}
+
+uint16_t ToHalf(const float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    const auto sign = static_cast<uint16_t>((bits >> 16) & 0x8000u);
+    const uint32_t floatExponent = (bits >> 23) & 0xFFu;
+    uint32_t mantissa = bits & 0x7FFFFFu;
+
+    if (floatExponent == 0xFFu) return static_cast<uint16_t>(sign | 0x7C00u | (mantissa ? 0x200u : 0u)); // Inf, NaN
+    const int exponent = static_cast<int>(floatExponent) - 127 + 15;
+    if (exponent >= 31) return static_cast<uint16_t>(sign | 0x7C00u); // Too large: infinity
+    if (exponent <= 0) {
+        // Subnormal half, or zero when even that is too small
+        if (exponent < -10) return sign;
+        mantissa |= 0x800000u;
+        const int shift = 14 - exponent;
+        uint32_t half = mantissa >> shift;
+        if ((mantissa >> (shift - 1)) & 1u) ++half;
+        return static_cast<uint16_t>(sign | half);
+    }
+    uint32_t half = (static_cast<uint32_t>(exponent) << 10) | (mantissa >> 13);
+    if (mantissa & 0x1000u) ++half; // Round to nearest; a carry into the exponent is still correct
+    return static_cast<uint16_t>(sign | half);
+}
+
+float FromHalf(const uint16_t half) {
+    const uint32_t sign = static_cast<uint32_t>(half & 0x8000u) << 16;
+    const uint32_t exponent = (half >> 10) & 0x1Fu;
+    const uint32_t mantissa = half & 0x3FFu;
+
+    if (exponent == 0) {
+        const float value = std::ldexp(static_cast<float>(mantissa), -24);
+        return sign ? -value : value;
+    }
+    uint32_t bits;
+    if (exponent == 31) bits = sign | 0x7F800000u | (mantissa << 13);
+    else bits = sign | ((exponent - 15 + 127) << 23) | (mantissa << 13);
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+glm::mat4 PositionDecode(const VertexFormat format, const glm::vec3& boundsMin, const glm::vec3& boundsMax) {
+    glm::mat4 decode(1.0f);
+    if (format != VertexFormat::Quantized) return decode;
+    const glm::vec3 extent = boundsMax - boundsMin;
+    // A flat axis quantizes to 0 whatever the scale; keep the matrix invertible
+    for (int axis = 0; axis < 3; ++axis) decode[axis][axis] = extent[axis] > 0.0f ? extent[axis] : 1.0f;
+    decode[3] = glm::vec4(boundsMin, 1.0f);
+    return decode;
+}
+
+void Pack(const VertexFormat format, const float* positions, const float* normals, const float* texCoords,
+          const size_t vertexCount, const size_t strideBytes, const glm::vec3& boundsMin, const glm::vec3& boundsMax,
+          std::vector<uint8_t>& out) {
+    const size_t stride = Stride(format);
+    const size_t start = out.size();
+    out.resize(start + vertexCount * stride);
+    uint8_t* target = out.data() + start;
+
+    const glm::vec3 extent = boundsMax - boundsMin;
+    for (size_t i = 0; i < vertexCount; ++i, target += stride) {
+        const float* position = Advance(positions, i, strideBytes);
+        const float* normal = Advance(normals, i, strideBytes);
+        const float* uv = Advance(texCoords, i, strideBytes);
+
+        if (format == VertexFormat::Quantized) {
+            QuantizedVertex vertex{};
+            for (int axis = 0; axis < 3; ++axis) {
+                const float relative = extent[axis] > 0.0f ? (position[axis] - boundsMin[axis]) / extent[axis] : 0.0f;
+                vertex.position[axis] = ToUnorm16(relative);
+            }
+            PackAttributes(normal, uv, vertex.normal, vertex.texCoords);
+            std::memcpy(target, &vertex, sizeof(vertex));
+        } else {
+            CompactVertex vertex{};
+            std::copy_n(position, 3, vertex.position);
+            PackAttributes(normal, uv, vertex.normal, vertex.texCoords);
+            std::memcpy(target, &vertex, sizeof(vertex));
+        }
+    }
+}
+
+void NarrowIndices(const uint32_t* indices, const size_t indexCount, std::vector<uint16_t>& out) {
+    out.resize(indexCount);
+    for (size_t i = 0; i < indexCount; ++i) out[i] = static_cast<uint16_t>(indices[i]);
+}
+
+} // namespace VertexPacking
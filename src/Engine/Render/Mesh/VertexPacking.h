@@ -0,0 +1,71 @@
+#ifndef VERTEX_PACKING_H
+#define VERTEX_PACKING_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <glm/glm.hpp>
+
+/**
+ * @brief How GeometryArena stores vertices on the GPU (the CPU copy in Mesh stays 32-byte Vertex)
+ */
+enum class VertexFormat : uint8_t {
+    Compact,   // Float position, octahedral normal, half-float UV: 20 bytes
+    Quantized, // As Compact, but 16-bit positions relative to the mesh bounds: 16 bytes
+};
+
+// Normals are octahedral-encoded snorm16 pairs, texture coordinates half floats
+struct CompactVertex {
+    float position[3];
+    int16_t normal[2];
+    uint16_t texCoords[2];
+};
+
+struct QuantizedVertex {
+    uint16_t position[4]; // unorm16 over the mesh bounds; the fourth keeps the next attribute 4-byte aligned
+    int16_t normal[2];
+    uint16_t texCoords[2];
+};
+
+static_assert(sizeof(CompactVertex) == 20 && sizeof(QuantizedVertex) == 16, "GPU vertex layouts are fixed");
+
+namespace VertexPacking {
+
+// Meshes with at most this many vertices get 16-bit indices (relative to their base vertex)
+constexpr size_t kMaxShortIndexVertices = 65536;
+
+[[nodiscard]] size_t Stride(VertexFormat format);
+
+// Unit vector to a point of the [-1, 1] square, and back (normalized)
+[[nodiscard]] glm::vec2 OctEncode(const glm::vec3& normal);
+[[nodiscard]] glm::vec3 OctDecode(const glm::vec2& encoded);
+
+[[nodiscard]] uint16_t ToHalf(float value);
+[[nodiscard]] float FromHalf(uint16_t half);
+
+/**
+ * @brief Matrix taking decoded positions back to mesh space
+ *
+ * Quantized positions reach the shader as [0, 1] (normalized attribute), so
+ * this is a translate to boundsMin and a scale by the extent; folded into the
+ * model matrix it costs the shader nothing. Identity for Compact.
+ */
+[[nodiscard]] glm::mat4 PositionDecode(VertexFormat format, const glm::vec3& boundsMin, const glm::vec3& boundsMax);
+
+/**
+ * @brief Append vertexCount vertices in the given format to out
+ *
+ * @param normals, texCoords Same stride as positions
+ */
+void Pack(VertexFormat format, const float* positions, const float* normals, const float* texCoords,
+          size_t vertexCount, size_t strideBytes, const glm::vec3& boundsMin, const glm::vec3& boundsMax,
+          std::vector<uint8_t>& out);
+
+[[nodiscard]] inline bool UsesShortIndices(const size_t vertexCount) { return vertexCount <= kMaxShortIndexVertices; }
+
+// Only valid when UsesShortIndices holds for the mesh the indices belong to
+void NarrowIndices(const uint32_t* indices, size_t indexCount, std::vector<uint16_t>& out);
+
+} // namespace VertexPacking
+
+#endif // VERTEX_PACKING_H
@@ -0,0 +1,164 @@
+#include <glad/glad.h>
+#include "ObjectPicker.h"
+#include "Engine/Render/State/GLStateCache.h"
+#include <iostream>
+
+ObjectPicker::~ObjectPicker() {
+    Cleanup();
+}
+
+void ObjectPicker::Initialize(const unsigned int framebufferID, const int width, const int height) {
+    Cleanup();
+    m_FramebufferID = framebufferID;
+
+    GLStateCache& state = GLStateCache::GetInstance();
+    glGenTextures(1, &m_TextureID);
+    Resize(width, height);
+    state.BindTexture(0, GL_TEXTURE_2D, m_TextureID);
+    // Integer textures cannot be filtered
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    state.BindTexture(0, GL_TEXTURE_2D, 0);
+
+    // Draw and read binding both end up as before: the caller's framebuffer is bound to both
+    const unsigned int previousFramebuffer = state.GetReadFramebuffer();
+    state.BindFramebuffer(GL_FRAMEBUFFER, m_FramebufferID);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + kAttachment, GL_TEXTURE_2D, m_TextureID, 0);
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+        std::cout << "ERROR: Object ID framebuffer attachment not complete!" << std::endl;
+    state.BindFramebuffer(GL_FRAMEBUFFER, previousFramebuffer);
+
+    for (Slot& slot : m_Slots) {
+        glGenBuffers(1, &slot.buffer);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+        glBufferData(GL_PIXEL_PACK_BUFFER, sizeof(uint32_t), nullptr, GL_STREAM_READ);
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+}
+
+void ObjectPicker::Resize(const int width, const int height) {
+    if (m_TextureID == 0 || width <= 0 || height <= 0) return;
+
+    // Pixels requested from the old buffer no longer match the picture on screen
+    for (Slot& slot : m_Slots) ReleaseFence(slot);
+    m_Head = 0;
+    m_InFlight = 0;
+    m_HoveredID = 0;
+
+    m_Width = width;
+    m_Height = height;
+    GLStateCache::GetInstance().BindTexture(0, GL_TEXTURE_2D, m_TextureID);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_R32UI, width, height, 0, GL_RED_INTEGER, GL_UNSIGNED_INT, nullptr);
+    GLStateCache::GetInstance().BindTexture(0, GL_TEXTURE_2D, 0);
+}
+
+void ObjectPicker::BeginPass() const {
+    if (m_TextureID == 0) return;
+
+    constexpr GLenum drawBuffers[] = {GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT0 + kAttachment};
+    glDrawBuffers(2, drawBuffers);
+
+    // glClear is undefined for integer attachments; 0 is "no object"
+    constexpr GLuint clearID[4] = {0, 0, 0, 0};
+    glClearBufferuiv(GL_COLOR, static_cast<GLint>(kAttachment), clearID);
+}
+
+void ObjectPicker::EndPass() {
+    constexpr GLenum drawBuffer = GL_COLOR_ATTACHMENT0;
+    glDrawBuffers(1, &drawBuffer);
+}
+
+bool ObjectPicker::RequestPick(const int x, const int y, const PickRequestType type) {
+    if (m_TextureID == 0) return false;
+    if (x < 0 || y < 0 || x >= m_Width || y >= m_Height) return false;
+
+    // Hover never takes the last slot so a click can always be issued right away
+    const int limit = type == PickRequestType::Hover ? kRingSize - 1 : kRingSize;
+    if (m_InFlight >= limit) return false;
+
+    Slot& slot = m_Slots[(m_Head + m_InFlight) % kRingSize];
+    slot.request = PickResult{type, x, y, 0};
+
+    // Usually already bound: picks are requested while the scene framebuffer is current
+    GLStateCache& state = GLStateCache::GetInstance();
+    const unsigned int previousReadFramebuffer = state.GetReadFramebuffer();
+    state.BindFramebuffer(GL_READ_FRAMEBUFFER, m_FramebufferID);
+    glReadBuffer(GL_COLOR_ATTACHMENT0 + kAttachment);
+
+    // With a pack buffer bound the copy is queued on the GPU and returns immediately
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+    glReadPixels(x, y, 1, 1, GL_RED_INTEGER, GL_UNSIGNED_INT, nullptr);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+    glReadBuffer(GL_COLOR_ATTACHMENT0);
+    state.BindFramebuffer(GL_READ_FRAMEBUFFER, previousReadFramebuffer);
+
+    ++m_InFlight;
+    return true;
+}
+
+void ObjectPicker::Update() {
+    while (m_InFlight > 0) {
+        Slot& slot = m_Slots[m_Head];
+
+        // Zero timeout: only poll, results wait for a later frame rather than stalling this one
+        const GLenum status = glClientWaitSync(static_cast<GLsync>(slot.fence), 0, 0);
+        if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) break;
+        ReleaseFence(slot);
+
+        PickResult result = slot.request;
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+        if (const auto* data = static_cast<const uint32_t*>(
+                glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, sizeof(uint32_t), GL_MAP_READ_BIT))) {
+            result.instanceID = *data;
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        if (result.type == PickRequestType::Click) {
+            m_ClickResult = result;
+        } else {
+            m_HoveredID = result.instanceID;
+        }
+
+        m_Head = (m_Head + 1) % kRingSize;
+        --m_InFlight;
+    }
+}
+
+std::optional<PickResult> ObjectPicker::TakeClickResult() {
+    std::optional<PickResult> result = m_ClickResult;
+    m_ClickResult.reset();
+    return result;
+}
+
+void ObjectPicker::ReleaseFence(Slot& slot) {
+    if (slot.fence) {
+        glDeleteSync(static_cast<GLsync>(slot.fence));
+        slot.fence = nullptr;
+    }
+}
+
+void ObjectPicker::Cleanup() {
+    for (Slot& slot : m_Slots) {
+        ReleaseFence(slot);
+        if (slot.buffer != 0) {
+            glDeleteBuffers(1, &slot.buffer);
+            slot.buffer = 0;
+        }
+    }
+    m_Head = 0;
+    m_InFlight = 0;
+    m_ClickResult.reset();
+    m_HoveredID = 0;
+
+    if (m_TextureID != 0) {
+        GLStateCache::GetInstance().ForgetTexture(m_TextureID);
+        glDeleteTextures(1, &m_TextureID);
+        m_TextureID = 0;
+    }
+    m_FramebufferID = 0;
+    m_Width = 0;
+    m_Height = 0;
+}
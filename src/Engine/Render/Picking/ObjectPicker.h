@@ -0,0 +1,124 @@
+#ifndef OBJECT_PICKER_H
+#define OBJECT_PICKER_H
+
+#include <array>
+#include <cstdint>
+#include <optional>
+
+/**
+ * @brief Kind of pick request; clicks may take the last free readback slot, hover may not
+ */
+enum class PickRequestType {
+    Click,
+    Hover
+};
+
+/**
+ * @brief Instance id read back for one pick request (0 means nothing was drawn there)
+ */
+struct PickResult {
+    PickRequestType type = PickRequestType::Click;
+    int x = 0;
+    int y = 0;
+    uint32_t instanceID = 0;
+};
+
+/**
+ * @brief GPU object-ID buffer picking with asynchronous readback
+ *
+ * Owns an R32UI texture that is attached to a framebuffer as color attachment 1.
+ * Shaders write the drawn object's GameObject::GetInstanceID() to output location 1
+ * during the main pass. A pick copies one texel into a pixel buffer object and
+ * drops a fence; Update() maps the buffer only once its fence has signalled, so
+ * glReadPixels never waits for the GPU. A ring of kRingSize buffers lets a click
+ * and hover requests be in flight at the same time. Results arrive a frame or two
+ * after the request, in request order.
+ *
+ * Usage per frame: Update, (bind framebuffer) BeginPass, draw, EndPass, RequestPick...
+ */
+class ObjectPicker {
+public:
+    static constexpr int kRingSize = 3;
+    static constexpr unsigned int kAttachment = 1; // GL_COLOR_ATTACHMENT0 + kAttachment
+
+    ObjectPicker() = default;
+    ~ObjectPicker();
+
+    ObjectPicker(const ObjectPicker&) = delete;
+    ObjectPicker& operator=(const ObjectPicker&) = delete;
+
+    /**
+     * @brief Create the ID texture and readback buffers and attach to a framebuffer
+     *
+     * @param framebufferID Framebuffer that receives the ID texture as color attachment 1
+     */
+    void Initialize(unsigned int framebufferID, int width, int height);
+
+    /**
+     * @brief Reallocate the ID texture; requests still in flight are dropped
+     */
+    void Resize(int width, int height);
+
+    /**
+     * @brief Enable the ID attachment and clear it to 0 (framebuffer must be bound)
+     */
+    void BeginPass() const;
+
+    /**
+     * @brief Restrict drawing to color attachment 0 again (overlays must not write IDs)
+     */
+    static void EndPass();
+
+    /**
+     * @brief Queue an asynchronous read of one pixel of the ID buffer
+     *
+     * @param x Pixel column, GL convention (0 = left)
+     * @param y Pixel row, GL convention (0 = bottom)
+     * @return false when no readback slot is free or the pixel is outside the buffer
+     */
+    bool RequestPick(int x, int y, PickRequestType type);
+
+    /**
+     * @brief Collect every request whose fence has signalled (non-blocking)
+     */
+    void Update();
+
+    /**
+     * @brief The most recent finished click, if any; cleared by this call
+     */
+    std::optional<PickResult> TakeClickResult();
+
+    /**
+     * @brief Instance id under the cursor from the most recent finished hover request
+     */
+    [[nodiscard]] uint32_t GetHoveredID() const { return m_HoveredID; }
+
+    [[nodiscard]] bool IsInitialized() const { return m_TextureID != 0; }
+    [[nodiscard]] int GetInFlightCount() const { return m_InFlight; }
+
+    void Cleanup();
+
+private:
+    struct Slot {
+        unsigned int buffer = 0;
+        void* fence = nullptr; // GLsync
+        PickResult request;
+    };
+
+    void ReleaseFence(Slot& slot);
+
+    unsigned int m_FramebufferID = 0;
+    unsigned int m_TextureID = 0;
+    int m_Width = 0;
+    int m_Height = 0;
+
+    // Ring of readback slots; m_Head is the oldest in-flight request
+    std::array<Slot, kRingSize> m_Slots{};
+    int m_Head = 0;
+    int m_InFlight = 0;
+
+    std::optional<PickResult> m_ClickResult;
+    uint32_t m_HoveredID = 0;
+};
+
+#endif // OBJECT_PICKER_H
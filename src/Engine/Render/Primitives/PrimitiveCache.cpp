@@ -0,0 +1,70 @@
+#include "PrimitiveCache.h"
+#include "Primitives.h"
+#include <cstring>
+#include <functional>
+
+PrimitiveCache& PrimitiveCache::GetInstance() {
+    static PrimitiveCache instance;
+    return instance;
+}
+
+size_t PrimitiveCache::KeyHash::operator()(const Key& key) const {
+    uint32_t a = 0;
+    uint32_t b = 0;
+    std::memcpy(&a, &key.a, sizeof(a));
+    std::memcpy(&b, &key.b, sizeof(b));
+    size_t hash = std::hash<uint32_t>{}(a);
+    hash = hash * 31 + std::hash<uint32_t>{}(b);
+    hash = hash * 31 + std::hash<int>{}(key.segments);
+    return hash * 31 + static_cast<size_t>(key.type);
+}
+
+template <typename Create>
+std::shared_ptr<Mesh> PrimitiveCache::GetOrCreate(const Key& key, Create create) {
+    std::weak_ptr<Mesh>& entry = m_Meshes[key];
+    if (auto mesh = entry.lock()) {
+        ++m_Stats.hits;
+        return mesh;
+    }
+
+    ++m_Stats.misses;
+    auto mesh = create();
+    entry = mesh;
+    return mesh;
+}
+
+std::shared_ptr<Mesh> PrimitiveCache::GetCube(const float size) {
+    return GetOrCreate({Type::Cube, size, 0.0f, 0}, [&] { return Primitives::CreateCube(size); });
+}
+
+std::shared_ptr<Mesh> PrimitiveCache::GetSphere(const float radius, const int segments) {
+    return GetOrCreate({Type::Sphere, radius, 0.0f, segments},
+                       [&] { return Primitives::CreateSphere(radius, segments); });
+}
+
+std::shared_ptr<Mesh> PrimitiveCache::GetPlane(const float width, const float depth, const int subdivisions) {
+    return GetOrCreate({Type::Plane, width, depth, subdivisions},
+                       [&] { return Primitives::CreatePlane(width, depth, subdivisions); });
+}
+
+std::shared_ptr<Mesh> PrimitiveCache::GetQuad(const float width, const float height) {
+    return GetOrCreate({Type::Quad, width, height, 0}, [&] { return Primitives::CreateQuad(width, height); });
+}
+
+std::shared_ptr<Mesh> PrimitiveCache::GetCylinder(const float radius, const float height, const int segments) {
+    return GetOrCreate({Type::Cylinder, radius, height, segments},
+                       [&] { return Primitives::CreateCylinder(radius, height, segments); });
+}
+
+std::shared_ptr<Mesh> PrimitiveCache::GetCapsule(const float radius, const float height, const int segments) {
+    return GetOrCreate({Type::Capsule, radius, height, segments},
+                       [&] { return Primitives::CreateCapsule(radius, height, segments); });
+}
+
+size_t PrimitiveCache::GetMeshCount() const {
+    size_t count = 0;
+    for (const auto& [key, mesh] : m_Meshes) {
+        count += !mesh.expired();
+    }
+    return count;
+}
@@ -0,0 +1,73 @@
+#ifndef PRIMITIVE_CACHE_H
+#define PRIMITIVE_CACHE_H
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include "Engine/Render/Mesh/Mesh.h"
+
+/**
+ * @brief Hit/miss counters of the primitive cache
+ */
+struct PrimitiveCacheStats {
+    uint32_t hits = 0;
+    uint32_t misses = 0; // Meshes generated and uploaded
+};
+
+/**
+ * @brief Shared GPU meshes for the built-in primitives
+ *
+ * Objects asking for the same primitive with the same parameters get the same
+ * Mesh, so vertices are generated and uploaded once per distinct primitive
+ * instead of once per object. Sharing the mesh also lets those objects be
+ * drawn instanced. The cache only holds weak references: a mesh is freed
+ * when its last user goes away and rebuilt on the next request.
+ *
+ * Cached meshes are shared and must not be modified; use Primitives::Create*
+ * for a private copy.
+ */
+class PrimitiveCache {
+public:
+    static PrimitiveCache& GetInstance();
+
+    PrimitiveCache(const PrimitiveCache&) = delete;
+    PrimitiveCache& operator=(const PrimitiveCache&) = delete;
+
+    // Same parameters and defaults as the Primitives::Create* functions
+    std::shared_ptr<Mesh> GetCube(float size = 1.0f);
+    std::shared_ptr<Mesh> GetSphere(float radius = 0.5f, int segments = 16);
+    std::shared_ptr<Mesh> GetPlane(float width = 1.0f, float depth = 1.0f, int subdivisions = 1);
+    std::shared_ptr<Mesh> GetQuad(float width = 1.0f, float height = 1.0f);
+    std::shared_ptr<Mesh> GetCylinder(float radius = 0.5f, float height = 1.0f, int segments = 16);
+    std::shared_ptr<Mesh> GetCapsule(float radius = 0.5f, float height = 1.0f, int segments = 16);
+
+    // Distinct primitives currently alive
+    [[nodiscard]] size_t GetMeshCount() const;
+    [[nodiscard]] const PrimitiveCacheStats& GetStats() const { return m_Stats; }
+
+private:
+    PrimitiveCache() = default;
+
+    enum class Type : uint8_t { Cube, Sphere, Plane, Quad, Cylinder, Capsule };
+
+    // Parameters compare bit for bit; 1.0f and 1.00001f are different meshes
+    struct Key {
+        Type type;
+        float a;
+        float b;
+        int segments;
+        bool operator==(const Key&) const = default;
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const;
+    };
+
+    template <typename Create>
+    std::shared_ptr<Mesh> GetOrCreate(const Key& key, Create create);
+
+    std::unordered_map<Key, std::weak_ptr<Mesh>, KeyHash> m_Meshes;
+    PrimitiveCacheStats m_Stats;
+};
+
+#endif // PRIMITIVE_CACHE_H
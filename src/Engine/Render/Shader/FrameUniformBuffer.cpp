@@ -0,0 +1,25 @@
+#include "FrameUniformBuffer.h"
+#include <cstring>
+
+FrameUniformBuffer::~FrameUniformBuffer() {
+    if (m_ID) glDeleteBuffers(1, &m_ID);
+}
+
+void FrameUniformBuffer::Upload(const FrameUniformData& data) {
+    if (!m_ID) {
+        glGenBuffers(1, &m_ID);
+        glBindBuffer(GL_UNIFORM_BUFFER, m_ID);
+        glBufferData(GL_UNIFORM_BUFFER, sizeof(FrameUniformData), nullptr, GL_DYNAMIC_DRAW);
+    } else {
+        glBindBuffer(GL_UNIFORM_BUFFER, m_ID);
+    }
+
+    if (!m_HasData || std::memcmp(&m_Last, &data, sizeof(FrameUniformData)) != 0) {
+        glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(FrameUniformData), &data);
+        m_Last = data;
+        m_HasData = true;
+    }
+    // Rebound every pass: other code may have used the binding point in between
+    glBindBufferBase(GL_UNIFORM_BUFFER, kBindingPoint, m_ID);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+}
@@ -0,0 +1,55 @@
+#ifndef FRAME_UNIFORM_BUFFER_H
+#define FRAME_UNIFORM_BUFFER_H
+
+#include <cstddef>
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+/**
+ * @brief CPU mirror of the std140 FrameData block in the engine shaders
+ *
+ * Only mat4 and vec4 members, so the C++ layout matches std140 without padding.
+ * Keep the order in sync with the block declarations in src/shaders.
+ */
+struct FrameUniformData {
+    glm::mat4 view{1.0f};
+    glm::mat4 projection{1.0f};
+    glm::mat4 viewProjection{1.0f};
+    glm::mat4 lightSpaceMatrix{1.0f};
+    glm::vec4 camPos{0.0f};         // xyz
+    glm::vec4 lightDirection{0.0f}; // xyz, towards the light
+    glm::vec4 lightColor{1.0f};     // rgb, a = ambient strength
+};
+static_assert(offsetof(FrameUniformData, lightSpaceMatrix) == 192, "FrameData std140 layout");
+static_assert(offsetof(FrameUniformData, camPos) == 256, "FrameData std140 layout");
+static_assert(sizeof(FrameUniformData) == 304, "FrameData std140 layout");
+
+/**
+ * @brief Uniform buffer holding FrameUniformData, bound at kBindingPoint
+ *
+ * Uploaded once per view pass; programs get their FrameData block pointed at
+ * the binding point when they are linked (see Shader::Reflect), so per-draw
+ * code only sets per-object uniforms.
+ */
+class FrameUniformBuffer {
+public:
+    static constexpr GLuint kBindingPoint = 0;
+    static constexpr const char* kBlockName = "FrameData";
+    // Texture unit of the shadow map sampler, assigned at link time
+    static constexpr GLint kShadowMapUnit = 2;
+
+    FrameUniformBuffer() = default;
+    ~FrameUniformBuffer();
+    FrameUniformBuffer(const FrameUniformBuffer&) = delete;
+    FrameUniformBuffer& operator=(const FrameUniformBuffer&) = delete;
+
+    // Skips the copy when the data matches the last upload (e.g. the game panel redrawing the same view)
+    void Upload(const FrameUniformData& data);
+
+private:
+    GLuint m_ID = 0;
+    FrameUniformData m_Last;
+    bool m_HasData = false;
+};
+
+#endif // FRAME_UNIFORM_BUFFER_H
@@ -1,10 +1,18 @@
 #include "Shader.h"
+#include "FrameUniformBuffer.h"
+#include "Engine/Render/Material/MaterialBlockBuffer.h"
+#include "Engine/Render/State/GLStateCache.h"
 #include <fstream>
 #include <sstream>
 #include <iostream>
+#include <algorithm>
 #include <glad/glad.h>
 #include <glm/gtc/type_ptr.hpp>  // glm::value_ptr() için gerekli
 
+bool Shader::s_CompletionQuery = false;
+uint32_t Shader::s_Lookups = 0;
+uint32_t Shader::s_LastFrameLookups = 0;
+
 Shader::Shader(const char* vertexPath, const char* fragmentPath)
 {
     std::string vertexCode;
@@ -31,79 +39,300 @@ Shader::Shader(const char* vertexPath, const char* fragmentPath)
         fragmentCode = fShaderStream.str();
     }
 
+    ID = CompileProgram(vertexCode, fragmentCode, false);
+    Reflect();
+}
+
+Shader::Shader(const unsigned int program) : ID(program)
+{
+    Reflect();
+}
+
+Shader::~Shader()
+{
+    if (m_PendingVertex) glDeleteShader(m_PendingVertex);
+    if (m_PendingFragment) glDeleteShader(m_PendingFragment);
+    if (ID) {
+        GLStateCache::GetInstance().ForgetProgram(ID);
+        glDeleteProgram(ID);
+    }
+}
+
+unsigned int Shader::CompileProgram(const std::string& vertexCode, const std::string& fragmentCode,
+                                    const bool retrievableBinary, bool* outLinked)
+{
+    unsigned int vertex = 0;
+    unsigned int fragment = 0;
+    const unsigned int program = IssueProgram(vertexCode, fragmentCode, retrievableBinary, vertex, fragment);
+    const bool linked = FinishProgram(program, vertex, fragment);
+    if (outLinked) *outLinked = linked;
+    return program;
+}
+
+std::shared_ptr<Shader> Shader::CompileAsync(const std::string& vertexCode, const std::string& fragmentCode,
+                                             const bool retrievableBinary)
+{
+    std::shared_ptr<Shader> shader(new Shader());
+    shader->ID = IssueProgram(vertexCode, fragmentCode, retrievableBinary,
+                              shader->m_PendingVertex, shader->m_PendingFragment);
+    return shader;
+}
+
+bool Shader::Poll(const bool wait)
+{
+    if (!IsPending()) return true;
+    if (!wait) {
+        if (!s_CompletionQuery) return false;
+        // Covers the stages too: the link completes after them
+        GLint done = GL_FALSE;
+        glGetProgramiv(ID, GL_COMPLETION_STATUS_KHR, &done);
+        if (!done) return false;
+    }
+
+    FinishProgram(ID, m_PendingVertex, m_PendingFragment);
+    m_PendingVertex = 0;
+    m_PendingFragment = 0;
+    Reflect();
+    return true;
+}
+
+unsigned int Shader::IssueProgram(const std::string& vertexCode, const std::string& fragmentCode,
+                                  const bool retrievableBinary, unsigned int& outVertex, unsigned int& outFragment)
+{
     const char* vShaderCode = vertexCode.c_str();
     const char* fShaderCode = fragmentCode.c_str();
 
     // 2) Derle (vertex shader)
-    unsigned int vertex = glCreateShader(GL_VERTEX_SHADER);
-    glShaderSource(vertex, 1, &vShaderCode, NULL);
-    glCompileShader(vertex);
-    checkCompileErrors(vertex, "VERTEX");
+    outVertex = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(outVertex, 1, &vShaderCode, NULL);
+    glCompileShader(outVertex);
 
     // 3) Derle (fragment shader)
-    unsigned int fragment = glCreateShader(GL_FRAGMENT_SHADER);
-    glShaderSource(fragment, 1, &fShaderCode, NULL);
-    glCompileShader(fragment);
-    checkCompileErrors(fragment, "FRAGMENT");
+    outFragment = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(outFragment, 1, &fShaderCode, NULL);
+    glCompileShader(outFragment);
+
+    // 4) Shader programını linkle; durum sorgusu FinishProgram'a kadar bekler
+    const unsigned int program = glCreateProgram();
+    if (retrievableBinary && glProgramParameteri) {
+        glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+    glAttachShader(program, outVertex);
+    glAttachShader(program, outFragment);
+    glLinkProgram(program);
+    return program;
+}
 
-    // 4) Shader programını linkle
-    ID = glCreateProgram();
-    glAttachShader(ID, vertex);
-    glAttachShader(ID, fragment);
-    glLinkProgram(ID);
-    checkCompileErrors(ID, "PROGRAM");
+bool Shader::FinishProgram(const unsigned int program, const unsigned int vertex, const unsigned int fragment)
+{
+    checkCompileErrors(vertex, "VERTEX");
+    checkCompileErrors(fragment, "FRAGMENT");
+    const bool linked = checkCompileErrors(program, "PROGRAM");
 
     // Artık ayrı shaderlar gereksiz
     glDeleteShader(vertex);
     glDeleteShader(fragment);
+    return linked;
 }
 
 void Shader::use() const
 {
-    glUseProgram(ID);
+    GLStateCache::GetInstance().UseProgram(ID);
 }
 
-void Shader::setMat4(const std::string &name, const glm::mat4 &mat) const
+void Shader::Reflect()
 {
-    // Uniform konumunu bul
-    int location = glGetUniformLocation(ID, name.c_str());
-    if (location == -1)
-    {
-        // Opsiyonel: uniform bulunamadı diye uyarı verebilirsiniz
-        // std::cerr << "Warning: uniform '" << name << "' doesn't exist!\n";
+    m_Uniforms.Clear();
+    GLint linked = GL_FALSE;
+    glGetProgramiv(ID, GL_LINK_STATUS, &linked);
+    m_Ready = linked == GL_TRUE;
+    if (!linked) return;
+
+    GLint count = 0;
+    GLint maxLength = 0;
+    glGetProgramiv(ID, GL_ACTIVE_UNIFORMS, &count);
+    glGetProgramiv(ID, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+    std::string name(static_cast<size_t>(std::max(maxLength, 1)), '\0');
+    for (GLint i = 0; i < count; ++i) {
+        GLsizei length = 0;
+        GLint size = 0;
+        GLenum type = 0;
+        glGetActiveUniform(ID, static_cast<GLuint>(i), maxLength, &length, &size, &type, name.data());
+        // Uniform block members have no location; they are set through their buffer
+        const int location = glGetUniformLocation(ID, name.c_str());
+        if (location < 0) continue;
+        m_Uniforms.Add(std::string_view(name.data(), length), {location, type, size});
+    }
+
+    m_EngineUniforms.model = {LocateUncounted("model")};
+    m_EngineUniforms.color = {LocateUncounted("color")};
+    m_EngineUniforms.objectId = {LocateUncounted("objectId")};
+    m_EngineUniforms.materialIndex = {LocateUncounted("materialIndex")};
+
+    // GLSL 330 has no binding layout qualifiers; fix the block binding and sampler unit here once
+    const GLuint frameBlock = glGetUniformBlockIndex(ID, FrameUniformBuffer::kBlockName);
+    if (frameBlock != GL_INVALID_INDEX) {
+        glUniformBlockBinding(ID, frameBlock, FrameUniformBuffer::kBindingPoint);
+    }
+    const GLuint materialBlock = glGetUniformBlockIndex(ID, MaterialBlockBuffer::kBlockName);
+    if (materialBlock != GL_INVALID_INDEX) {
+        glUniformBlockBinding(ID, materialBlock, MaterialBlockBuffer::kBindingPoint);
+    }
+    if (const int shadowMap = LocateUncounted("shadowMap"); shadowMap >= 0) {
+        // Raw calls that restore the current program, so the state cache stays right
+        GLint previous = 0;
+        glGetIntegerv(GL_CURRENT_PROGRAM, &previous);
+        glUseProgram(ID);
+        glUniform1i(shadowMap, FrameUniformBuffer::kShadowMapUnit);
+        glUseProgram(static_cast<GLuint>(previous));
     }
-    // Matrisi uniform'a yükle
-    glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(mat));
 }
 
-void Shader::setVec4(const std::string &name, const glm::vec4 &value) const
+int Shader::LocateUncounted(const std::string_view name) const
 {
-    // Find uniform location
-    int location = glGetUniformLocation(ID, name.c_str());
-    if (location == -1)
-    {
-        // Optional: You can give a warning if the uniform is not found
-        // std::cerr << "Warning: uniform '" << name << "' doesn't exist!\n";
-    }
-    // Set vec4 uniform value
-    glUniform4fv(location, 1, glm::value_ptr(value));
+    const UniformInfo* info = m_Uniforms.Find(name);
+    return info ? info->location : -1;
 }
 
-void Shader::setVec3(const std::string &name, const glm::vec3 &value) const {
-    int location = glGetUniformLocation(ID, name.c_str());
-    if (location == -1) {
-        // Opsiyonel: uniform bulunamadı diye uyarı verebilirsiniz
-        // std::cerr << "Warning: uniform '" << name << "' doesn't exist!\n";
-    }
-    glUniform3f(location, value.x, value.y, value.z);
+int Shader::FindLocation(const std::string_view name) const
+{
+    ++s_Lookups;
+    return LocateUncounted(name);
+}
+
+void Shader::EndFrameStats()
+{
+    s_LastFrameLookups = s_Lookups;
+    s_Lookups = 0;
+}
+
+void Shader::set(const UniformHandle<glm::mat4> handle, const glm::mat4& value) const
+{
+    if (handle.IsValid()) glUniformMatrix4fv(handle.location, 1, GL_FALSE, glm::value_ptr(value));
+}
+
+void Shader::set(const UniformHandle<glm::vec4> handle, const glm::vec4& value) const
+{
+    if (handle.IsValid()) glUniform4fv(handle.location, 1, glm::value_ptr(value));
+}
+
+void Shader::set(const UniformHandle<glm::vec3> handle, const glm::vec3& value) const
+{
+    if (handle.IsValid()) glUniform3fv(handle.location, 1, glm::value_ptr(value));
+}
+
+void Shader::set(const UniformHandle<glm::vec2> handle, const glm::vec2& value) const
+{
+    if (handle.IsValid()) glUniform2f(handle.location, value.x, value.y);
+}
+
+void Shader::set(const UniformHandle<float> handle, const float value) const
+{
+    if (handle.IsValid()) glUniform1f(handle.location, value);
 }
 
-void Shader::setBool(const std::string &name, bool value) const {
-    glUniform1i(glGetUniformLocation(ID, name.c_str()), (int)value);
+void Shader::set(const UniformHandle<int> handle, const int value) const
+{
+    if (handle.IsValid()) glUniform1i(handle.location, value);
+}
+
+void Shader::set(const UniformHandle<unsigned int> handle, const unsigned int value) const
+{
+    if (handle.IsValid()) glUniform1ui(handle.location, value);
+}
+
+void Shader::set(const UniformHandle<bool> handle, const bool value) const
+{
+    if (handle.IsValid()) glUniform1i(handle.location, value ? 1 : 0);
+}
+
+void Shader::setArray(const UniformHandle<glm::mat4> handle, const glm::mat4* values, const int count) const
+{
+    if (handle.IsValid() && count > 0) glUniformMatrix4fv(handle.location, count, GL_FALSE, glm::value_ptr(values[0]));
+}
+
+void Shader::setArray(const UniformHandle<glm::vec4> handle, const glm::vec4* values, const int count) const
+{
+    if (handle.IsValid() && count > 0) glUniform4fv(handle.location, count, glm::value_ptr(values[0]));
+}
+
+void Shader::setArray(const UniformHandle<glm::vec3> handle, const glm::vec3* values, const int count) const
+{
+    if (handle.IsValid() && count > 0) glUniform3fv(handle.location, count, glm::value_ptr(values[0]));
+}
+
+void Shader::setArray(const UniformHandle<float> handle, const float* values, const int count) const
+{
+    if (handle.IsValid() && count > 0) glUniform1fv(handle.location, count, values);
+}
+
+void Shader::setArray(const UniformHandle<int> handle, const int* values, const int count) const
+{
+    if (handle.IsValid() && count > 0) glUniform1iv(handle.location, count, values);
+}
+
+void Shader::setMat4(const std::string_view name, const glm::mat4 &mat) const
+{
+    set(GetUniform<glm::mat4>(name), mat);
+}
+
+void Shader::setVec4(const std::string_view name, const glm::vec4 &value) const
+{
+    set(GetUniform<glm::vec4>(name), value);
+}
+
+void Shader::setVec3(const std::string_view name, const glm::vec3 &value) const
+{
+    set(GetUniform<glm::vec3>(name), value);
+}
+
+void Shader::setFloat(const std::string_view name, const float value) const
+{
+    set(GetUniform<float>(name), value);
+}
+
+void Shader::setInt(const std::string_view name, const int value) const
+{
+    set(GetUniform<int>(name), value);
+}
+
+void Shader::setBool(const std::string_view name, const bool value) const
+{
+    set(GetUniform<bool>(name), value);
+}
+
+void Shader::setUInt(const std::string_view name, const unsigned int value) const
+{
+    set(GetUniform<unsigned int>(name), value);
+}
+
+void Shader::setMat4Array(const std::string_view name, const glm::mat4* values, const int count) const
+{
+    setArray(GetUniform<glm::mat4>(name), values, count);
+}
+
+void Shader::setVec4Array(const std::string_view name, const glm::vec4* values, const int count) const
+{
+    setArray(GetUniform<glm::vec4>(name), values, count);
+}
+
+void Shader::setVec3Array(const std::string_view name, const glm::vec3* values, const int count) const
+{
+    setArray(GetUniform<glm::vec3>(name), values, count);
+}
+
+void Shader::setFloatArray(const std::string_view name, const float* values, const int count) const
+{
+    setArray(GetUniform<float>(name), values, count);
+}
+
+void Shader::setIntArray(const std::string_view name, const int* values, const int count) const
+{
+    setArray(GetUniform<int>(name), values, count);
 }
 
 // Hata kontrolü (derleme/link)
-void Shader::checkCompileErrors(const unsigned int shader, const std::string& type)
+bool Shader::checkCompileErrors(const unsigned int shader, const std::string& type)
 {
     int success;
     char infoLog[1024];
@@ -116,6 +345,7 @@ void Shader::checkCompileErrors(const unsigned int shader, const std::string& ty
             std::cerr << "ERROR::PROGRAM_LINKING_ERROR of type: " << type
                       << "\n" << infoLog << "\n -- --------------------------------------------------- -- " << std::endl;
         }
+        return success;
     }
     else
     {
@@ -126,6 +356,7 @@ void Shader::checkCompileErrors(const unsigned int shader, const std::string& ty
             std::cerr << "ERROR::SHADER_COMPILATION_ERROR of type: " << type
                       << "\n" << infoLog << "\n -- --------------------------------------------------- -- " << std::endl;
         }
+        return success;
     }
 }
 
@@ -1,36 +1,165 @@
 #ifndef SHADER_H
 #define SHADER_H
 
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <glm/glm.hpp>
+#include "UniformTable.h"
+
+/**
+ * @brief Resolved location of a uniform; the type picks the glUniform call
+ *
+ * Resolve once with Shader::GetUniform and keep it: setting through a handle
+ * never looks the name up again. Invalid handles (uniforms the program does
+ * not use) are ignored by the setters, like location -1 in GL.
+ */
+template <typename T>
+struct UniformHandle {
+    int location = -1;
+    [[nodiscard]] bool IsValid() const { return location >= 0; }
+};
 
 class Shader
 {
 public:
     // OpenGL shader program id
-    unsigned int ID;
+    unsigned int ID = 0;
 
     // Kurucu: Vertex ve fragment shader dosya yollarını alıp shader programını oluşturur
+    // (paylaşılan programlar için ShaderLibrary tercih edilmeli)
     Shader(const char* vertexPath, const char* fragmentPath);
 
+    // Takes ownership of an already linked program (e.g. loaded from a program binary)
+    explicit Shader(unsigned int program);
+
+    ~Shader();
+    Shader(const Shader&) = delete;
+    Shader& operator=(const Shader&) = delete;
+
+    /**
+     * @brief Compile and link a program from GLSL source
+     *
+     * @param retrievableBinary Ask the driver to keep the binary for glGetProgramBinary
+     * @param outLinked Set to whether linking succeeded (errors are logged either way)
+     */
+    static unsigned int CompileProgram(const std::string& vertexCode, const std::string& fragmentCode,
+                                       bool retrievableBinary, bool* outLinked = nullptr);
+
+    /**
+     * @brief Issue compile and link without waiting for the driver
+     *
+     * The returned Shader is pending: Poll finishes it once the driver is done.
+     * Until then it has no uniforms and IsReady is false; draw something else.
+     */
+    static std::shared_ptr<Shader> CompileAsync(const std::string& vertexCode, const std::string& fragmentCode,
+                                                bool retrievableBinary);
+
+    /**
+     * @brief Finish a pending program; true once it is no longer pending (linked or not)
+     *
+     * @param wait Block on the driver. Otherwise only finishes when GL_KHR_parallel_shader_compile
+     *             reports completion; without the extension nothing is known until we wait.
+     */
+    bool Poll(bool wait);
+    [[nodiscard]] bool IsPending() const { return m_PendingVertex != 0; }
+    // Linked and reflected: safe to draw with
+    [[nodiscard]] bool IsReady() const { return m_Ready; }
+
+    // GL_COMPLETION_STATUS_KHR can be queried; set by ShaderLibrary once the context exists
+    static void SetCompletionQuerySupported(bool supported) { s_CompletionQuery = supported; }
+    [[nodiscard]] static bool IsCompletionQuerySupported() { return s_CompletionQuery; }
+
     // Shader'ı aktif et
     void use() const;
 
-    // setMat4 fonksiyonunu tanımlarız:
-    void setMat4(const std::string &name, const glm::mat4 &mat) const;
+    /**
+     * @brief Per-object uniforms the engine sets on every draw, resolved once at link time
+     *
+     * Camera and light data live in the FrameData block (FrameUniformBuffer), material
+     * parameters in the Materials block (MaterialBlockBuffer).
+     */
+    struct EngineUniforms {
+        UniformHandle<glm::mat4> model;
+        UniformHandle<glm::vec4> color;
+        UniformHandle<unsigned int> objectId;
+        UniformHandle<unsigned int> materialIndex;
+    };
+    [[nodiscard]] const EngineUniforms& GetEngineUniforms() const { return m_EngineUniforms; }
 
-    // Add setVec4 method for wireframe rendering
-    void setVec4(const std::string &name, const glm::vec4 &value) const;
+    // Name lookup into the table reflected at link time; counted in GetLookupCount
+    template <typename T>
+    [[nodiscard]] UniformHandle<T> GetUniform(const std::string_view name) const { return {FindLocation(name)}; }
 
-    // İhtiyaca göre setVec3, setFloat, setInt vb. de ekleyebilirsiniz:
-    void setVec3(const std::string &name, const glm::vec3 &value) const;
-    // void setFloat(const std::string &name, float value) const;
-    // void setInt(const std::string &name, int value) const;
-    void setBool(const std::string &name, bool value) const;
+    [[nodiscard]] const UniformTable& GetUniforms() const { return m_Uniforms; }
+
+    // Typed setters; the program must be in use
+    void set(UniformHandle<glm::mat4> handle, const glm::mat4& value) const;
+    void set(UniformHandle<glm::vec4> handle, const glm::vec4& value) const;
+    void set(UniformHandle<glm::vec3> handle, const glm::vec3& value) const;
+    void set(UniformHandle<glm::vec2> handle, const glm::vec2& value) const;
+    void set(UniformHandle<float> handle, float value) const;
+    void set(UniformHandle<int> handle, int value) const;
+    void set(UniformHandle<unsigned int> handle, unsigned int value) const;
+    void set(UniformHandle<bool> handle, bool value) const;
+
+    // Arrays, from element 0
+    void setArray(UniformHandle<glm::mat4> handle, const glm::mat4* values, int count) const;
+    void setArray(UniformHandle<glm::vec4> handle, const glm::vec4* values, int count) const;
+    void setArray(UniformHandle<glm::vec3> handle, const glm::vec3* values, int count) const;
+    void setArray(UniformHandle<float> handle, const float* values, int count) const;
+    void setArray(UniformHandle<int> handle, const int* values, int count) const;
+
+    // By name: one table lookup per call; prefer handles in per-frame code
+    void setMat4(std::string_view name, const glm::mat4 &mat) const;
+    void setVec4(std::string_view name, const glm::vec4 &value) const;
+    void setVec3(std::string_view name, const glm::vec3 &value) const;
+    void setFloat(std::string_view name, float value) const;
+    void setInt(std::string_view name, int value) const;
+    void setBool(std::string_view name, bool value) const;
+    void setUInt(std::string_view name, unsigned int value) const;
+    void setMat4Array(std::string_view name, const glm::mat4* values, int count) const;
+    void setVec4Array(std::string_view name, const glm::vec4* values, int count) const;
+    void setVec3Array(std::string_view name, const glm::vec3* values, int count) const;
+    void setFloatArray(std::string_view name, const float* values, int count) const;
+    void setIntArray(std::string_view name, const int* values, int count) const;
+
+    /**
+     * @brief Uniform name lookups (GetUniform and the by-name setters) of the last frame
+     *
+     * Per-frame drawing goes through handles, so this stays at zero in steady state.
+     */
+    [[nodiscard]] static uint32_t GetLookupCount() { return s_LastFrameLookups; }
+    // Called once per frame by the application
+    static void EndFrameStats();
 
 private:
+    Shader() = default;
+
     // Derleme/link fonksiyonları vs.
-    static void checkCompileErrors(unsigned int shader, const std::string& type);
+    static bool checkCompileErrors(unsigned int shader, const std::string& type);
+    // glCompileShader/glLinkProgram only; the stages stay attached until FinishProgram
+    static unsigned int IssueProgram(const std::string& vertexCode, const std::string& fragmentCode,
+                                     bool retrievableBinary, unsigned int& outVertex, unsigned int& outFragment);
+    // Log errors, drop the stages; returns whether the program linked
+    static bool FinishProgram(unsigned int program, unsigned int vertex, unsigned int fragment);
+
+    // Fill m_Uniforms from the linked program and bind its uniform blocks and shadow map unit
+    void Reflect();
+    [[nodiscard]] int FindLocation(std::string_view name) const;
+    [[nodiscard]] int LocateUncounted(std::string_view name) const;
+
+    UniformTable m_Uniforms;
+    EngineUniforms m_EngineUniforms;
+    // Stages of a CompileAsync program not finished yet
+    unsigned int m_PendingVertex = 0;
+    unsigned int m_PendingFragment = 0;
+    bool m_Ready = false;
+
+    static bool s_CompletionQuery;
+    static uint32_t s_Lookups;
+    static uint32_t s_LastFrameLookups;
 };
 
 #endif
@@ -0,0 +1,212 @@
+#include "ShaderLibrary.h"
+#include "ShaderSource.h"
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <glad/glad.h>
+
+namespace {
+    // Same file through different relative paths must give the same key
+    std::string CanonicalPath(const std::string& path) {
+        std::error_code error;
+        const std::filesystem::path canonical = std::filesystem::weakly_canonical(path, error);
+        return error ? path : canonical.generic_string();
+    }
+
+    std::string GetGLString(const GLenum name) {
+        const auto* text = reinterpret_cast<const char*>(glGetString(name));
+        return text ? text : "";
+    }
+
+    double ElapsedMs(const std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+ShaderLibrary& ShaderLibrary::GetInstance() {
+    static ShaderLibrary instance;
+    return instance;
+}
+
+std::shared_ptr<Shader> ShaderLibrary::Get(const std::string& vertexPath, const std::string& fragmentPath,
+                                           const std::vector<std::string>& defines,
+                                           const ShaderCompileMode mode) {
+    const std::vector<std::string> normalized = ShaderSource::NormalizeDefines(defines);
+    std::string name = CanonicalPath(vertexPath) + "|" + CanonicalPath(fragmentPath);
+    for (const std::string& define : normalized) {
+        name += "|" + define;
+    }
+
+    std::weak_ptr<Shader>& entry = m_Shaders[name];
+    if (auto shader = entry.lock()) {
+        ++m_Stats.shared;
+        if (mode == ShaderCompileMode::Blocking && shader->IsPending()) {
+            // PollPending still stores the binary and drops the entry
+            const auto start = std::chrono::steady_clock::now();
+            shader->Poll(true);
+            m_Stats.blockingMs += ElapsedMs(start);
+        }
+        return shader;
+    }
+
+    std::string vertexCode;
+    std::string fragmentCode;
+    if (!ShaderSource::ReadFile(vertexPath, vertexCode)) {
+        std::cerr << "ERROR: Vertex shader dosyası bulunamadı: " << vertexPath << std::endl;
+        throw std::runtime_error("Vertex shader dosyası açılamadı");
+    }
+    if (!ShaderSource::ReadFile(fragmentPath, fragmentCode)) {
+        std::cerr << "ERROR: Fragment shader dosyası bulunamadı: " << fragmentPath << std::endl;
+        throw std::runtime_error("Fragment shader dosyası açılamadı");
+    }
+    vertexCode = ShaderSource::InjectDefines(vertexCode, normalized);
+    fragmentCode = ShaderSource::InjectDefines(fragmentCode, normalized);
+
+    const bool useBinaryCache = IsBinaryCacheUsable();
+    uint64_t key = 0;
+    if (useBinaryCache) {
+        // The final source, not the path: editing a shader or a define changes the key
+        key = ShaderSource::Hash(vertexCode);
+        key = ShaderSource::Hash(std::string_view("\0", 1), key);
+        key = ShaderSource::Hash(fragmentCode, key);
+        key = ShaderSource::Hash(m_Driver, key);
+
+        if (const unsigned int program = LoadBinary(key)) {
+            ++m_Stats.binaryLoads;
+            auto shader = std::make_shared<Shader>(program);
+            entry = shader;
+            return shader;
+        }
+    }
+
+    ++m_Stats.compiles;
+    const auto start = std::chrono::steady_clock::now();
+    std::shared_ptr<Shader> shader;
+    if (mode == ShaderCompileMode::Async) {
+        EnableParallelCompile();
+        shader = Shader::CompileAsync(vertexCode, fragmentCode, useBinaryCache);
+        m_Pending.push_back({shader, useBinaryCache ? key : 0});
+        m_Stats.pending = static_cast<uint32_t>(m_Pending.size());
+    } else {
+        bool linked = false;
+        shader = std::make_shared<Shader>(Shader::CompileProgram(vertexCode, fragmentCode, useBinaryCache, &linked));
+        if (useBinaryCache && linked) {
+            StoreBinary(key, shader->ID);
+        }
+    }
+    m_Stats.blockingMs += ElapsedMs(start);
+    entry = shader;
+    return shader;
+}
+
+void ShaderLibrary::PollPending() {
+    if (m_Pending.empty()) return;
+
+    const auto start = std::chrono::steady_clock::now();
+    bool waited = false;
+    for (auto it = m_Pending.begin(); it != m_Pending.end();) {
+        const std::shared_ptr<Shader> shader = it->shader.lock();
+        if (!shader) {
+            // Dropped while compiling; the Shader destructor already deleted it
+            it = m_Pending.erase(it);
+            continue;
+        }
+        if (shader->IsPending()) {
+            const bool wait = !Shader::IsCompletionQuerySupported() && !waited;
+            if (!shader->Poll(wait)) {
+                ++it;
+                continue;
+            }
+            waited = waited || wait;
+        }
+        if (it->key != 0 && shader->IsReady()) {
+            StoreBinary(it->key, shader->ID);
+        }
+        it = m_Pending.erase(it);
+    }
+    m_Stats.pending = static_cast<uint32_t>(m_Pending.size());
+    m_Stats.blockingMs += ElapsedMs(start);
+}
+
+void ShaderLibrary::EnableParallelCompile() {
+    if (m_ParallelChecked) return;
+    m_ParallelChecked = true;
+    // 0xFFFFFFFF: as many threads as the implementation likes
+    if (GLAD_GL_KHR_parallel_shader_compile && glMaxShaderCompilerThreadsKHR) {
+        glMaxShaderCompilerThreadsKHR(0xFFFFFFFFu);
+        Shader::SetCompletionQuerySupported(true);
+    } else if (GLAD_GL_ARB_parallel_shader_compile && glMaxShaderCompilerThreadsARB) {
+        glMaxShaderCompilerThreadsARB(0xFFFFFFFFu);
+        Shader::SetCompletionQuerySupported(true);
+    }
+}
+
+std::shared_ptr<Shader> ShaderLibrary::GetVariant(const std::string& vertexPath, const std::string& fragmentPath,
+                                                  const ShaderFeatures features,
+                                                  const ShaderCompileMode mode) {
+    const ShaderFeatures used = features & GetKeywords(vertexPath, fragmentPath);
+    return Get(vertexPath, fragmentPath, ShaderPermutation::ToDefines(used), mode);
+}
+
+ShaderFeatures ShaderLibrary::GetKeywords(const std::string& vertexPath, const std::string& fragmentPath) {
+    const std::string name = vertexPath + "|" + fragmentPath;
+    if (const auto it = m_Keywords.find(name); it != m_Keywords.end()) {
+        return it->second;
+    }
+
+    // Missing files declare nothing; Get reports them when the variant is built
+    ShaderFeatures keywords = ShaderFeature::None;
+    std::string code;
+    if (ShaderSource::ReadFile(vertexPath, code)) keywords |= ShaderPermutation::ParseKeywords(code);
+    if (ShaderSource::ReadFile(fragmentPath, code)) keywords |= ShaderPermutation::ParseKeywords(code);
+    m_Keywords.emplace(name, keywords);
+    return keywords;
+}
+
+bool ShaderLibrary::IsBinaryCacheUsable() {
+    if (m_CacheDirectory.empty()) return false;
+    if (m_BinarySupport < 0) {
+        GLint formats = 0;
+        if (glGetProgramBinary && glProgramBinary) {
+            glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+        }
+        m_BinarySupport = formats > 0 ? 1 : 0;
+        m_Driver = GetGLString(GL_VENDOR) + "|" + GetGLString(GL_RENDERER) + "|" + GetGLString(GL_VERSION);
+    }
+    return m_BinarySupport == 1;
+}
+
+unsigned int ShaderLibrary::LoadBinary(const uint64_t key) const {
+    ShaderBinaryCache::Blob blob;
+    if (!ShaderBinaryCache::Load(ShaderBinaryCache::GetPath(m_CacheDirectory, key), key, blob)) return 0;
+
+    const unsigned int program = glCreateProgram();
+    glProgramBinary(program, blob.format, blob.data.data(), static_cast<GLsizei>(blob.data.size()));
+    GLint linked = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &linked);
+    if (!linked) {
+        // The driver may reject its own old binaries; compiling again overwrites the file
+        glDeleteProgram(program);
+        return 0;
+    }
+    return program;
+}
+
+void ShaderLibrary::StoreBinary(const uint64_t key, const unsigned int program) const {
+    GLint length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) return;
+
+    ShaderBinaryCache::Blob blob;
+    blob.data.resize(static_cast<size_t>(length));
+    GLenum format = 0;
+    GLsizei written = 0;
+    glGetProgramBinary(program, length, &written, &format, blob.data.data());
+    if (written <= 0) return;
+    blob.data.resize(static_cast<size_t>(written));
+    blob.format = format;
+
+    if (!ShaderBinaryCache::Store(ShaderBinaryCache::GetPath(m_CacheDirectory, key), key, blob)) {
+        std::cerr << "[ShaderLibrary] Could not write program binary to " << m_CacheDirectory << std::endl;
+    }
+}
@@ -0,0 +1,114 @@
+#ifndef SHADER_LIBRARY_H
+#define SHADER_LIBRARY_H
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "Shader.h"
+#include "ShaderPermutation.h"
+
+/**
+ * @brief Where the programs handed out by the library came from
+ */
+struct ShaderLibraryStats {
+    uint32_t shared = 0;       // Requests answered with a program already alive
+    uint32_t binaryLoads = 0;  // Programs loaded from the binary cache, no GLSL compile
+    uint32_t compiles = 0;     // Programs compiled from source
+    uint32_t pending = 0;      // Async compiles the driver has not finished yet
+    double blockingMs = 0.0;   // Main-thread time spent compiling, linking or waiting on either
+};
+
+// How Get builds a program that is neither alive nor in the binary cache
+enum class ShaderCompileMode {
+    Blocking, // Compiled and linked before Get returns
+    Async     // Get returns a pending Shader at once; PollPending finishes it
+};
+
+/**
+ * @brief Shared shader programs keyed by source paths plus defines
+ *
+ * Everyone asking for the same vertex/fragment pair and define set gets the
+ * same Shader. Linked programs are also written to an on-disk cache
+ * (glGetProgramBinary), keyed by the final source and the driver, so a warm
+ * start skips GLSL compilation. A driver update or a shader edit changes the
+ * key and falls back to compiling.
+ *
+ * Async requests only issue the compile; the driver works on it (on its own
+ * threads with GL_KHR_parallel_shader_compile) while callers draw a fallback
+ * until Shader::IsReady.
+ *
+ * The library holds weak references only: a program is deleted with its last
+ * user, and nothing touches GL during static destruction.
+ */
+class ShaderLibrary {
+public:
+    static ShaderLibrary& GetInstance();
+
+    ShaderLibrary(const ShaderLibrary&) = delete;
+    ShaderLibrary& operator=(const ShaderLibrary&) = delete;
+
+    /**
+     * @brief Shared program for the pair; throws std::runtime_error if a file cannot be opened, like Shader
+     *
+     * @param defines "NAME" or "NAME VALUE" entries, added after the #version line
+     * @param mode Blocking also finishes a program an earlier Async request left pending
+     */
+    std::shared_ptr<Shader> Get(const std::string& vertexPath, const std::string& fragmentPath,
+                                const std::vector<std::string>& defines = {},
+                                ShaderCompileMode mode = ShaderCompileMode::Blocking);
+
+    /**
+     * @brief Variant of the pair compiled for features, through Get
+     *
+     * Features the pair does not declare (GetKeywords) are dropped first, so
+     * every distinct variant is compiled once.
+     */
+    std::shared_ptr<Shader> GetVariant(const std::string& vertexPath, const std::string& fragmentPath,
+                                       ShaderFeatures features,
+                                       ShaderCompileMode mode = ShaderCompileMode::Blocking);
+
+    /**
+     * @brief Finish async programs the driver is done with; called once per frame
+     *
+     * Without completion queries there is no way to ask, so one program per
+     * frame is waited for, spreading the stalls instead of stacking them.
+     */
+    void PollPending();
+
+    // shader_feature keywords of both stages; read once per pair
+    ShaderFeatures GetKeywords(const std::string& vertexPath, const std::string& fragmentPath);
+
+    // Binary cache location; empty disables it. Default "shader_cache" under the working directory
+    void SetBinaryCacheDirectory(const std::filesystem::path& directory) { m_CacheDirectory = directory; }
+    [[nodiscard]] const std::filesystem::path& GetBinaryCacheDirectory() const { return m_CacheDirectory; }
+
+    [[nodiscard]] const ShaderLibraryStats& GetStats() const { return m_Stats; }
+
+private:
+    ShaderLibrary() = default;
+
+    unsigned int LoadBinary(uint64_t key) const;
+    void StoreBinary(uint64_t key, unsigned int program) const;
+    bool IsBinaryCacheUsable();
+    // Lets the driver compile on all its threads and enables completion queries, if supported
+    void EnableParallelCompile();
+
+    struct PendingProgram {
+        std::weak_ptr<Shader> shader;
+        uint64_t key = 0; // Binary cache key; 0 when the cache is off
+    };
+
+    std::unordered_map<std::string, std::weak_ptr<Shader>> m_Shaders;
+    std::unordered_map<std::string, ShaderFeatures> m_Keywords; // Keyed by the pair of raw paths
+    std::filesystem::path m_CacheDirectory = "shader_cache";
+    std::string m_Driver; // Vendor, renderer and version: binaries only load on the driver that made them
+    int m_BinarySupport = -1; // -1 not checked yet
+    bool m_ParallelChecked = false;
+    std::vector<PendingProgram> m_Pending;
+    ShaderLibraryStats m_Stats;
+};
+
+#endif // SHADER_LIBRARY_H
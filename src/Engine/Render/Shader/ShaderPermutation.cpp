@@ -0,0 +1,64 @@
+#include "ShaderPermutation.h"
+
+namespace {
+    struct KeywordEntry {
+        ShaderFeatures feature;
+        std::string_view keyword;
+    };
+
+    constexpr KeywordEntry kKeywords[] = {
+        {ShaderFeature::HasTexture, "HAS_TEXTURE"},
+        {ShaderFeature::ReceiveShadows, "RECEIVE_SHADOWS"},
+        {ShaderFeature::Specular, "SPECULAR"},
+    };
+
+    bool IsSpace(const char c) {
+        return c == ' ' || c == '\t' || c == '\r';
+    }
+
+    std::string_view NextToken(std::string_view& text) {
+        size_t begin = 0;
+        while (begin < text.size() && IsSpace(text[begin])) ++begin;
+        size_t end = begin;
+        while (end < text.size() && !IsSpace(text[end])) ++end;
+        const std::string_view token = text.substr(begin, end - begin);
+        text.remove_prefix(end);
+        return token;
+    }
+}
+
+namespace ShaderPermutation {
+
+ShaderFeatures ParseKeywords(std::string_view source) {
+    ShaderFeatures keywords = ShaderFeature::None;
+    while (!source.empty()) {
+        const size_t lineEnd = source.find('\n');
+        std::string_view line = source.substr(0, lineEnd);
+        source.remove_prefix(lineEnd == std::string_view::npos ? source.size() : lineEnd + 1);
+
+        if (NextToken(line) != "#pragma" || NextToken(line) != "shader_feature") continue;
+        for (std::string_view token = NextToken(line); !token.empty(); token = NextToken(line)) {
+            for (const KeywordEntry& entry : kKeywords) {
+                if (entry.keyword == token) keywords |= entry.feature;
+            }
+        }
+    }
+    return keywords;
+}
+
+std::vector<std::string> ToDefines(const ShaderFeatures features) {
+    std::vector<std::string> defines;
+    for (const KeywordEntry& entry : kKeywords) {
+        if (features & entry.feature) defines.emplace_back(entry.keyword);
+    }
+    return defines;
+}
+
+const char* GetKeyword(const ShaderFeatures feature) {
+    for (const KeywordEntry& entry : kKeywords) {
+        if (entry.feature == feature) return entry.keyword.data();
+    }
+    return nullptr;
+}
+
+} // namespace ShaderPermutation
@@ -0,0 +1,45 @@
+#ifndef SHADER_PERMUTATION_H
+#define SHADER_PERMUTATION_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Bit set of ShaderFeature values
+using ShaderFeatures = uint32_t;
+
+/**
+ * @brief Features a shader can be compiled with; each one is a #define keyword
+ */
+namespace ShaderFeature {
+enum : ShaderFeatures {
+    None = 0,
+    HasTexture = 1u << 0,     // HAS_TEXTURE: sample tex0
+    ReceiveShadows = 1u << 1, // RECEIVE_SHADOWS: sample the shadow map
+    Specular = 1u << 2,       // SPECULAR: add the specular term
+};
+}
+
+/**
+ * @brief GL-free helpers turning feature sets into shader variants
+ *
+ * A shader declares the keywords it understands with
+ * "#pragma shader_feature HAS_TEXTURE SPECULAR ..." (GLSL ignores unknown
+ * pragmas). Features the shader does not declare are masked off before
+ * compiling, so they never create duplicate variants.
+ */
+namespace ShaderPermutation {
+
+// Keywords declared by shader_feature pragmas in source; unknown names are ignored
+[[nodiscard]] ShaderFeatures ParseKeywords(std::string_view source);
+
+// One define per set feature, in bit order
+[[nodiscard]] std::vector<std::string> ToDefines(ShaderFeatures features);
+
+// Keyword of a single feature bit, nullptr for unknown bits
+[[nodiscard]] const char* GetKeyword(ShaderFeatures feature);
+
+} // namespace ShaderPermutation
+
+#endif // SHADER_PERMUTATION_H
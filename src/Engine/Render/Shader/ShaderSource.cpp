@@ -0,0 +1,117 @@
+#include "ShaderSource.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+namespace ShaderSource {
+
+std::string InjectDefines(const std::string& source, const std::vector<std::string>& defines) {
+    if (defines.empty()) return source;
+
+    std::string block;
+    for (const std::string& define : defines) {
+        block += "#define " + define + "\n";
+    }
+
+    // #version must stay the first statement, so the defines go on the line after it
+    size_t insertAt = 0;
+    const size_t version = source.find("#version");
+    if (version != std::string::npos) {
+        const size_t lineEnd = source.find('\n', version);
+        if (lineEnd == std::string::npos) return source + "\n" + block;
+        insertAt = lineEnd + 1;
+    }
+    std::string result = source;
+    result.insert(insertAt, block);
+    return result;
+}
+
+std::vector<std::string> NormalizeDefines(std::vector<std::string> defines) {
+    std::sort(defines.begin(), defines.end());
+    defines.erase(std::unique(defines.begin(), defines.end()), defines.end());
+    return defines;
+}
+
+uint64_t Hash(const std::string_view data, uint64_t seed) {
+    for (const char c : data) {
+        seed ^= static_cast<unsigned char>(c);
+        seed *= 1099511628211ull;
+    }
+    return seed;
+}
+
+bool ReadFile(const std::filesystem::path& path, std::string& outText) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) return false;
+    std::stringstream stream;
+    stream << file.rdbuf();
+    outText = stream.str();
+    return true;
+}
+
+} // namespace ShaderSource
+
+namespace ShaderBinaryCache {
+
+namespace {
+    constexpr uint32_t kMagic = 0x43534542; // "BESC"
+    constexpr uint32_t kVersion = 1;
+
+    struct Header {
+        uint32_t magic = kMagic;
+        uint32_t version = kVersion;
+        uint64_t key = 0;
+        uint32_t format = 0;
+        uint32_t size = 0;
+    };
+}
+
+std::filesystem::path GetPath(const std::filesystem::path& directory, const uint64_t key) {
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.bin", static_cast<unsigned long long>(key));
+    return directory / name;
+}
+
+bool Load(const std::filesystem::path& file, const uint64_t key, Blob& outBlob) {
+    std::ifstream stream(file, std::ios::binary);
+    if (!stream.is_open()) return false;
+
+    Header header;
+    if (!stream.read(reinterpret_cast<char*>(&header), sizeof(header))) return false;
+    if (header.magic != kMagic || header.version != kVersion || header.key != key || header.size == 0) {
+        return false;
+    }
+
+    outBlob.format = header.format;
+    outBlob.data.resize(header.size);
+    if (!stream.read(outBlob.data.data(), header.size)) return false;
+    // A longer file is as suspicious as a shorter one
+    return stream.peek() == std::ifstream::traits_type::eof();
+}
+
+bool Store(const std::filesystem::path& file, const uint64_t key, const Blob& blob) {
+    if (blob.data.empty()) return false;
+
+    std::error_code error;
+    std::filesystem::create_directories(file.parent_path(), error);
+
+    // Write next to the target and rename, so a crash never leaves half a binary behind
+    const std::filesystem::path temporary = file.string() + ".tmp";
+    {
+        std::ofstream stream(temporary, std::ios::binary | std::ios::trunc);
+        if (!stream.is_open()) return false;
+
+        Header header;
+        header.key = key;
+        header.format = blob.format;
+        header.size = static_cast<uint32_t>(blob.data.size());
+        stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        stream.write(blob.data.data(), static_cast<std::streamsize>(blob.data.size()));
+        if (!stream) return false;
+    }
+    std::filesystem::rename(temporary, file, error);
+    return !error;
+}
+
+} // namespace ShaderBinaryCache
@@ -0,0 +1,52 @@
+#ifndef SHADER_SOURCE_H
+#define SHADER_SOURCE_H
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief GL-free helpers for preparing GLSL source and caching program binaries
+ */
+namespace ShaderSource {
+
+/**
+ * @brief Add a "#define" line per entry right after the #version line
+ *
+ * An entry is "NAME" or "NAME VALUE". Without a #version line the defines go first.
+ */
+[[nodiscard]] std::string InjectDefines(const std::string& source, const std::vector<std::string>& defines);
+
+// Sorted and without duplicates, so the same set always gives the same key
+[[nodiscard]] std::vector<std::string> NormalizeDefines(std::vector<std::string> defines);
+
+// 64-bit FNV-1a; chain calls through seed to hash several pieces
+[[nodiscard]] uint64_t Hash(std::string_view data, uint64_t seed = 14695981039346656037ull);
+
+bool ReadFile(const std::filesystem::path& path, std::string& outText);
+
+} // namespace ShaderSource
+
+/**
+ * @brief On-disk store of linked program binaries (glGetProgramBinary blobs)
+ *
+ * Each file holds one blob with its key; a file with another key, a different
+ * layout or a truncated body is treated as a miss.
+ */
+namespace ShaderBinaryCache {
+
+struct Blob {
+    uint32_t format = 0; // GLenum binaryFormat
+    std::vector<char> data;
+};
+
+[[nodiscard]] std::filesystem::path GetPath(const std::filesystem::path& directory, uint64_t key);
+
+bool Load(const std::filesystem::path& file, uint64_t key, Blob& outBlob);
+bool Store(const std::filesystem::path& file, uint64_t key, const Blob& blob);
+
+} // namespace ShaderBinaryCache
+
+#endif // SHADER_SOURCE_H
@@ -0,0 +1,16 @@
+#include "UniformTable.h"
+
+void UniformTable::Add(std::string_view name, const UniformInfo& info) {
+    m_Uniforms.insert_or_assign(std::string(name), info);
+
+    // "lights[0]" is also reachable as "lights"
+    constexpr std::string_view arraySuffix = "[0]";
+    if (name.size() > arraySuffix.size() && name.ends_with(arraySuffix)) {
+        m_Uniforms.insert_or_assign(std::string(name.substr(0, name.size() - arraySuffix.size())), info);
+    }
+}
+
+const UniformInfo* UniformTable::Find(const std::string_view name) const {
+    const auto it = m_Uniforms.find(name);
+    return it != m_Uniforms.end() ? &it->second : nullptr;
+}
@@ -0,0 +1,43 @@
+#ifndef UNIFORM_TABLE_H
+#define UNIFORM_TABLE_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+/**
+ * @brief An active uniform of a linked program, as reported by glGetActiveUniform
+ */
+struct UniformInfo {
+    int location = -1;
+    uint32_t type = 0; // GLenum, e.g. GL_FLOAT_MAT4
+    int size = 1;      // Array length, 1 for non-arrays
+};
+
+/**
+ * @brief Name -> uniform lookup filled once at link time
+ *
+ * Lookups take a string_view, so setting a uniform by a literal name never
+ * builds a std::string. Arrays answer to both "name" and "name[0]".
+ */
+class UniformTable {
+public:
+    // name is the name glGetActiveUniform returned
+    void Add(std::string_view name, const UniformInfo& info);
+    void Clear() { m_Uniforms.clear(); }
+
+    // nullptr for names the program does not use
+    [[nodiscard]] const UniformInfo* Find(std::string_view name) const;
+    [[nodiscard]] size_t GetCount() const { return m_Uniforms.size(); }
+
+private:
+    struct NameHash {
+        using is_transparent = void;
+        size_t operator()(std::string_view name) const { return std::hash<std::string_view>{}(name); }
+    };
+
+    std::unordered_map<std::string, UniformInfo, NameHash, std::equal_to<>> m_Uniforms;
+};
+
+#endif // UNIFORM_TABLE_H
@@ -0,0 +1,162 @@
+#include "GLStateCache.h"
+#include <glad/glad.h>
+
+GLStateCache& GLStateCache::GetInstance() {
+    static GLStateCache instance;
+    return instance;
+}
+
+bool GLStateCache::Change(const bool changed) {
+    if (changed) {
+        ++m_Frame.issued;
+    } else {
+        ++m_Frame.elided;
+    }
+    return changed;
+}
+
+void GLStateCache::UseProgram(const unsigned int program) {
+    if (!Change(m_Program != program)) return;
+    glUseProgram(program);
+    m_Program = program;
+}
+
+void GLStateCache::BindVertexArray(const unsigned int vertexArray) {
+    if (!Change(m_VertexArray != vertexArray)) return;
+    glBindVertexArray(vertexArray);
+    m_VertexArray = vertexArray;
+}
+
+void GLStateCache::BindTexture(const uint32_t unit, const unsigned int target, const unsigned int texture) {
+    if (unit >= kMaxTextureUnits) {
+        // Not tracked; the unit switch is, so put it back under the cache's control
+        Change(true);
+        glActiveTexture(GL_TEXTURE0 + unit);
+        glBindTexture(target, texture);
+        m_ActiveUnit = kUnknown;
+        return;
+    }
+
+    TextureBinding& binding = m_Textures[unit];
+    if (!Change(binding.target != target || binding.texture != texture)) return;
+    if (Change(m_ActiveUnit != unit)) {
+        glActiveTexture(GL_TEXTURE0 + unit);
+        m_ActiveUnit = unit;
+    }
+    glBindTexture(target, texture);
+    binding = {target, texture};
+}
+
+void GLStateCache::BindFramebuffer(const unsigned int target, const unsigned int framebuffer) {
+    const bool draw = target == GL_FRAMEBUFFER || target == GL_DRAW_FRAMEBUFFER;
+    const bool read = target == GL_FRAMEBUFFER || target == GL_READ_FRAMEBUFFER;
+    if (!Change((draw && m_DrawFramebuffer != framebuffer) || (read && m_ReadFramebuffer != framebuffer))) return;
+    glBindFramebuffer(target, framebuffer);
+    if (draw) m_DrawFramebuffer = framebuffer;
+    if (read) m_ReadFramebuffer = framebuffer;
+}
+
+void GLStateCache::SetViewport(const int x, const int y, const int width, const int height) {
+    const std::array<int, 4> viewport{x, y, width, height};
+    if (!Change(!m_ViewportKnown || m_Viewport != viewport)) return;
+    glViewport(x, y, width, height);
+    m_Viewport = viewport;
+    m_ViewportKnown = true;
+}
+
+void GLStateCache::SetDepthTest(const bool enabled) {
+    if (!Change(m_DepthTest != static_cast<int8_t>(enabled))) return;
+    if (enabled) {
+        glEnable(GL_DEPTH_TEST);
+    } else {
+        glDisable(GL_DEPTH_TEST);
+    }
+    m_DepthTest = static_cast<int8_t>(enabled);
+}
+
+void GLStateCache::SetDepthWrite(const bool enabled) {
+    if (!Change(m_DepthWrite != static_cast<int8_t>(enabled))) return;
+    glDepthMask(enabled ? GL_TRUE : GL_FALSE);
+    m_DepthWrite = static_cast<int8_t>(enabled);
+}
+
+void GLStateCache::SetBlend(const bool enabled) {
+    if (!Change(m_Blend != static_cast<int8_t>(enabled))) return;
+    if (enabled) {
+        glEnable(GL_BLEND);
+    } else {
+        glDisable(GL_BLEND);
+    }
+    m_Blend = static_cast<int8_t>(enabled);
+}
+
+void GLStateCache::SetBlendFunc(const unsigned int source, const unsigned int destination) {
+    if (!Change(m_BlendSource != source || m_BlendDestination != destination)) return;
+    glBlendFunc(source, destination);
+    m_BlendSource = source;
+    m_BlendDestination = destination;
+}
+
+void GLStateCache::SetPolygonMode(const unsigned int mode) {
+    if (!Change(m_PolygonMode != mode)) return;
+    glPolygonMode(GL_FRONT_AND_BACK, mode);
+    m_PolygonMode = mode;
+}
+
+void GLStateCache::SetLineWidth(const float width) {
+    if (!Change(m_LineWidth != width)) return;
+    glLineWidth(width);
+    m_LineWidth = width;
+}
+
+unsigned int GLStateCache::GetReadFramebuffer() {
+    if (m_ReadFramebuffer == kUnknown) {
+        GLint framebuffer = 0;
+        glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &framebuffer);
+        m_ReadFramebuffer = static_cast<unsigned int>(framebuffer);
+    }
+    return m_ReadFramebuffer;
+}
+
+void GLStateCache::ForgetTexture(const unsigned int texture) {
+    for (TextureBinding& binding : m_Textures) {
+        if (binding.texture == texture) binding.texture = 0;
+    }
+}
+
+void GLStateCache::ForgetVertexArray(const unsigned int vertexArray) {
+    if (m_VertexArray == vertexArray) m_VertexArray = 0;
+}
+
+void GLStateCache::ForgetFramebuffer(const unsigned int framebuffer) {
+    if (m_DrawFramebuffer == framebuffer) m_DrawFramebuffer = 0;
+    if (m_ReadFramebuffer == framebuffer) m_ReadFramebuffer = 0;
+}
+
+void GLStateCache::ForgetProgram(const unsigned int program) {
+    // A deleted program stays current until replaced; just make sure the next use is issued
+    if (m_Program == program) m_Program = kUnknown;
+}
+
+void GLStateCache::Invalidate() {
+    m_Program = kUnknown;
+    m_VertexArray = kUnknown;
+    m_ActiveUnit = kUnknown;
+    m_Textures.fill({});
+    m_DrawFramebuffer = kUnknown;
+    m_ReadFramebuffer = kUnknown;
+    m_ViewportKnown = false;
+    m_DepthTest = kUnknownFlag;
+    m_DepthWrite = kUnknownFlag;
+    m_Blend = kUnknownFlag;
+    m_BlendSource = kUnknown;
+    m_BlendDestination = kUnknown;
+    m_PolygonMode = kUnknown;
+    m_LineWidth = -1.0f;
+}
+
+void GLStateCache::EndFrame() {
+    m_LastFrame = m_Frame;
+    m_Frame = {};
+    Invalidate();
+}
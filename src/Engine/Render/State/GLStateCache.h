@@ -0,0 +1,100 @@
+#ifndef GL_STATE_CACHE_H
+#define GL_STATE_CACHE_H
+
+#include <array>
+#include <cstdint>
+
+/**
+ * @brief GL calls of the last frame, split into sent to the driver and skipped as redundant
+ */
+struct GLStateStats {
+    uint32_t issued = 0;
+    uint32_t elided = 0;
+};
+
+/**
+ * @brief Shadow copy of the GL state render code changes, so redundant calls are skipped
+ *
+ * Covers the program, vertex array, 2D texture per unit, framebuffers, viewport,
+ * depth test/write, blending, polygon mode and line width. Render code sets this
+ * state only through here; anything that changes it behind the cache must call
+ * Invalidate (the application does once per frame, after ImGui has drawn).
+ *
+ * Unknown state (after Invalidate) is always issued, never queried back.
+ */
+class GLStateCache {
+public:
+    static GLStateCache& GetInstance();
+
+    GLStateCache(const GLStateCache&) = delete;
+    GLStateCache& operator=(const GLStateCache&) = delete;
+
+    static constexpr uint32_t kMaxTextureUnits = 16;
+
+    void UseProgram(unsigned int program);
+    void BindVertexArray(unsigned int vertexArray);
+    // Selects the unit as well; target is GL_TEXTURE_2D et al.
+    void BindTexture(uint32_t unit, unsigned int target, unsigned int texture);
+    // GL_FRAMEBUFFER sets both the draw and the read binding
+    void BindFramebuffer(unsigned int target, unsigned int framebuffer);
+    void SetViewport(int x, int y, int width, int height);
+    void SetDepthTest(bool enabled);
+    void SetDepthWrite(bool enabled);
+    void SetBlend(bool enabled);
+    void SetBlendFunc(unsigned int source, unsigned int destination);
+    // GL_FILL or GL_LINE, for both faces
+    void SetPolygonMode(unsigned int mode);
+    void SetLineWidth(float width);
+
+    // Read binding as last set; queried from GL once if unknown
+    [[nodiscard]] unsigned int GetReadFramebuffer();
+
+    // Deleting a bound object resets its binding to 0, and a new object may get the name back
+    void ForgetTexture(unsigned int texture);
+    void ForgetVertexArray(unsigned int vertexArray);
+    void ForgetFramebuffer(unsigned int framebuffer);
+    void ForgetProgram(unsigned int program);
+
+    // Forget everything: the next call of each kind goes to the driver
+    void Invalidate();
+
+    // Counts of the last frame
+    [[nodiscard]] const GLStateStats& GetStats() const { return m_LastFrame; }
+    // Called once per frame by the application; also invalidates, ImGui draws behind the cache
+    void EndFrame();
+
+private:
+    GLStateCache() = default;
+
+    // Returns whether the call has to be issued and counts it either way
+    bool Change(bool changed);
+
+    static constexpr unsigned int kUnknown = 0xFFFFFFFFu;
+    static constexpr int8_t kUnknownFlag = -1;
+
+    struct TextureBinding {
+        unsigned int target = kUnknown;
+        unsigned int texture = kUnknown;
+    };
+
+    unsigned int m_Program = kUnknown;
+    unsigned int m_VertexArray = kUnknown;
+    unsigned int m_ActiveUnit = kUnknown;
+    std::array<TextureBinding, kMaxTextureUnits> m_Textures{};
+    unsigned int m_DrawFramebuffer = kUnknown;
+    unsigned int m_ReadFramebuffer = kUnknown;
+    std::array<int, 4> m_Viewport{};
+    bool m_ViewportKnown = false;
+    int8_t m_DepthTest = kUnknownFlag;
+    int8_t m_DepthWrite = kUnknownFlag;
+    int8_t m_Blend = kUnknownFlag;
+    unsigned int m_BlendSource = kUnknown;
+    unsigned int m_BlendDestination = kUnknown;
+    unsigned int m_PolygonMode = kUnknown;
+    float m_LineWidth = -1.0f;
+
+    GLStateStats m_Frame;
+    GLStateStats m_LastFrame;
+};
+
+#endif // GL_STATE_CACHE_H
@@ -1,9 +1,11 @@
 #include"Texture.h"
+#include "Engine/Render/State/GLStateCache.h"
 
 Texture::Texture(const char* image, GLenum texType, GLenum slot, GLenum format, GLenum pixelType)
 {
 	// Assigns the type of the texture ot the texture object
 	type = texType;
+	unit = slot - GL_TEXTURE0;
 
 	// Stores the width, height, and the number of color channels of the image
 	int widthImg = 0, heightImg = 0, numColCh = 0;
@@ -19,8 +21,7 @@ Texture::Texture(const char* image, GLenum texType, GLenum slot, GLenum format,
 	glGenTextures(1, &ID);
 	std::cout << "[Texture] OpenGL texture ID: " << ID << std::endl;
 	// Assigns the texture to a Texture Unit
-	glActiveTexture(slot);
-	glBindTexture(texType, ID);
+	GLStateCache::GetInstance().BindTexture(unit, texType, ID);
 
 	// Configures the type of algorithm that is used to make the image smaller or bigger
 	glTexParameteri(texType, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_LINEAR);
@@ -59,30 +60,31 @@ Texture::Texture(const char* image, GLenum texType, GLenum slot, GLenum format,
 	glGenerateMipmap(texType);
 
 	// Unbinds the OpenGL Texture object so that it can't accidentally be modified
-	glBindTexture(texType, 0);
+	GLStateCache::GetInstance().BindTexture(unit, texType, 0);
 }
 
 void Texture::texUnit(const std::shared_ptr<Shader> &shader, const char* uniform, GLuint unit)
 {
 	// Gets the location of the uniform
-	GLuint texUni = glGetUniformLocation(shader->ID, uniform);
+	const UniformHandle<int> texUni = shader->GetUniform<int>(uniform);
 	// Shader needs to be activated before changing the value of a uniform
 	shader->use();
 	// Sets the value of the uniform
-	glUniform1i(texUni, unit);
+	shader->set(texUni, static_cast<int>(unit));
 }
 
 void Texture::Bind()
 {
-	glBindTexture(type, ID);
+	GLStateCache::GetInstance().BindTexture(unit, type, ID);
 }
 
 void Texture::Unbind()
 {
-	glBindTexture(type, 0);
+	GLStateCache::GetInstance().BindTexture(unit, type, 0);
 }
 
 void Texture::Delete()
 {
+	GLStateCache::GetInstance().ForgetTexture(ID);
 	glDeleteTextures(1, &ID);
 }
\ No newline at end of file
@@ -13,6 +13,8 @@ class Texture
 public:
     GLuint ID;
     GLenum type;
+    // Texture unit it binds to (slot - GL_TEXTURE0)
+    GLuint unit;
     Texture(const char* image, GLenum texType, GLenum slot, GLenum format, GLenum pixelType);
 
     // Assigns a texture unit to a texture
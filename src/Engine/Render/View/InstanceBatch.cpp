@@ -0,0 +1,54 @@
+#include "InstanceBatch.h"
+#include "RenderView.h"
+
+namespace InstanceBatching {
+
+bool SharesDrawState(const RenderItem& a, const RenderItem& b) {
+    return a.material == b.material || (a.drawState != 0 && a.drawState == b.drawState);
+}
+
+void Build(const std::vector<RenderItem>& items, std::vector<InstanceBatch>& outBatches,
+           std::vector<InstanceData>& outInstances, const uint32_t minInstances) {
+    outBatches.clear();
+    outInstances.clear();
+
+    const auto count = static_cast<uint32_t>(items.size());
+    uint32_t first = 0;
+    while (first < count) {
+        const RenderItem& item = items[first];
+        if (item.hidden) {
+            ++first;
+            continue;
+        }
+
+        uint32_t end = first + 1;
+        if (item.instanceable) {
+            while (end < count && items[end].instanceable && !items[end].hidden &&
+                   items[end].mesh == item.mesh && SharesDrawState(items[end], item)) {
+                ++end;
+            }
+        }
+
+        InstanceBatch batch;
+        batch.firstItem = first;
+        batch.itemCount = end - first;
+        if (item.instanceable && batch.itemCount >= minInstances) {
+            batch.instanced = true;
+            batch.firstInstance = static_cast<uint32_t>(outInstances.size());
+            for (uint32_t i = first; i < end; ++i) {
+                InstanceData& instance = outInstances.emplace_back();
+                instance.model = items[i].VertexModel();
+                instance.objectId = items[i].objectId;
+            }
+            outBatches.push_back(batch);
+        } else {
+            // Too short a run: each item is its own draw
+            for (uint32_t i = first; i < end; ++i) {
+                outBatches.push_back({i, 1, 0, false});
+            }
+        }
+        first = end;
+    }
+}
+
+} // namespace InstanceBatching
@@ -0,0 +1,66 @@
+#ifndef INSTANCE_BATCH_H
+#define INSTANCE_BATCH_H
+
+#include <cstdint>
+#include <vector>
+#include <glm/glm.hpp>
+
+struct RenderItem;
+
+/**
+ * @brief Per-instance vertex data, as laid out in the instance buffer
+ */
+struct InstanceData {
+    glm::mat4 model{1.0f};
+    uint32_t objectId = 0;
+    uint32_t padding[3] = {}; // Keeps every matrix 16-byte aligned
+};
+
+/**
+ * @brief One draw call: a single item, or a run of items drawn instanced
+ */
+struct InstanceBatch {
+    uint32_t firstItem = 0;
+    uint32_t itemCount = 1;
+    uint32_t firstInstance = 0; // Into the view's instance data; only for instanced batches
+    bool instanced = false;
+};
+
+/**
+ * @brief Draw calls of the passes since the last reset
+ */
+struct DrawCallStats {
+    uint32_t drawCalls = 0;
+    uint32_t instancedDraws = 0; // Draw calls that covered more than one object
+    uint32_t instances = 0;      // Objects drawn by them
+    uint32_t fallbackDraws = 0;  // Draws made with a fallback shader while the real one compiles
+    uint32_t indirectDraws = 0;  // Multi-draw indirect calls, each covering a run of batches
+    uint32_t indirectCommands = 0; // Batches they drew
+};
+
+namespace InstanceBatching {
+
+// A run shorter than this is cheaper to draw one by one than to stream
+constexpr uint32_t kMinInstances = 2;
+
+/**
+ * @brief Whether two items bind the same material state: the same material, or equal draw states
+ */
+[[nodiscard]] bool SharesDrawState(const RenderItem& a, const RenderItem& b);
+
+/**
+ * @brief Merge consecutive visible items with the same mesh and material state (SharesDrawState)
+ *
+ * Items must be sorted (see RenderQueue), so everything that can share a
+ * draw is adjacent. Only items marked instanceable are merged; hidden items
+ * get no batch at all.
+ *
+ * @param minInstances Shortest run drawn instanced. 1 streams every instanceable
+ *                     item, which multi-draw indirect needs to reach it through baseInstance.
+ */
+void Build(const std::vector<RenderItem>& items, std::vector<InstanceBatch>& outBatches,
+           std::vector<InstanceData>& outInstances, uint32_t minInstances = kMinInstances);
+
+} // namespace InstanceBatching
+
+#endif // INSTANCE_BATCH_H
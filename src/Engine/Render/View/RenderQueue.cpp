@@ -0,0 +1,104 @@
+#include "RenderQueue.h"
+#include "RenderView.h"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <functional>
+
+uint32_t RenderKeyIds::Get(const void* object) {
+    return m_Ids.try_emplace(object, static_cast<uint32_t>(m_Ids.size())).first->second;
+}
+
+uint32_t DrawStateIds::Get(const void* instancedShader, const void* texture, const uint32_t blockIndex) {
+    const Key key{instancedShader, texture, blockIndex};
+    return m_Ids.try_emplace(key, static_cast<uint32_t>(m_Ids.size()) + 1).first->second;
+}
+
+size_t DrawStateIds::KeyHash::operator()(const Key& key) const {
+    const size_t shader = std::hash<const void*>{}(key.instancedShader);
+    const size_t texture = std::hash<const void*>{}(key.texture);
+    return (shader * 31 + texture) * 31 + key.blockIndex;
+}
+
+namespace RenderQueue {
+
+namespace {
+    constexpr uint64_t Mask(const uint32_t bits) { return (uint64_t{1} << bits) - 1; }
+
+    constexpr uint32_t kDepthShift = 0;
+    constexpr uint32_t kMeshShift = kDepthShift + kDepthBits;
+    constexpr uint32_t kMaterialShift = kMeshShift + kMeshBits;
+    constexpr uint32_t kShaderShift = kMaterialShift + kMaterialBits;
+    constexpr uint32_t kPassShift = kShaderShift + kShaderBits;
+}
+
+uint64_t MakeKey(const RenderPass pass, const uint32_t shader, const uint32_t material, const uint32_t mesh,
+                 const float viewDepth) {
+    // Non-negative IEEE floats order the same as their bit patterns; keep the top bits below the sign
+    const float depth = std::max(viewDepth, 0.0f);
+    uint32_t depthBits = 0;
+    std::memcpy(&depthBits, &depth, sizeof(depthBits));
+    depthBits >>= 31 - kDepthBits;
+
+    return (static_cast<uint64_t>(pass) & Mask(kPassBits)) << kPassShift |
+           (shader & Mask(kShaderBits)) << kShaderShift |
+           (material & Mask(kMaterialBits)) << kMaterialShift |
+           (mesh & Mask(kMeshBits)) << kMeshShift |
+           (depthBits & Mask(kDepthBits)) << kDepthShift;
+}
+
+RenderPass GetPass(const uint64_t key) {
+    return static_cast<RenderPass>(key >> kPassShift);
+}
+
+void Sort(std::vector<RenderItem>& items, std::vector<RenderItem>& scratch) {
+    if (items.size() < 2) return;
+
+    // Every byte column's histogram in one read
+    std::array<std::array<uint32_t, 256>, 8> counts{};
+    for (const RenderItem& item : items) {
+        for (uint32_t byte = 0; byte < 8; ++byte) {
+            ++counts[byte][(item.sortKey >> (byte * 8)) & 0xFF];
+        }
+    }
+
+    scratch.resize(items.size());
+    std::vector<RenderItem>* source = &items;
+    std::vector<RenderItem>* target = &scratch;
+    for (uint32_t byte = 0; byte < 8; ++byte) {
+        std::array<uint32_t, 256>& count = counts[byte];
+        if (count[((*source)[0].sortKey >> (byte * 8)) & 0xFF] == items.size()) continue;
+
+        uint32_t offset = 0;
+        for (uint32_t& bucket : count) {
+            const uint32_t size = bucket;
+            bucket = offset;
+            offset += size;
+        }
+        for (const RenderItem& item : *source) {
+            (*target)[count[(item.sortKey >> (byte * 8)) & 0xFF]++] = item;
+        }
+        std::swap(source, target);
+    }
+    if (source != &items) items.swap(scratch);
+}
+
+RenderStateStats CountStateChanges(const std::vector<RenderItem>& items) {
+    RenderStateStats stats;
+    const Shader* shader = nullptr;
+    const Material* material = nullptr;
+    const Mesh* mesh = nullptr;
+    for (const RenderItem& item : items) {
+        if (item.hidden) continue;
+        ++stats.items;
+        stats.shaderChanges += item.shader != shader;
+        stats.materialChanges += item.material != material;
+        stats.meshChanges += item.mesh != mesh;
+        shader = item.shader;
+        material = item.material;
+        mesh = item.mesh;
+    }
+    return stats;
+}
+
+} // namespace RenderQueue
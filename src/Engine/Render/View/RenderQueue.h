@@ -0,0 +1,109 @@
+#ifndef RENDER_QUEUE_H
+#define RENDER_QUEUE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+struct RenderItem;
+
+/**
+ * @brief Where an item goes in the frame; the pass is the most significant part of its sort key
+ */
+enum class RenderPass : uint8_t {
+    Opaque = 0,
+    Shadow = 1,
+    Overlay = 2 // Not drawn by the main pass (occluded items kept for the selection outline)
+};
+
+/**
+ * @brief GL state changes of one submission order
+ */
+struct RenderStateStats {
+    uint32_t items = 0;
+    uint32_t shaderChanges = 0;
+    uint32_t materialChanges = 0;
+    uint32_t meshChanges = 0;
+
+    [[nodiscard]] uint32_t Total() const { return shaderChanges + materialChanges + meshChanges; }
+};
+
+/**
+ * @brief Small dense ids for pointers, so they fit in a few bits of a sort key
+ *
+ * Ids follow first use and are only stable until Clear.
+ */
+class RenderKeyIds {
+public:
+    uint32_t Get(const void* object);
+    void Clear() { m_Ids.clear(); }
+
+private:
+    std::unordered_map<const void*, uint32_t> m_Ids;
+};
+
+/**
+ * @brief Dense ids for what a material binds for an instanced draw, starting at 1
+ *
+ * Materials with the same instanced program, texture and parameter block get
+ * the same id, so objects that each own a Material can still share a draw.
+ */
+class DrawStateIds {
+public:
+    uint32_t Get(const void* instancedShader, const void* texture, uint32_t blockIndex);
+    void Clear() { m_Ids.clear(); }
+
+private:
+    struct Key {
+        const void* instancedShader;
+        const void* texture;
+        uint32_t blockIndex;
+        bool operator==(const Key&) const = default;
+    };
+    struct KeyHash {
+        size_t operator()(const Key& key) const;
+    };
+    std::unordered_map<Key, uint32_t, KeyHash> m_Ids;
+};
+
+namespace RenderQueue {
+
+// Bits per field, from the most significant: pass | shader | material | mesh | depth
+constexpr uint32_t kPassBits = 4;
+constexpr uint32_t kShaderBits = 12;
+constexpr uint32_t kMaterialBits = 14;
+constexpr uint32_t kMeshBits = 14;
+constexpr uint32_t kDepthBits = 20;
+static_assert(kPassBits + kShaderBits + kMaterialBits + kMeshBits + kDepthBits == 64);
+
+/**
+ * @brief Pack an item's state into a key whose ascending order needs the fewest binds
+ *
+ * Ids wider than their field wrap around; that only costs extra binds, since
+ * submission compares the real pointers.
+ *
+ * @param viewDepth Distance along the view direction, drawn front to back; negative values count as 0
+ */
+[[nodiscard]] uint64_t MakeKey(RenderPass pass, uint32_t shader, uint32_t material, uint32_t mesh, float viewDepth);
+
+[[nodiscard]] RenderPass GetPass(uint64_t key);
+
+/**
+ * @brief Stable LSD radix sort of the items by sortKey
+ *
+ * Byte columns every key agrees on are skipped, so a view with a single pass
+ * and few shaders takes far fewer than eight passes.
+ */
+void Sort(std::vector<RenderItem>& items, std::vector<RenderItem>& scratch);
+
+/**
+ * @brief Count the shader, material and mesh binds of drawing the items in order
+ *
+ * Hidden items are not drawn and not counted.
+ */
+[[nodiscard]] RenderStateStats CountStateChanges(const std::vector<RenderItem>& items);
+
+} // namespace RenderQueue
+
+#endif // RENDER_QUEUE_H
@@ -0,0 +1,42 @@
+#include "RenderView.h"
+
+void RenderView::Reset(const glm::mat4& view, const glm::mat4& projection, const uint64_t frame) {
+    m_Items.clear();
+    m_Batches.clear();
+    m_Instances.clear();
+    m_ShaderIds.Clear();
+    m_MaterialIds.Clear();
+    m_MeshIds.Clear();
+    m_DrawStates.Clear();
+    m_View = view;
+    m_Projection = projection;
+    m_ViewProjection = projection * view;
+    m_Eye = glm::vec3(glm::inverse(view)[3]);
+    m_Frame = frame;
+    m_Valid = true;
+}
+
+uint64_t RenderView::MakeSortKey(const RenderPass pass, const Shader* shader, const Material* material,
+                                 const Mesh* mesh, const float viewDepth) {
+    return RenderQueue::MakeKey(pass, m_ShaderIds.Get(shader), m_MaterialIds.Get(material), m_MeshIds.Get(mesh),
+                                viewDepth);
+}
+
+uint64_t RenderView::MakeSortKey(const RenderPass pass, const Shader* shader, const uint32_t drawState,
+                                 const Mesh* mesh, const float viewDepth) {
+    return RenderQueue::MakeKey(pass, m_ShaderIds.Get(shader), drawState, m_MeshIds.Get(mesh), viewDepth);
+}
+
+void RenderView::Sort() {
+    m_UnsortedStats = RenderQueue::CountStateChanges(m_Items);
+    RenderQueue::Sort(m_Items, m_SortScratch);
+    m_SortedStats = RenderQueue::CountStateChanges(m_Items);
+}
+
+void RenderView::BuildBatches(const uint32_t minInstances) {
+    InstanceBatching::Build(m_Items, m_Batches, m_Instances, minInstances);
+}
+
+bool RenderView::IsCurrent(const glm::mat4& view, const glm::mat4& projection, const uint64_t frame) const {
+    return m_Valid && m_Frame == frame && m_View == view && m_Projection == projection;
+}
@@ -0,0 +1,112 @@
+#ifndef RENDER_VIEW_H
+#define RENDER_VIEW_H
+
+#include <cstdint>
+#include <vector>
+#include <glm/glm.hpp>
+#include "RenderQueue.h"
+#include "InstanceBatch.h"
+
+class Mesh;
+class Material;
+class Shader;
+
+/**
+ * @brief One mesh to draw, flattened out of the GameObject hierarchy
+ */
+struct RenderItem {
+    glm::mat4 world{1.0f};
+    Mesh* mesh = nullptr;
+    Material* material = nullptr;
+    Shader* shader = nullptr; // The material's shader for this pass
+    uint64_t sortKey = 0;
+    uint32_t objectId = 0; // GameObject instance id, for the ID buffer and selection
+    bool hidden = false;   // In the frustum but occluded; only overlays such as the selection outline draw it
+    bool instanceable = false; // The material has an instanced shader and the mesh is drawn whole
+    uint32_t drawState = 0;    // RenderView::GetDrawState of the material; 0 = only the same material matches
+    const glm::mat4* positionDecode = nullptr; // Mesh::GetPositionDecode; null when positions are stored as is
+
+    // Model matrix for the vertex shader: world with the mesh's position decode folded in
+    [[nodiscard]] glm::mat4 VertexModel() const { return positionDecode ? world * *positionDecode : world; }
+};
+
+/**
+ * @brief Everything one camera (or light) draws in one frame
+ *
+ * Scene builds a view once per frame and camera; the shadow pass, the scene
+ * and game panels and the selection outline all read the same items instead
+ * of walking the hierarchy and looking up components again. Items are sorted
+ * by sortKey (see RenderQueue), so passes can skip redundant shader, material
+ * and mesh binds.
+ */
+class RenderView {
+public:
+    /**
+     * @brief Drop the items and start a view for new matrices
+     */
+    void Reset(const glm::mat4& view, const glm::mat4& projection, uint64_t frame);
+
+    void Add(const RenderItem& item) { m_Items.push_back(item); }
+
+    /**
+     * @brief Sort key for an item of this view; ids are dense within the view
+     */
+    [[nodiscard]] uint64_t MakeSortKey(RenderPass pass, const Shader* shader, const Material* material,
+                                       const Mesh* mesh, float viewDepth);
+    // Same, keyed by a draw state id instead of the material, so equal materials sort together
+    [[nodiscard]] uint64_t MakeSortKey(RenderPass pass, const Shader* shader, uint32_t drawState,
+                                       const Mesh* mesh, float viewDepth);
+
+    // Id for RenderItem::drawState, dense within the view (see DrawStateIds)
+    [[nodiscard]] uint32_t GetDrawState(const void* instancedShader, const void* texture, uint32_t blockIndex) {
+        return m_DrawStates.Get(instancedShader, texture, blockIndex);
+    }
+
+    // Stable, so equal keys keep extraction order. Records the state changes before and after
+    void Sort();
+
+    // Group the sorted items into draw calls (see InstanceBatching::Build)
+    void BuildBatches(uint32_t minInstances = InstanceBatching::kMinInstances);
+
+    /**
+     * @brief True if the view was built this frame for the same matrices and can be drawn again
+     */
+    [[nodiscard]] bool IsCurrent(const glm::mat4& view, const glm::mat4& projection, uint64_t frame) const;
+
+    // Force the next IsCurrent to fail
+    void Invalidate() { m_Valid = false; }
+
+    [[nodiscard]] const std::vector<RenderItem>& GetItems() const { return m_Items; }
+    [[nodiscard]] std::vector<RenderItem>& GetItems() { return m_Items; }
+    [[nodiscard]] const glm::mat4& GetView() const { return m_View; }
+    [[nodiscard]] const glm::mat4& GetProjection() const { return m_Projection; }
+    [[nodiscard]] const glm::mat4& GetViewProjection() const { return m_ViewProjection; }
+    [[nodiscard]] const glm::vec3& GetEye() const { return m_Eye; }
+
+    [[nodiscard]] const std::vector<InstanceBatch>& GetBatches() const { return m_Batches; }
+    [[nodiscard]] const std::vector<InstanceData>& GetInstances() const { return m_Instances; }
+
+    // Binds needed in extraction order and in sorted order, from the last Sort
+    [[nodiscard]] const RenderStateStats& GetUnsortedStats() const { return m_UnsortedStats; }
+    [[nodiscard]] const RenderStateStats& GetSortedStats() const { return m_SortedStats; }
+
+private:
+    std::vector<RenderItem> m_Items;
+    std::vector<RenderItem> m_SortScratch;
+    std::vector<InstanceBatch> m_Batches;
+    std::vector<InstanceData> m_Instances;
+    RenderKeyIds m_ShaderIds;
+    RenderKeyIds m_MaterialIds;
+    RenderKeyIds m_MeshIds;
+    DrawStateIds m_DrawStates;
+    RenderStateStats m_UnsortedStats;
+    RenderStateStats m_SortedStats;
+    glm::mat4 m_View{1.0f};
+    glm::mat4 m_Projection{1.0f};
+    glm::mat4 m_ViewProjection{1.0f};
+    glm::vec3 m_Eye{0.0f};
+    uint64_t m_Frame = 0;
+    bool m_Valid = false;
+};
+
+#endif // RENDER_VIEW_H
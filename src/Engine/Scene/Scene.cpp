@@ -4,8 +4,10 @@
 #include "Engine/Component/MeshComponent.h"
 #include "Engine/Component/TransformComponent.h"
 #include "Engine/Render/Shader/Shader.h"
-#include "Engine/Render/Primitives/Primitives.h"
+#include "Engine/Render/Shader/ShaderLibrary.h"
+#include "Engine/Render/Primitives/PrimitiveCache.h"
 #include "Editor/SelectionManager.h"
+#include "Engine/Spatial/MeshRaycast.h"
 #include <iostream>
 #include <algorithm>
 #include <filesystem>
@@ -25,6 +27,7 @@ std::shared_ptr<GameObject> Scene::CreateGameObject(const std::string &name) {
     auto obj = std::make_shared<GameObject>();
     obj->name = name;
     m_GameObjects.push_back(obj);
+    m_PartitionDirty = true;
     return obj;
 }
 
@@ -38,12 +41,6 @@ void Scene::LoadDefaultScene() {
     m_DynamicsWorld = new btDiscreteDynamicsWorld(m_Dispatcher, m_Broadphase, m_Solver, m_CollisionConfiguration);
     m_DynamicsWorld->setGravity(btVector3(0, -9.81f, 0));
 
-    // Set up shader for all objects
-    const std::string shaderPath = "../src/shaders/";
-    const auto defaultShader = std::make_shared<Shader>(
-        (shaderPath + "simple.vert").c_str(),
-        (shaderPath + "simple.frag").c_str()
-    );
 
 
     /*const auto defaultShader0 = std::make_shared<Shader>(
@@ -91,12 +88,12 @@ void Scene::LoadDefaultScene() {
     auto cubeTransform = cubeObj->AddComponent<TransformComponent>();
     cubeTransform->position = glm::vec3(-10.0f, 0.5f, 0.0f);
     auto cubeMesh = cubeObj->AddComponent<MeshComponent>();
-    cubeMesh->SetMesh(Primitives::CreateCube());
+    cubeMesh->SetMesh(PrimitiveCache::GetInstance().GetCube());
     auto cubeRenderer = cubeObj->AddComponent<MeshRendererComponent>();
     {
         auto material = std::make_shared<Material>();
         material->SetShadowMapShader(m_ShadowMapProgram);
-        material->SetShader(m_DefaultShader);
+        UseDefaultShaders(*material);
         cubeRenderer->SetMaterial(material);
     }
 
@@ -105,12 +102,12 @@ void Scene::LoadDefaultScene() {
     auto sphereTransform = sphereObj->AddComponent<TransformComponent>();
     sphereTransform->position = glm::vec3(-6.0f, 5.0f, 0.0f);
     auto sphereMesh = sphereObj->AddComponent<MeshComponent>();
-    sphereMesh->SetMesh(Primitives::CreateSphere(1.0f, 32));
+    sphereMesh->SetMesh(PrimitiveCache::GetInstance().GetSphere(1.0f, 32));
     auto sphereRenderer = sphereObj->AddComponent<MeshRendererComponent>();
     {
         auto material = std::make_shared<Material>();
         material->SetShadowMapShader(m_ShadowMapProgram);
-        material->SetShader(m_DefaultShader);
+        UseDefaultShaders(*material);
         sphereRenderer->SetMaterial(material);
     }
 
@@ -152,12 +149,13 @@ void Scene::LoadDefaultScene() {
     planeTransform->position = glm::vec3(-2.0f, 0.0f, 0.0f);
     planeTransform->scale = glm::vec3(20.0f, 0.0f, 20.0f);
     auto planeMesh = planeObj->AddComponent<MeshComponent>();
-    planeMesh->SetMesh(Primitives::CreatePlane(2.0f, 2.0f, 1));
+    planeMesh->SetMesh(PrimitiveCache::GetInstance().GetPlane(2.0f, 2.0f, 1));
+    planeObj->SetStatic(true); // Zemin hiç hareket etmiyor
     auto planeRenderer = planeObj->AddComponent<MeshRendererComponent>();
     {
         auto material = std::make_shared<Material>();
         material->SetShadowMapShader(m_ShadowMapProgram);
-        material->SetShader(m_DefaultShader);
+        UseDefaultShaders(*material);
         auto planeTexture = std::make_shared<Texture>("../src/Engine/Render/Texture/TextureImages/planks.png", GL_TEXTURE_2D, GL_TEXTURE0, GL_RGBA, GL_UNSIGNED_BYTE);
         material->SetTexture(planeTexture);
         planeRenderer->SetMaterial(material);
@@ -187,12 +185,12 @@ void Scene::LoadDefaultScene() {
     auto quadTransform = quadObj->AddComponent<TransformComponent>();
     quadTransform->position = glm::vec3(2.0f, 1.0f, 0.0f);
     auto quadMesh = quadObj->AddComponent<MeshComponent>();
-    quadMesh->SetMesh(Primitives::CreateQuad(2.0f, 1.0f));
+    quadMesh->SetMesh(PrimitiveCache::GetInstance().GetQuad(2.0f, 1.0f));
     auto quadRenderer = quadObj->AddComponent<MeshRendererComponent>();
     {
         auto material = std::make_shared<Material>();
         material->SetShadowMapShader(m_ShadowMapProgram);
-        material->SetShader(m_DefaultShader);
+        UseDefaultShaders(*material);
         auto quadTexture = std::make_shared<Texture>("../src/Engine/Render/Texture/TextureImages/brick.png", GL_TEXTURE_2D, GL_TEXTURE0, GL_RGBA, GL_UNSIGNED_BYTE);
         material->SetTexture(quadTexture);
         quadRenderer->SetMaterial(material);
@@ -203,12 +201,12 @@ void Scene::LoadDefaultScene() {
     auto cylinderTransform = cylinderObj->AddComponent<TransformComponent>();
     cylinderTransform->position = glm::vec3(6.0f, 1.0f, 0.0f);
     auto cylinderMesh = cylinderObj->AddComponent<MeshComponent>();
-    cylinderMesh->SetMesh(Primitives::CreateCylinder(1.0f, 2.0f, 32));
+    cylinderMesh->SetMesh(PrimitiveCache::GetInstance().GetCylinder(1.0f, 2.0f, 32));
     auto cylinderRenderer = cylinderObj->AddComponent<MeshRendererComponent>();
     {
         auto material = std::make_shared<Material>();
         material->SetShadowMapShader(m_ShadowMapProgram);
-        material->SetShader(m_DefaultShader);
+        UseDefaultShaders(*material);
         cylinderRenderer->SetMaterial(material);
     }
 
@@ -217,12 +215,12 @@ void Scene::LoadDefaultScene() {
     auto capsuleTransform = capsuleObj->AddComponent<TransformComponent>();
     capsuleTransform->position = glm::vec3(10.0f, 1.0f, 0.0f);
     auto capsuleMesh = capsuleObj->AddComponent<MeshComponent>();
-    capsuleMesh->SetMesh(Primitives::CreateCapsule(1.0f, 2.0f, 32));
+    capsuleMesh->SetMesh(PrimitiveCache::GetInstance().GetCapsule(1.0f, 2.0f, 32));
     auto capsuleRenderer = capsuleObj->AddComponent<MeshRendererComponent>();
     {
         auto material = std::make_shared<Material>();
         material->SetShadowMapShader(m_ShadowMapProgram);
-        material->SetShader(m_DefaultShader);
+        UseDefaultShaders(*material);
         capsuleRenderer->SetMaterial(material);
     }
 
@@ -230,16 +228,6 @@ void Scene::LoadDefaultScene() {
     // Consider using a z-position of around -15 to -20
 }
 std::shared_ptr<GameObject> Scene::CreatePrimitive(const std::string& primitiveType) {
-    const std::string shaderPath = "../src/shaders/";
-    const auto defaultShader = std::make_shared<Shader>(
-        (shaderPath + "simple.vert").c_str(),
-        (shaderPath + "simple.frag").c_str()
-    );
-    const auto defaultShader0 = std::make_shared<Shader>(
-        (shaderPath + "default.vert").c_str(),
-        (shaderPath + "default.frag").c_str()
-    );
-
     auto obj = CreateGameObject(primitiveType);
 
     // Her primitive için mutlaka bir TransformComponent ekle
@@ -248,12 +236,13 @@ std::shared_ptr<GameObject> Scene::CreatePrimitive(const std::string& primitiveT
     auto mesh = obj->AddComponent<MeshComponent>();
     auto renderer = obj->AddComponent<MeshRendererComponent>();
     auto material = std::make_shared<Material>();
-    material->SetShader(defaultShader0);
+    // Shared with every other primitive; each variant compiles once
+    UseDefaultShaders(*material);
 
     if (primitiveType == "Cube") {
-        mesh->SetMesh(Primitives::CreateCube());
+        mesh->SetMesh(PrimitiveCache::GetInstance().GetCube());
     } else if (primitiveType == "Sphere") {
-        mesh->SetMesh(Primitives::CreateSphere(1.0f, 32));
+        mesh->SetMesh(PrimitiveCache::GetInstance().GetSphere(1.0f, 32));
     } else if (primitiveType == "Plane") {
         auto transform = obj->GetComponent<TransformComponent>();
         if (transform) {
@@ -261,21 +250,17 @@ std::shared_ptr<GameObject> Scene::CreatePrimitive(const std::string& primitiveT
         }
         auto mesh = obj->GetComponent<MeshComponent>();
         if (mesh) {
-            mesh->SetMesh(Primitives::CreatePlane(2.0f, 2.0f, 1));
-        }
-        auto renderer = obj->GetComponent<MeshRendererComponent>();
-        if (renderer) {
-            renderer->SetShader(defaultShader0);
+            mesh->SetMesh(PrimitiveCache::GetInstance().GetPlane(2.0f, 2.0f, 1));
         }
     } else if (primitiveType == "Quad") {
-        mesh->SetMesh(Primitives::CreateQuad(2.0f, 1.0f));
+        mesh->SetMesh(PrimitiveCache::GetInstance().GetQuad(2.0f, 1.0f));
         auto quadTexture = std::make_shared<Texture>("../src/Engine/Render/Texture/TextureImages/brick.png",
                                                       GL_TEXTURE_2D, GL_TEXTURE0, GL_RGBA, GL_UNSIGNED_BYTE);
         material->SetTexture(quadTexture);
     } else if (primitiveType == "Cylinder") {
-        mesh->SetMesh(Primitives::CreateCylinder(1.0f, 2.0f, 32));
+        mesh->SetMesh(PrimitiveCache::GetInstance().GetCylinder(1.0f, 2.0f, 32));
     } else if (primitiveType == "Capsule") {
-        mesh->SetMesh(Primitives::CreateCapsule(1.0f, 2.0f, 32));
+        mesh->SetMesh(PrimitiveCache::GetInstance().GetCapsule(1.0f, 2.0f, 32));
     } else {
         std::cerr << "Unknown primitive: " << primitiveType << std::endl;
         return obj;
@@ -287,6 +272,28 @@ std::shared_ptr<GameObject> Scene::CreatePrimitive(const std::string& primitiveT
     return obj;
 }
 
+void Scene::UseDefaultShaders(Material& material) const {
+    const std::string shaderPath = "../src/shaders/";
+    material.SetShaderVariants(shaderPath + "default.vert", shaderPath + "default.frag",
+                               shaderPath + "default_instanced.vert");
+}
+
+Shader* Scene::GetFallbackShader(const bool instanced) {
+    std::shared_ptr<Shader>& fallback = instanced ? m_InstancedFallbackShader : m_FallbackShader;
+    if (!fallback) {
+        // Blocking, once: the fallback is what everything else waits behind
+        const std::string shaderPath = "../src/shaders/";
+        try {
+            fallback = ShaderLibrary::GetInstance().Get(
+                shaderPath + (instanced ? "default_instanced.vert" : "default.vert"), shaderPath + "fallback.frag");
+        } catch (const std::exception& e) {
+            std::cerr << "Failed to load fallback shader: " << e.what() << std::endl;
+            return nullptr;
+        }
+    }
+    return fallback->IsReady() ? fallback.get() : nullptr;
+}
+
 // Overload: CreatePrimitive with position
 std::shared_ptr<GameObject> Scene::CreatePrimitive(const std::string& primitiveType, const glm::vec3& position) {
     auto obj = CreatePrimitive(primitiveType);
@@ -305,6 +312,8 @@ bool Scene::LoadSceneFromFile(const std::string &path) {
 }
 
 void Scene::UpdateAll(const float dt) {
+    // New frame: render views extracted last frame are stale
+    ++m_FrameIndex;
 
     // Fizik dünyasını güncelle
     if (m_DynamicsWorld)
@@ -331,37 +340,555 @@ void Scene::UpdateAll(const float dt) {
     // Kuvveti uygula (her karede sağa doğru)
     //m_RigidBodies[0]->applyCentralForce(btVector3(11.0f, 0.0f, 0.0f)); // sağa doğru kuvvet
 
+    // Yakınlık sorguları için grid'i bu karenin transform'larına getir
+    SyncSpatialGrid();
 }
 
 void Scene::DrawAll() {
-    // Set the camera position for shaders if a camera is attached
-    if (m_Camera) {
-        Material::SetCameraPosition(m_Camera->GetPosition());
-        // Updated line to correctly print camera position:
+    Mesh::ResetMeshletStats();
+    const RenderView& view = GetCameraView();
+    // Camera and light go up once per pass; the loop below only sets per-object uniforms
+    UploadFrameUniforms(view);
+    // Only material blocks edited since the last pass
+    m_MaterialBlocks.Upload(MaterialBlockPool::GetInstance());
+
+    // Items are sorted by shader, material and mesh: each is bound once per run,
+    // and a run sharing mesh and material is a single instanced draw
+    m_DrawCallStats = {};
+    m_InstanceBuffer.Upload(view.GetInstances());
+    const std::vector<RenderItem>& items = view.GetItems();
+    const std::vector<InstanceBatch>& batches = view.GetBatches();
+
+    // With multi-draw indirect, the instanced batches of one material are a single call
+    // whatever their meshes: all of them live in the geometry arena behind one VAO
+    const bool indirect = IndirectBuffer::IsSupported();
+    if (indirect) {
+        m_IndirectCommands.clear();
+        for (const InstanceBatch& batch : batches) {
+            if (!batch.instanced) continue;
+            m_IndirectCommands.push_back(
+                items[batch.firstItem].mesh->MakeIndirectCommand(batch.itemCount, batch.firstInstance));
+        }
+        if (!m_IndirectCommands.empty()) {
+            m_IndirectBuffer.Upload(m_IndirectCommands);
+            // baseInstance offsets the attributes, so they point at instance 0 for the whole pass
+            GeometryArena::GetInstance().Bind();
+            m_InstanceBuffer.BindAttributes(0);
+        }
+    }
+
+    const Shader* lastShader = nullptr;
+    const Material* lastMaterial = nullptr;
+    Mesh* lastMesh = nullptr;
+    uint32_t nextCommand = 0;
+    for (size_t b = 0; b < batches.size(); ++b) {
+        const InstanceBatch& batch = batches[b];
+        const RenderItem& item = items[batch.firstItem];
+        Shader* shader = batch.instanced ? item.material->GetInstancedShader().get() : item.shader;
+        if (!shader->IsReady()) {
+            // Still compiling (or failed to link): draw flat instead of stalling on the driver
+            shader = GetFallbackShader(batch.instanced);
+            if (!shader) {
+                if (batch.instanced && indirect) ++nextCommand; // Keep later runs on their commands
+                continue;
+            }
+            ++m_DrawCallStats.fallbackDraws;
+        }
+
+        if (item.material != lastMaterial || shader != lastShader) {
+            item.material->ApplyWith(shader);
+            lastMaterial = item.material;
+        }
+        lastShader = shader;
+        if (item.mesh != lastMesh) {
+            item.mesh->Bind();
+            lastMesh = item.mesh;
+        }
+        ++m_DrawCallStats.drawCalls;
+
+        if (batch.instanced && indirect) {
+            // Instanced batches that follow with the same material state share its shader too
+            size_t end = b + 1;
+            // One indirect call has one index type, so a 16/32-bit switch starts a new call
+            const GLenum indexType = item.mesh->GetGeometry().indexType;
+            while (end < batches.size() && batches[end].instanced &&
+                   InstanceBatching::SharesDrawState(items[batches[end].firstItem], item) &&
+                   items[batches[end].firstItem].mesh->GetGeometry().indexType == indexType) {
+                m_DrawCallStats.instances += batches[end].itemCount;
+                ++end;
+            }
+            const auto count = static_cast<uint32_t>(end - b);
+            m_IndirectBuffer.Draw(nextCommand, count, indexType);
+            nextCommand += count;
+            ++m_DrawCallStats.indirectDraws;
+            m_DrawCallStats.indirectCommands += count;
+            m_DrawCallStats.instances += batch.itemCount;
+            b = end - 1;
+            continue;
+        }
+
+        if (batch.instanced) {
+            m_InstanceBuffer.BindAttributes(batch.firstInstance);
+            item.mesh->DrawBoundInstanced(batch.itemCount);
+            ++m_DrawCallStats.instancedDraws;
+            m_DrawCallStats.instances += batch.itemCount;
+            continue;
+        }
+
+        const Shader::EngineUniforms& uniforms = shader->GetEngineUniforms();
+        shader->set(uniforms.model, item.VertexModel());
+        // Object-ID buffer for GPU picking (ignored by render targets without an ID attachment)
+        shader->set(uniforms.objectId, item.objectId);
+        item.mesh->DrawBound(view.GetViewProjection(), item.world, view.GetEye());
+    }
+    Mesh::Unbind();
+}
 
+const RenderView& Scene::GetCameraView() {
+    if (!IsViewStale(m_CameraViewStamp) &&
+        m_CameraView.IsCurrent(m_ViewMatrix, m_ProjectionMatrix, m_FrameIndex)) {
+        return m_CameraView;
     }
+
+    UpdatePartition();
+    m_CameraView.Reset(m_ViewMatrix, m_ProjectionMatrix, m_FrameIndex);
+    m_CameraViewStamp = m_PartitionStamp;
+
+    // Projeksiyon henüz ayarlanmadıysa (ilk kare) frustum anlamsız, hepsini çiz
+    if (m_FrustumCullingEnabled && m_HasProjectionMatrix) {
+        const Math::Frustum frustum(m_CameraView.GetViewProjection());
+        m_FrustumCuller.Cull(m_RenderBounds, m_StaticBvh, m_DynamicBvh, frustum, m_FrustumIndices);
+        m_VisibleIndices = m_FrustumIndices;
+
+        if (m_PortalCullingEnabled && !m_CellComponents.empty()) {
+            UpdatePortalVisibility(frustum);
+            m_PortalCuller.Cull(m_RenderBounds, m_VisibleIndices);
+        }
+
+        if (m_OcclusionCullingEnabled) {
+            CullOccluded(m_CameraView.GetViewProjection());
+        }
+    } else {
+        m_FrustumIndices.resize(m_RenderObjects.size());
+        for (uint32_t i = 0; i < m_FrustumIndices.size(); ++i) {
+            m_FrustumIndices[i] = i;
+        }
+        m_VisibleIndices = m_FrustumIndices;
+    }
+
+    // Both lists are ascending; frustum entries missing from the visible list were occluded
+    size_t shown = 0;
+    for (const uint32_t slot : m_FrustumIndices) {
+        const bool hidden = shown >= m_VisibleIndices.size() || m_VisibleIndices[shown] != slot;
+        if (!hidden) ++shown;
+        AddRenderItem(m_CameraView, slot, false, hidden);
+    }
+    m_CameraView.Sort();
+    // Multi-draw indirect reaches every streamed item through baseInstance, so runs of one are streamed too
+    m_CameraView.BuildBatches(IndirectBuffer::IsSupported() ? 1 : InstanceBatching::kMinInstances);
+    return m_CameraView;
+}
+
+bool Scene::IsViewStale(const uint32_t viewStamp) const {
+    // Items hold raw mesh and material pointers: any structure change has to rebuild them
+    return m_PartitionDirty || m_StructureVersion != GameObject::GetStructureVersion() ||
+           viewStamp != m_PartitionStamp;
+}
+
+void Scene::AddRenderItem(RenderView& view, const uint32_t slot, const bool shadowPass, const bool hidden) {
+    const RenderSource& source = m_RenderSources[slot];
+    if (!source.renderer || !source.meshComponent || !source.transform) return;
+    if (!source.meshComponent->IsLoaded()) return;
+
+    Material* material = source.renderer->GetMaterial().get();
+    Mesh* mesh = source.meshComponent->GetMesh().get();
+    if (!material || !mesh) return;
+    Shader* shader = shadowPass ? material->GetShadowMapShader().get() : material->GetShader().get();
+    if (!shader) return;
+
+    RenderItem item;
+    item.world = source.transform->GetModelMatrix();
+    item.mesh = mesh;
+    item.positionDecode = &mesh->GetPositionDecode();
+    item.material = material;
+    item.shader = shader;
+    item.objectId = m_RenderObjects[slot]->GetInstanceID();
+    item.hidden = hidden;
+    // Meshlet-culled meshes cull per object, which an instanced draw cannot do
+    item.instanceable = !shadowPass && material->GetInstancedShader() && mesh->GetMeshlets().empty();
+    // Shadow maps only write depth with one shader: material and distance do not matter there
+    const float viewDepth = shadowPass ? 0.0f : -(view.GetView() * item.world[3]).z;
+    const RenderPass pass = shadowPass ? RenderPass::Shadow : hidden ? RenderPass::Overlay : RenderPass::Opaque;
+    if (shadowPass) {
+        item.sortKey = view.MakeSortKey(pass, shader, nullptr, mesh, viewDepth);
+    } else {
+        // Every primitive owns its Material; ones that bind the same state still sort and instance together
+        item.drawState = view.GetDrawState(material->GetInstancedShader().get(), material->GetTexture().get(),
+                                           material->GetBlockIndex());
+        item.sortKey = view.MakeSortKey(pass, shader, item.drawState, mesh, viewDepth);
+    }
+    view.Add(item);
+}
+
+void Scene::CullOccluded(const glm::mat4& viewProjection) {
+    m_OcclusionCuller.BeginFrame(viewProjection);
+
+    // Only occluders that survived frustum culling can hide anything on screen
+    for (const uint32_t index : m_VisibleIndices) {
+        if (!m_RenderObjects[index]->isOccluder) continue;
+
+        const RenderSource& source = m_RenderSources[index];
+        const Mesh* mesh = source.meshComponent ? source.meshComponent->GetMesh().get() : nullptr;
+        const TransformComponent* transform = source.transform;
+        if (!mesh || !transform) continue;
+
+        const auto& vertices = mesh->GetVertices();
+        const auto& indices = mesh->GetIndices();
+        if (vertices.empty() || indices.empty()) continue;
+
+        m_OcclusionCuller.AddOccluder(&vertices[0].position.x, vertices.size(), sizeof(Vertex),
+                                      indices.data(), indices.size(), transform->GetModelMatrix());
+    }
+
+    m_OcclusionCuller.Rasterize();
+
+    // Occluders are never tested: each sits in the depth it was just drawn into
+    m_OccludeeIndices.clear();
+    for (const uint32_t index : m_VisibleIndices) {
+        if (!m_RenderObjects[index]->isOccluder) m_OccludeeIndices.push_back(index);
+    }
+    m_OcclusionCuller.Cull(m_RenderBounds, m_OccludeeIndices);
+
+    // Both lists keep the frustum order, so survivors are merged back in one pass
+    size_t kept = 0;
+    size_t next = 0;
+    for (const uint32_t index : m_VisibleIndices) {
+        if (m_RenderObjects[index]->isOccluder) {
+            m_VisibleIndices[kept++] = index;
+        } else if (next < m_OccludeeIndices.size() && m_OccludeeIndices[next] == index) {
+            m_VisibleIndices[kept++] = index;
+            ++next;
+        }
+    }
+    m_VisibleIndices.resize(kept);
+}
+
+void Scene::UpdatePartition() {
+    if (m_PartitionDirty || m_StructureVersion != GameObject::GetStructureVersion()) {
+        RebuildPartition();
+        m_RefitFrame = m_FrameIndex;
+        return;
+    }
+
+    // SyncSpatialGrid, the views and the queries all ask within one frame; the first call refits for all
+    if (m_RefitFrame == m_FrameIndex) return;
+    m_RefitFrame = m_FrameIndex;
+
+    // Nothing static changed: the static slots and tree are not touched at all
+    const auto count = static_cast<uint32_t>(m_RenderObjects.size());
+    for (uint32_t slot = m_StaticCount; slot < count; ++slot) {
+        m_RenderBounds.Set(slot, m_RenderObjects[slot]->GetWorldAABB());
+    }
+    m_DynamicBvh.Refit(m_RenderBounds);
+
+    if (m_DynamicBvh.GetCost() > kDynamicBvhRebuildRatio * m_DynamicBvh.GetBuildCost()) {
+        BuildPartitionTree(m_DynamicBvh, m_StaticCount, count);
+    }
+}
+
+void Scene::RebuildPartition() {
+    m_RenderObjects.clear();
+    m_RenderObjects.reserve(m_GameObjects.size());
     for (const auto &obj: m_GameObjects) {
-        obj->Draw();
+        GatherRenderObjectsRecursive(obj.get());
+    }
+
+    const auto staticEnd = std::stable_partition(m_RenderObjects.begin(), m_RenderObjects.end(),
+                                                 [](const GameObject* object) { return object->IsStatic(); });
+    m_StaticCount = static_cast<uint32_t>(staticEnd - m_RenderObjects.begin());
+
+    m_RenderBounds.Clear();
+    m_RenderBounds.Reserve(m_RenderObjects.size());
+    for (const GameObject* object : m_RenderObjects) {
+        m_RenderBounds.Add(object->GetWorldAABB());
+    }
+
+    const auto count = static_cast<uint32_t>(m_RenderObjects.size());
+    m_RenderSources.resize(count);
+    BuildPartitionTree(m_StaticBvh, 0, m_StaticCount);
+    BuildPartitionTree(m_DynamicBvh, m_StaticCount, count);
+
+    m_CellComponents.clear();
+    m_PortalComponents.clear();
+    for (const GameObject* object : m_RenderObjects) {
+        if (auto cell = object->GetComponent<CellComponent>(); cell && cell->isEnabled) {
+            m_CellComponents.push_back(std::move(cell));
+        }
+        if (auto portal = object->GetComponent<PortalComponent>(); portal && portal->isEnabled) {
+            m_PortalComponents.push_back(std::move(portal));
+        }
+    }
+
+    m_StructureVersion = GameObject::GetStructureVersion();
+    m_PartitionDirty = false;
+    ++m_PartitionStamp;
+}
+
+void Scene::UpdatePortalVisibility(const Math::Frustum& cameraFrustum) {
+    m_PortalCuller.Clear();
+    for (const auto& cell : m_CellComponents) {
+        m_PortalCuller.AddCell(cell->GetWorldBounds());
+    }
+
+    // Cell indices follow m_CellComponents; a portal to an object without a cell is skipped
+    const auto findCell = [this](const std::shared_ptr<GameObject>& object) {
+        for (uint32_t i = 0; i < m_CellComponents.size(); ++i) {
+            if (object && m_CellComponents[i]->owner == object) return i;
+        }
+        return PortalCuller::kNoCell;
+    };
+    for (const auto& portal : m_PortalComponents) {
+        const uint32_t cellA = findCell(portal->GetCellA());
+        const uint32_t cellB = findCell(portal->GetCellB());
+        if (cellA == PortalCuller::kNoCell || cellB == PortalCuller::kNoCell) continue;
+
+        const auto corners = portal->GetWorldCorners();
+        m_PortalCuller.AddPortal(cellA, cellB, corners);
+    }
+
+    const glm::vec3 eye(glm::inverse(m_ViewMatrix)[3]);
+    m_PortalCuller.ComputeVisibility(eye, cameraFrustum);
+}
+
+void Scene::BuildPartitionTree(Spatial::Bvh& tree, const uint32_t begin, const uint32_t end) {
+    tree.Build(m_RenderBounds, begin, end, m_BvhOrder);
+
+    m_BvhReorder.assign(m_RenderObjects.begin() + begin, m_RenderObjects.begin() + end);
+    for (uint32_t i = 0; i < m_BvhOrder.size(); ++i) {
+        GameObject* object = m_BvhReorder[m_BvhOrder[i]];
+        m_RenderObjects[begin + i] = object;
+        m_RenderBounds.Set(begin + i, object->GetWorldAABB());
+
+        // Component lookups happen here, not per frame; adding or removing components regathers
+        RenderSource& source = m_RenderSources[begin + i];
+        source.renderer = object->GetComponent<MeshRendererComponent>().get();
+        source.meshComponent = object->GetComponent<MeshComponent>().get();
+        source.transform = object->GetComponent<TransformComponent>().get();
+    }
+}
+
+void Scene::GatherRenderObjectsRecursive(GameObject* object) {
+    // Inactive objects hide their whole subtree, same as GameObject::Draw
+    if (!object->IsActive()) return;
+
+    m_RenderObjects.push_back(object);
+
+    for (const auto &child: object->GetChildren()) {
+        GatherRenderObjectsRecursive(child.get());
     }
 }
 //**//**//**//**//**//**//**//**//**//**//**//**//**//**//
 //**//**//**//**//**//**//**//**//**//**//**//**//**//**//
 void Scene::DrawAll2ShadowMap() {
+    const RenderView& view = GetShadowView();
+    UploadFrameUniforms(view);
+
+    const Shader* lastShader = nullptr;
+    Mesh* lastMesh = nullptr;
+    for (const RenderItem& item : view.GetItems()) {
+        // Apply2ShadowMap only binds the shadow shader
+        if (item.shader != lastShader) {
+            item.material->Apply2ShadowMap();
+            lastShader = item.shader;
+        }
+        item.shader->set(item.shader->GetEngineUniforms().model, item.VertexModel());
+        if (item.mesh != lastMesh) {
+            item.mesh->Bind();
+            lastMesh = item.mesh;
+        }
+        item.mesh->DrawBound();
+    }
+    Mesh::Unbind();
+}
 
-    for (const auto &obj: m_GameObjects) {
-        obj->Draw2ShadowMap();
+const RenderView& Scene::GetShadowView() {
+    const glm::mat4 cameraViewProjection = m_ProjectionMatrix * m_ViewMatrix;
+    if (!IsViewStale(m_ShadowViewStamp) &&
+        m_ShadowView.IsCurrent(m_LightSpaceMatrix, glm::mat4(1.0f), m_FrameIndex) &&
+        m_ShadowViewCamera == cameraViewProjection) {
+        return m_ShadowView;
     }
+
+    UpdatePartition();
+    m_ShadowView.Reset(m_LightSpaceMatrix, glm::mat4(1.0f), m_FrameIndex);
+    m_ShadowViewStamp = m_PartitionStamp;
+    m_ShadowViewCamera = cameraViewProjection;
+
+    // Işık ya da kamera bilinmiyorsa eski davranış: her şey gölge atar
+    if (m_FrustumCullingEnabled && m_HasShadowLight && m_HasProjectionMatrix) {
+        const Math::Frustum lightFrustum(m_LightSpaceMatrix);
+        const Math::Frustum cameraFrustum(cameraViewProjection);
+        m_ShadowCasterCuller.Cull(m_RenderBounds, lightFrustum, cameraFrustum,
+                                  m_LightDirection, m_ShadowLength, m_ShadowCasterIndices);
+
+        // Görünmeyen odalardaki nesneler gölge de atmaz
+        if (m_PortalCullingEnabled && !m_CellComponents.empty()) {
+            UpdatePortalVisibility(cameraFrustum);
+            m_PortalCuller.Cull(m_RenderBounds, m_ShadowCasterIndices);
+        }
+    } else {
+        m_ShadowCasterIndices.resize(m_RenderObjects.size());
+        for (uint32_t i = 0; i < m_ShadowCasterIndices.size(); ++i) {
+            m_ShadowCasterIndices[i] = i;
+        }
+    }
+
+    for (const uint32_t slot : m_ShadowCasterIndices) {
+        AddRenderItem(m_ShadowView, slot, true, false);
+    }
+    m_ShadowView.Sort();
+    return m_ShadowView;
+}
+
+void Scene::UploadFrameUniforms(const RenderView& view) {
+    FrameUniformData data;
+    data.view = view.GetView();
+    data.projection = view.GetProjection();
+    data.viewProjection = view.GetViewProjection();
+    data.lightSpaceMatrix = m_LightSpaceMatrix;
+    data.camPos = glm::vec4(view.GetEye(), 1.0f);
+    // Shaders want the direction towards the light
+    data.lightDirection = glm::vec4(-m_LightDirection, 0.0f);
+    data.lightColor = glm::vec4(m_LightColor, m_AmbientStrength);
+    m_FrameUniforms.Upload(data);
+}
+
+void Scene::SetLightColor(const glm::vec3& color, const float ambientStrength) {
+    m_LightColor = color;
+    m_AmbientStrength = ambientStrength;
+}
+
+void Scene::SetShadowLight(const glm::mat4& lightSpaceMatrix, const glm::vec3& lightDirection,
+                           const float shadowLength) {
+    m_LightSpaceMatrix = lightSpaceMatrix;
+    m_LightDirection = glm::normalize(lightDirection);
+    m_ShadowLength = shadowLength;
+    m_HasShadowLight = true;
 }
 //**//**//**//**//**//**//**//**//**//**//**//**//**//**//
 //**//**//**//**//**//**//**//**//**//**//**//**//**//**//
 
 bool Scene::HasGameObject(const std::shared_ptr<GameObject>& obj) const {
+    if (!obj) return false;
+
+    // Children are not listed in m_GameObjects; check their root instead
+    std::shared_ptr<GameObject> root = obj;
+    while (auto parent = root->GetParent()) {
+        root = parent;
+    }
+
     for (const auto& existing : m_GameObjects) {
-        if (existing == obj) return true;
+        if (existing == root) return true;
     }
     return false;
 }
 
+void Scene::QueryFrustum(const Math::Frustum& frustum, std::vector<std::shared_ptr<GameObject>>& outObjects) {
+    outObjects.clear();
+    UpdatePartition();
+    m_QueryCuller.Cull(m_RenderBounds, m_StaticBvh, m_DynamicBvh, frustum, m_QueryIndices);
+
+    outObjects.reserve(m_QueryIndices.size());
+    for (const uint32_t index : m_QueryIndices) {
+        outObjects.push_back(m_RenderObjects[index]->shared_from_this());
+    }
+}
+
+void Scene::SyncSpatialGrid() {
+    UpdatePartition();
+
+    // Objects only appear, disappear or change static bounds through a regather;
+    // in between, the dynamic slots are all that can have moved
+    const bool regathered = m_SpatialGridPartitionStamp != m_PartitionStamp || m_SpatialGridSyncStamp == 0;
+    if (!regathered) {
+        for (uint32_t slot = m_StaticCount; slot < m_RenderObjects.size(); ++slot) {
+            SyncSpatialGridObject(m_RenderObjects[slot], false);
+        }
+        return;
+    }
+
+    // Stamp 0 means "never synced", skip it on wrap-around
+    if (++m_SpatialGridSyncStamp == 0) ++m_SpatialGridSyncStamp;
+    m_SpatialGridPartitionStamp = m_PartitionStamp;
+
+    // A regather also follows SetMesh and other bounds changes that leave the transform version alone
+    for (GameObject* object : m_RenderObjects) {
+        SyncSpatialGridObject(object, true);
+    }
+
+    // Objects not reached this time were removed or deactivated
+    for (auto it = m_SpatialGridRecords.begin(); it != m_SpatialGridRecords.end();) {
+        if (it->second.syncStamp != m_SpatialGridSyncStamp) {
+            m_SpatialGrid.Remove(it->first);
+            it = m_SpatialGridRecords.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void Scene::SyncSpatialGridObject(GameObject* object, const bool checkBounds) {
+    const auto transform = object->GetComponent<TransformComponent>();
+    const uint64_t version = transform ? transform->GetVersion() : 0;
+
+    const auto [it, inserted] = m_SpatialGridRecords.try_emplace(object->GetInstanceID());
+    SpatialGridRecord& record = it->second;
+    bool changed = inserted || record.version != version;
+    if (!changed && checkBounds) {
+        const Math::AABB& bounds = object->GetWorldAABB();
+        changed = bounds.GetMin() != record.bounds.GetMin() || bounds.GetMax() != record.bounds.GetMax();
+    }
+    if (changed) {
+        record.bounds = object->GetWorldAABB();
+        m_SpatialGrid.Set(object->GetInstanceID(), record.bounds);
+        record.version = version;
+    }
+    record.syncStamp = m_SpatialGridSyncStamp;
+}
+
+void Scene::ResolveSpatialQueryIds(std::vector<std::shared_ptr<GameObject>>& outObjects) const {
+    outObjects.clear();
+    outObjects.reserve(m_SpatialQueryIds.size());
+    for (const uint32_t id : m_SpatialQueryIds) {
+        if (GameObject* object = GameObject::FindByInstanceID(id)) {
+            if (auto shared = object->weak_from_this().lock()) outObjects.push_back(std::move(shared));
+        }
+    }
+}
+
+void Scene::QueryRadius(const glm::vec3& center, const float radius, std::vector<std::shared_ptr<GameObject>>& outObjects) {
+    if (m_SpatialGridSyncStamp == 0) SyncSpatialGrid();
+    m_SpatialGrid.QueryRadius(center, radius, m_SpatialQueryIds);
+    ResolveSpatialQueryIds(outObjects);
+}
+
+void Scene::QueryBounds(const Math::AABB& bounds, std::vector<std::shared_ptr<GameObject>>& outObjects) {
+    if (m_SpatialGridSyncStamp == 0) SyncSpatialGrid();
+    m_SpatialGrid.QueryAABB(bounds, m_SpatialQueryIds);
+    ResolveSpatialQueryIds(outObjects);
+}
+
+void Scene::QueryNearest(const glm::vec3& point, const size_t k, std::vector<std::shared_ptr<GameObject>>& outObjects) {
+    if (m_SpatialGridSyncStamp == 0) SyncSpatialGrid();
+    m_SpatialGrid.QueryNearest(point, k, m_SpatialNearestHits);
+
+    m_SpatialQueryIds.clear();
+    for (const Spatial::SpatialHit& hit : m_SpatialNearestHits) {
+        m_SpatialQueryIds.push_back(hit.id);
+    }
+    ResolveSpatialQueryIds(outObjects);
+}
+
 void Scene::RemoveGameObject(const std::shared_ptr<GameObject>& gameObject) {
     if (!gameObject) {
         std::cout << "Hata: Silinecek nesne null!" << std::endl;
@@ -374,8 +901,8 @@ void Scene::RemoveGameObject(const std::shared_ptr<GameObject>& gameObject) {
 
     // 1. Seçili nesne kontrolü
     SelectionManager& selectionManager = SelectionManager::GetInstance();
-    if (selectionManager.GetSelectedObject() == gameObject) {
-        selectionManager.ClearSelection();
+    if (gameObject->isSelected) {
+        selectionManager.Deselect(gameObject);
         std::cout << "Nesne seçimi temizlendi" << std::endl;
     }
 
@@ -396,6 +923,7 @@ void Scene::RemoveGameObject(const std::shared_ptr<GameObject>& gameObject) {
 
         // Artık nesneyi listeden güvenle kaldırabiliriz
         m_GameObjects.erase(it);
+        m_PartitionDirty = true;
         std::cout << "Nesne başarıyla silindi: " << objName << std::endl;
         return;
     }
@@ -412,71 +940,130 @@ void Scene::RemoveGameObject(const std::shared_ptr<GameObject>& gameObject) {
 }
 
 // Ray casting for object selection
-std::shared_ptr<GameObject> Scene::PickObjectWithRay(const Math::Ray& ray) const {
-    // If no objects in scene, return nullptr
-    if (m_GameObjects.empty()) {
-        std::cout << "[PickObjectWithRay] No objects in the scene." << std::endl;
+std::shared_ptr<GameObject> Scene::PickObjectWithRay(const Math::Ray& ray) {
+    RaycastHit hit;
+    if (!Raycast(ray, hit)) {
+        std::cout << "No object was hit by the ray" << std::endl;
         return nullptr;
     }
 
-    std::shared_ptr<GameObject> closestObject = nullptr;
-    float closestDistance = std::numeric_limits<float>::max();
+    std::cout << "Final selected object: " << hit.object->GetName() << " at distance " << hit.distance
+              << " (triangle " << hit.triangleIndex << ")" << std::endl;
+    return hit.object;
+}
 
-    // Log all the objects that will be tested
-    std::cout << "Testing ray intersection with " << m_GameObjects.size() << " objects:" << std::endl;
+bool Scene::Raycast(const Math::Ray& ray, RaycastHit& outHit, const float maxDistance, const uint32_t layerMask) {
+    std::vector<RaycastCandidate> candidates;
+    GatherRaycastCandidates(ray, maxDistance, layerMask, candidates);
+
+    // Nearest boxes first: once a box starts beyond the best hit, nothing after it can win
+    std::sort(candidates.begin(), candidates.end(), [](const RaycastCandidate& a, const RaycastCandidate& b) {
+        return a.boundsDistance < b.boundsDistance;
+    });
+
+    float best = maxDistance;
+    bool found = false;
+    for (const RaycastCandidate& candidate : candidates) {
+        if (candidate.boundsDistance > best) break;
+
+        RaycastHit hit;
+        if (RaycastObject(candidate.object, ray, best, hit) && hit.distance <= best) {
+            best = hit.distance;
+            outHit = std::move(hit);
+            found = true;
+        }
+    }
+    return found;
+}
 
-    // Iterate through all game objects
-    for (const auto& gameObject : m_GameObjects) {
-        // Skip inactive objects
-        if (!gameObject->IsActive()) {
-            std::cout << "  Skipping inactive object: " << gameObject->GetName() << std::endl;
-            continue;
+void Scene::RaycastAll(const Math::Ray& ray, std::vector<RaycastHit>& outHits, const float maxDistance,
+                       const uint32_t layerMask) {
+    outHits.clear();
+    std::vector<RaycastCandidate> candidates;
+    GatherRaycastCandidates(ray, maxDistance, layerMask, candidates);
+
+    for (const RaycastCandidate& candidate : candidates) {
+        RaycastHit hit;
+        if (RaycastObject(candidate.object, ray, maxDistance, hit)) {
+            outHits.push_back(std::move(hit));
         }
+    }
+    std::sort(outHits.begin(), outHits.end(), [](const RaycastHit& a, const RaycastHit& b) {
+        return a.distance < b.distance;
+    });
+}
 
-        std::cout << "  Testing object: " << gameObject->GetName() << std::endl;
+void Scene::GatherRaycastCandidates(const Math::Ray& ray, const float maxDistance, const uint32_t layerMask,
+                                    std::vector<RaycastCandidate>& outCandidates) {
+    UpdatePartition();
 
-        // Test ray intersection with this object's transformed AABB
-        float hitDistance = std::numeric_limits<float>::max();
-        bool hit = false;
+    m_RaycastSlots.clear();
+    m_StaticBvh.QueryRay(ray, maxDistance, m_RaycastSlots);
+    m_DynamicBvh.QueryRay(ray, maxDistance, m_RaycastSlots);
 
-        try {
-            hit = gameObject->IntersectsRay(ray, hitDistance);
-        }
-        catch (const std::exception& e) {
-            std::cerr << "    Exception during intersection test: " << e.what() << std::endl;
-            continue;
-        }
-        catch (...) {
-            std::cerr << "    Unknown exception during intersection test" << std::endl;
-            continue;
-        }
+    for (const uint32_t slot : m_RaycastSlots) {
+        GameObject* object = m_RenderObjects[slot];
 
-        if (hit) {
-            std::cout << "    HIT at distance: " << hitDistance << std::endl;
+        // Layer first: filtered objects never touch their bounds or mesh
+        if (!(object->GetLayerMask() & layerMask)) continue;
 
-            // Keep track of the closest hit
-            if (hitDistance < closestDistance) {
-                closestDistance = hitDistance;
-                closestObject = gameObject;
-                std::cout << "    New closest object: " << gameObject->GetName() <<
-                          " (distance: " << hitDistance << ")" << std::endl;
-            }
-        } else {
-            std::cout << "    No intersection" << std::endl;
+        const Math::AABB& bounds = object->GetWorldAABB();
+        float distance = 0.0f;
+        glm::vec3 normal;
+        if (Spatial::RaycastAABB(ray, bounds.GetMin(), bounds.GetMax(), maxDistance, distance, normal)) {
+            outCandidates.push_back({object, distance});
         }
     }
+}
 
-    if (closestObject) {
-        std::cout << "Final selected object: " << closestObject->GetName() <<
-                  " at distance " << closestDistance << std::endl;
+bool Scene::RaycastObject(GameObject* object, const Math::Ray& ray, const float maxDistance, RaycastHit& outHit) {
+    // Same mesh lookup as GameObject::UpdateBoundingBox
+    std::shared_ptr<Mesh> mesh;
+    if (const auto meshComponent = object->GetComponent<MeshComponent>()) {
+        mesh = meshComponent->GetMesh();
+    } else if (const auto meshRenderer = object->GetComponent<MeshRendererComponent>()) {
+        mesh = meshRenderer->GetMesh();
+    }
+    const auto transform = object->GetComponent<TransformComponent>();
+
+    if (mesh && transform && !mesh->GetVertices().empty() && !mesh->GetIndices().empty()) {
+        const auto& vertices = mesh->GetVertices();
+        const auto& indices = mesh->GetIndices();
+        Spatial::MeshRayHit meshHit;
+        if (!Spatial::RaycastTriangles(ray, transform->GetModelMatrix(), &vertices[0].position.x, vertices.size(),
+                                       sizeof(Vertex), indices.data(), indices.size(), maxDistance, meshHit)) {
+            return false;
+        }
+        outHit.distance = meshHit.distance;
+        outHit.point = meshHit.point;
+        outHit.normal = meshHit.normal;
+        outHit.triangleIndex = meshHit.triangleIndex;
     } else {
-        std::cout << "No object was hit by the ray" << std::endl;
+        const Math::AABB& bounds = object->GetWorldAABB();
+        if (!Spatial::RaycastAABB(ray, bounds.GetMin(), bounds.GetMax(), maxDistance, outHit.distance, outHit.normal)) {
+            return false;
+        }
+        outHit.point = ray.GetOrigin() + ray.GetDirection() * outHit.distance;
+        outHit.triangleIndex = -1;
     }
 
-    return closestObject;
+    outHit.object = object->shared_from_this();
+    return true;
+}
+
+void Scene::PickBatch(const std::span<const Math::Ray> rays, std::vector<PickHit>& outHits) {
+    UpdatePartition();
+    m_RayBatchCaster.CastClosest(m_RenderBounds, rays, m_RayBatchHits);
+
+    outHits.resize(rays.size());
+    for (size_t i = 0; i < rays.size(); ++i) {
+        const Spatial::RayBatchHit& hit = m_RayBatchHits[i];
+        outHits[i].object = hit.IsHit() ? m_RenderObjects[hit.index]->shared_from_this() : nullptr;
+        outHits[i].distance = hit.IsHit() ? hit.distance : 0.0f;
+    }
 }
 
-std::shared_ptr<GameObject> Scene::PickObjectWithRay(const glm::vec3& origin, const glm::vec3& direction) const {
+std::shared_ptr<GameObject> Scene::PickObjectWithRay(const glm::vec3& origin, const glm::vec3& direction) {
     // Create a Ray object from origin and direction
     Math::Ray ray(origin, glm::normalize(direction));
     return PickObjectWithRay(ray);
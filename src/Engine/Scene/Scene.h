@@ -6,15 +6,55 @@
 #include <string>
 #include <glm/glm.hpp>
 #include <unordered_map>
+#include <span>
+#include <limits>
+#include <cstdint>
 #include "Engine/Entity/GameObject.h"
+#include "Engine/Component/CellComponent.h"
+#include "Engine/Component/PortalComponent.h"
 #include "Core/Math/Ray.h"
 #include "Engine/render/Texture/Texture.h"
 #include "Core/Camera/Camera.h"
 #include "Physics/btBulletDynamicsCommon.h"
 #include "Core/InputManager/IInputEventReceiver.h"
+#include "Engine/Render/Culling/FrustumCuller.h"
+#include "Engine/Render/Culling/ShadowCasterCuller.h"
+#include "Engine/Render/Culling/OcclusionCuller.h"
+#include "Engine/Render/Culling/PortalCuller.h"
+#include "Engine/Render/View/RenderView.h"
+#include "Engine/Render/Mesh/InstanceBuffer.h"
+#include "Engine/Render/Mesh/IndirectBuffer.h"
+#include "Engine/Render/Shader/FrameUniformBuffer.h"
+#include "Engine/Render/Material/MaterialBlockBuffer.h"
+#include "Engine/Spatial/BoundsSoA.h"
+#include "Engine/Spatial/Bvh.h"
+#include "Engine/Spatial/RayBatchCaster.h"
+#include "Engine/Spatial/SpatialHashGrid.h"
 #include <glm/gtc/quaternion.hpp>
 #include "Core/InputManager/IInputEventReceiver.h"
 
+// Layer mask with every layer set; GameObject::layer selects one bit
+constexpr uint32_t kAllLayers = 0xFFFFFFFFu;
+
+// One object hit by Scene::Raycast / RaycastAll
+struct RaycastHit {
+    std::shared_ptr<GameObject> object;
+    float distance = 0.0f;
+    glm::vec3 point{0.0f};      // World space
+    glm::vec3 normal{0.0f};     // World space, facing the ray origin
+    int32_t triangleIndex = -1; // -1 when the object has no mesh and its bounds were hit
+};
+
+// Result of one ray in Scene::PickBatch
+struct PickHit {
+    std::shared_ptr<GameObject> object; // nullptr on a miss
+    float distance = 0.0f;
+};
+
+class MeshRendererComponent;
+class MeshComponent;
+class TransformComponent;
+
 class Scene : public IInputEventReceiver
 {
 public:
@@ -34,6 +74,7 @@ public:
 
     std::shared_ptr<GameObject> CreateGameObject(const std::string& name);
 
+    // True for root objects and for children of objects in this scene
     bool HasGameObject(const std::shared_ptr<GameObject>& obj) const;
 
     // Create primitive game objects
@@ -45,35 +86,140 @@ public:
 
     // Tüm objeleri draw et
     void DrawAll();
+
+    /**
+     * @brief Camera items for this frame: mesh, material, world matrix and sort key per visible object
+     *
+     * Culling and extraction run once per frame and camera; DrawAll, the game
+     * panel and the selection outline all reuse the result. Occluded items are
+     * kept with hidden set. Transforms edited after the view was built show up
+     * the next frame.
+     */
+    const RenderView& GetCameraView();
+
+    // Draw calls of the last DrawAll; runs of objects sharing mesh and material count as one
+    [[nodiscard]] const DrawCallStats& GetDrawCallStats() const { return m_DrawCallStats; }
+
     void SetViewMatrix(const glm::mat4& viewMatrix) {
         m_ViewMatrix = viewMatrix;
     }
 
     void SetProjectionMatrix(const glm::mat4& projMatrix) {
         m_ProjectionMatrix = projMatrix;
+        m_HasProjectionMatrix = true;
     }
 
+    // Frustum culling for DrawAll
+    void SetFrustumCullingEnabled(bool enabled) { m_FrustumCullingEnabled = enabled; }
+    [[nodiscard]] bool IsFrustumCullingEnabled() const { return m_FrustumCullingEnabled; }
+    [[nodiscard]] const CullingStats& GetCullingStats() const { return m_FrustumCuller.GetStats(); }
+
+    // Software occlusion culling for DrawAll, driven by objects flagged isOccluder
+    void SetOcclusionCullingEnabled(bool enabled) { m_OcclusionCullingEnabled = enabled; }
+    [[nodiscard]] bool IsOcclusionCullingEnabled() const { return m_OcclusionCullingEnabled; }
+    [[nodiscard]] const OcclusionStats& GetOcclusionStats() const { return m_OcclusionCuller.GetStats(); }
+
+    /**
+     * @brief Cell/portal culling for DrawAll and DrawAll2ShadowMap
+     *
+     * Uses every active CellComponent and PortalComponent. Objects whose bounds
+     * center lies in a cell the camera cannot see through the portals are dropped
+     * from both lists; with no cells in the scene nothing changes.
+     */
+    void SetPortalCullingEnabled(bool enabled) { m_PortalCullingEnabled = enabled; }
+    [[nodiscard]] bool IsPortalCullingEnabled() const { return m_PortalCullingEnabled; }
+    [[nodiscard]] const PortalStats& GetPortalStats() const { return m_PortalCuller.GetStats(); }
+
     //shadowMap için çizim fonksiyonu
     void DrawAll2ShadowMap();
 
+    // Shadow casters for this frame, built like GetCameraView
+    const RenderView& GetShadowView();
+
+    /**
+     * @brief Directional light used to pick shadow casters in DrawAll2ShadowMap
+     *
+     * Also the light the shaders shade with (FrameData block).
+     * @param lightSpaceMatrix Projection * view of the shadow map
+     * @param lightDirection Direction the light travels in
+     * @param shadowLength How far shadows can reach (usually the shadow projection depth)
+     */
+    void SetShadowLight(const glm::mat4& lightSpaceMatrix, const glm::vec3& lightDirection, float shadowLength);
+    // Color of the directional light and the ambient term
+    void SetLightColor(const glm::vec3& color, float ambientStrength);
+    [[nodiscard]] const ShadowCasterStats& GetShadowCasterStats() const { return m_ShadowCasterCuller.GetStats(); }
+
     const std::string& GetName() const { return m_SceneName; }
     void SetName(const std::string& name) { m_SceneName = name; }
 
     void RemoveGameObject(const std::shared_ptr<GameObject>& gameObject);
 
 
-    // Ray casting for object selection
-    std::shared_ptr<GameObject> PickObjectWithRay(const Math::Ray& ray) const;
-    std::shared_ptr<GameObject> PickObjectWithRay(const glm::vec3& origin, const glm::vec3& direction) const;
+    /**
+     * @brief Closest active object hit by the ray, children included
+     *
+     * The static and dynamic trees narrow the scene down to the leaves the ray
+     * passes through. The layer mask is checked before any object geometry, then
+     * the world bounds; only boxes nearer than the best hit so far get the
+     * per-triangle mesh test. Objects without a mesh are hit on their bounds.
+     * Nothing is logged.
+     *
+     * @param maxDistance Hits farther along the ray are ignored
+     * @param layerMask Bit per GameObject::layer to test
+     */
+    bool Raycast(const Math::Ray& ray, RaycastHit& outHit,
+                 float maxDistance = std::numeric_limits<float>::max(), uint32_t layerMask = kAllLayers);
+
+    // Every object hit by the ray (its closest hit), nearest first
+    void RaycastAll(const Math::Ray& ray, std::vector<RaycastHit>& outHits,
+                    float maxDistance = std::numeric_limits<float>::max(), uint32_t layerMask = kAllLayers);
+
+    // Ray casting for object selection (editor picking; same path as Raycast)
+    std::shared_ptr<GameObject> PickObjectWithRay(const Math::Ray& ray);
+    std::shared_ptr<GameObject> PickObjectWithRay(const glm::vec3& origin, const glm::vec3& direction);
     void SetCamera(Camera* camera) { m_Camera = camera; }
 
+    /**
+     * @brief Closest object for many rays at once (hover, snapping, tests)
+     *
+     * Tests every active object's own world bounds, children included, in
+     * coherent ray packets on worker threads. Nothing is logged.
+     *
+     * @param rays Rays with normalized directions
+     * @param outHits Resized to rays.size(); outHits[i] belongs to rays[i]
+     */
+    void PickBatch(std::span<const Math::Ray> rays, std::vector<PickHit>& outHits);
+
+    /**
+     * @brief Collect every active object whose world bounds touch the frustum
+     *
+     * Used for marquee selection: the frustum is the sub-frustum behind the
+     * dragged screen rectangle. Children are tested on their own bounds.
+     */
+    void QueryFrustum(const Math::Frustum& frustum, std::vector<std::shared_ptr<GameObject>>& outObjects);
+
+    /**
+     * @brief Active objects whose world bounds come within radius of center
+     *
+     * Radius, bounds and nearest queries run on a spatial hash grid that UpdateAll
+     * brings up to date from transform versions, so they see positions as of the
+     * last update. Call SyncSpatialGrid to pick up changes made since then.
+     */
+    void QueryRadius(const glm::vec3& center, float radius, std::vector<std::shared_ptr<GameObject>>& outObjects);
+
+    // Active objects whose world bounds overlap the box
+    void QueryBounds(const Math::AABB& bounds, std::vector<std::shared_ptr<GameObject>>& outObjects);
+
+    // The k active objects whose world bounds are closest to point, nearest first
+    void QueryNearest(const glm::vec3& point, size_t k, std::vector<std::shared_ptr<GameObject>>& outObjects);
+
+    // Re-insert objects whose transform version (or, after a regather, bounds) changed and drop objects that left the scene
+    void SyncSpatialGrid();
+
     //**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//
     // ScenePanel'ın shadowMapProgram'a erişebilmesi için getter
     std::shared_ptr<Shader> GetShadowMapShader() const { return m_ShadowMapProgram; }
     void SetShadowMapShader(const std::shared_ptr<Shader>& shader) { m_ShadowMapProgram = shader; }
-    // ScenePanel'ın default shader'a erişebilmesi için getter
-    std::shared_ptr<Shader> GetDefaultShader() const { return m_DefaultShader; }
-    void SetDefaultShader(const std::shared_ptr<Shader>& shader) { m_DefaultShader = shader; }
     //**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//
 
     void ProcessInput(const InputEvent& event) override;
@@ -98,10 +244,129 @@ private:
     //**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//
     // Gölge haritası shader'ı için yeni üye değişken
     std::shared_ptr<Shader> m_ShadowMapProgram;
-    //default shader'ı için yeni üye değişken
-    std::shared_ptr<Shader> m_DefaultShader;
+    // Materials the scene creates get default.vert/frag permutations and the instanced vertex shader
+    void UseDefaultShaders(Material& material) const;
+    // Flat stand-ins for shaders still compiling (fallback.frag), built on first use
+    std::shared_ptr<Shader> m_FallbackShader;
+    std::shared_ptr<Shader> m_InstancedFallbackShader;
+    Shader* GetFallbackShader(bool instanced);
     //**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//
 
+    // Flattened active hierarchy and its world bounds. Static objects fill slots
+    // [0, m_StaticCount) and dynamic ones the rest, each range in its tree's slot order.
+    // Only a GameObject structure change regathers it; otherwise just the dynamic
+    // bounds are refreshed and their tree refitted.
+    std::vector<GameObject*> m_RenderObjects;
+    Spatial::BoundsSoA m_RenderBounds;
+    uint32_t m_StaticCount = 0;
+    Spatial::Bvh m_StaticBvh;
+    Spatial::Bvh m_DynamicBvh;
+    uint64_t m_StructureVersion = 0; // GameObject::GetStructureVersion() at the last regather
+    uint32_t m_PartitionStamp = 0;   // Bumped on every regather
+    bool m_PartitionDirty = true;    // Root objects were added or removed
+    uint64_t m_RefitFrame = UINT64_MAX; // Frame whose dynamic bounds the partition holds
+    std::vector<uint32_t> m_BvhOrder;
+    std::vector<GameObject*> m_BvhReorder;
+
+    // Refitting loosens the dynamic tree; rebuild once its SAH cost grows past this factor
+    static constexpr float kDynamicBvhRebuildRatio = 2.0f;
+
+    // Drawing components per slot, looked up when the slot is filled
+    struct RenderSource {
+        MeshRendererComponent* renderer = nullptr;
+        MeshComponent* meshComponent = nullptr;
+        TransformComponent* transform = nullptr;
+    };
+    std::vector<RenderSource> m_RenderSources;
+
+    // Per-frame views; rebuilt on a new frame (UpdateAll), new matrices or a regather
+    uint64_t m_FrameIndex = 0;
+    RenderView m_CameraView;
+    uint32_t m_CameraViewStamp = 0;
+    RenderView m_ShadowView;
+    uint32_t m_ShadowViewStamp = 0;
+    glm::mat4 m_ShadowViewCamera{1.0f}; // Camera the shadow casters were picked for
+    std::vector<uint32_t> m_FrustumIndices;
+    InstanceBuffer m_InstanceBuffer;
+    // One command per instanced batch of the camera view, when multi-draw indirect is available
+    IndirectBuffer m_IndirectBuffer;
+    std::vector<DrawElementsIndirectCommand> m_IndirectCommands;
+    DrawCallStats m_DrawCallStats;
+    FrameUniformBuffer m_FrameUniforms;
+    MaterialBlockBuffer m_MaterialBlocks;
+    // Camera of the view plus the scene light, for the FrameData block
+    void UploadFrameUniforms(const RenderView& view);
+    [[nodiscard]] bool IsViewStale(uint32_t viewStamp) const;
+    void AddRenderItem(RenderView& view, uint32_t slot, bool shadowPass, bool hidden);
+
+    std::vector<uint32_t> m_VisibleIndices;
+    FrustumCuller m_FrustumCuller;
+    bool m_FrustumCullingEnabled = true;
+    bool m_HasProjectionMatrix = false;
+
+    FrustumCuller m_QueryCuller; // Separate from m_FrustumCuller so queries don't overwrite draw stats
+    std::vector<uint32_t> m_QueryIndices;
+
+    // Proximity queries; records hold the transform version and bounds each object was last inserted with
+    struct SpatialGridRecord {
+        uint64_t version = 0;
+        Math::AABB bounds;
+        uint32_t syncStamp = 0;
+    };
+    Spatial::SpatialHashGrid m_SpatialGrid;
+    std::unordered_map<uint32_t, SpatialGridRecord> m_SpatialGridRecords; // Keyed by instance id
+    uint32_t m_SpatialGridSyncStamp = 0;
+    uint32_t m_SpatialGridPartitionStamp = 0; // Partition the grid last saw; static objects are rechecked only after a regather
+    std::vector<uint32_t> m_SpatialQueryIds;
+    std::vector<Spatial::SpatialHit> m_SpatialNearestHits;
+    // checkBounds: also compare the world bounds, which mesh changes move without touching the transform
+    void SyncSpatialGridObject(GameObject* object, bool checkBounds);
+    void ResolveSpatialQueryIds(std::vector<std::shared_ptr<GameObject>>& outObjects) const;
+
+    Spatial::RayBatchCaster m_RayBatchCaster;
+    std::vector<Spatial::RayBatchHit> m_RayBatchHits;
+
+    OcclusionCuller m_OcclusionCuller;
+    bool m_OcclusionCullingEnabled = true;
+    std::vector<uint32_t> m_OccludeeIndices; // Visible non-occluders, the only entries tested
+
+    // Rasterizes the visible occluders and drops hidden entries from m_VisibleIndices
+    void CullOccluded(const glm::mat4& viewProjection);
+
+    // Cells and portals found by the last regather; rebuilt into m_PortalCuller every frame so they can move
+    PortalCuller m_PortalCuller;
+    bool m_PortalCullingEnabled = true;
+    std::vector<std::shared_ptr<CellComponent>> m_CellComponents;
+    std::vector<std::shared_ptr<PortalComponent>> m_PortalComponents;
+    void UpdatePortalVisibility(const Math::Frustum& cameraFrustum);
+
+    // Shadow caster selection
+    ShadowCasterCuller m_ShadowCasterCuller;
+    std::vector<uint32_t> m_ShadowCasterIndices;
+    glm::mat4 m_LightSpaceMatrix = glm::mat4(1.0f);
+    glm::vec3 m_LightDirection = glm::vec3(0.0f, -1.0f, 0.0f);
+    float m_ShadowLength = 0.0f;
+    bool m_HasShadowLight = false;
+    glm::vec3 m_LightColor = glm::vec3(1.0f);
+    float m_AmbientStrength = 0.2f;
+
+    // Bring m_RenderObjects/m_RenderBounds and both trees up to date; dynamic bounds once per frame
+    void UpdatePartition();
+    void RebuildPartition();
+    // Build a tree over slots [begin, end) and move objects and bounds into its slot order
+    void BuildPartitionTree(Spatial::Bvh& tree, uint32_t begin, uint32_t end);
+
+    // Raycast broad phase: objects whose layer and world bounds pass, with the bounds entry distance
+    struct RaycastCandidate {
+        GameObject* object;
+        float boundsDistance;
+    };
+    std::vector<uint32_t> m_RaycastSlots;
+    void GatherRaycastCandidates(const Math::Ray& ray, float maxDistance, uint32_t layerMask,
+                                 std::vector<RaycastCandidate>& outCandidates);
+    static bool RaycastObject(GameObject* object, const Math::Ray& ray, float maxDistance, RaycastHit& outHit);
+    void GatherRenderObjectsRecursive(GameObject* object);
+
     bool RemoveChildRecursive(const std::shared_ptr<GameObject>& parent, const std::shared_ptr<GameObject>& childToRemove);
     
     // Singleton instance
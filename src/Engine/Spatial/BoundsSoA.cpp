@@ -0,0 +1,140 @@
+#include "BoundsSoA.h"
+#include "Core/Math/Simd.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Spatial {
+
+void BoundsSoA::Clear() {
+    m_CenterX.clear();
+    m_CenterY.clear();
+    m_CenterZ.clear();
+    m_ExtentX.clear();
+    m_ExtentY.clear();
+    m_ExtentZ.clear();
+}
+
+void BoundsSoA::Reserve(const size_t count) {
+    m_CenterX.reserve(count);
+    m_CenterY.reserve(count);
+    m_CenterZ.reserve(count);
+    m_ExtentX.reserve(count);
+    m_ExtentY.reserve(count);
+    m_ExtentZ.reserve(count);
+}
+
+uint32_t BoundsSoA::Add(const Math::AABB& aabb) {
+    const auto index = static_cast<uint32_t>(m_CenterX.size());
+    const glm::vec3 center = aabb.GetCenter();
+    const glm::vec3 extents = aabb.GetExtents();
+
+    m_CenterX.push_back(center.x);
+    m_CenterY.push_back(center.y);
+    m_CenterZ.push_back(center.z);
+    m_ExtentX.push_back(extents.x);
+    m_ExtentY.push_back(extents.y);
+    m_ExtentZ.push_back(extents.z);
+    return index;
+}
+
+void BoundsSoA::Set(const uint32_t index, const Math::AABB& aabb) {
+    const glm::vec3 center = aabb.GetCenter();
+    const glm::vec3 extents = aabb.GetExtents();
+
+    m_CenterX[index] = center.x;
+    m_CenterY[index] = center.y;
+    m_CenterZ[index] = center.z;
+    m_ExtentX[index] = extents.x;
+    m_ExtentY[index] = extents.y;
+    m_ExtentZ[index] = extents.z;
+}
+
+void BoundsSoA::CullFrustum(const Math::Frustum& frustum, const uint32_t begin, const uint32_t end,
+                            std::vector<uint32_t>& outVisible) const {
+    constexpr float noSlack[Math::Frustum::kMaxPlanes] = {};
+    CullPlanes(frustum, noSlack, begin, end, outVisible);
+}
+
+void BoundsSoA::CullSweptFrustum(const Math::Frustum& frustum, const glm::vec3& sweepDirection,
+                                 const float sweepLength, const uint32_t begin, const uint32_t end,
+                                 std::vector<uint32_t>& outVisible) const {
+    // Moving the box along the sweep only ever increases its distance from a
+    // plane the direction points into; for the other planes the start wins
+    float slack[Math::Frustum::kMaxPlanes] = {};
+    for (uint32_t p = 0; p < frustum.GetPlaneCount(); ++p) {
+        slack[p] = std::max(0.0f, glm::dot(frustum.GetPlane(p).normal, sweepDirection) * sweepLength);
+    }
+    CullPlanes(frustum, slack, begin, end, outVisible);
+}
+
+void BoundsSoA::CullPlanes(const Math::Frustum& frustum, const float* planeSlack, const uint32_t begin,
+                           uint32_t end, std::vector<uint32_t>& outVisible) const {
+    end = std::min(end, static_cast<uint32_t>(Size()));
+    const uint32_t planeCount = frustum.GetPlaneCount();
+    uint32_t i = begin;
+
+#if BLACK_SIMD_SSE
+    // Broadcast each plane once; |n| is used for the box's projected radius
+    __m128 nx[Math::Frustum::kMaxPlanes], ny[Math::Frustum::kMaxPlanes], nz[Math::Frustum::kMaxPlanes];
+    __m128 nd[Math::Frustum::kMaxPlanes];
+    __m128 ax[Math::Frustum::kMaxPlanes], ay[Math::Frustum::kMaxPlanes], az[Math::Frustum::kMaxPlanes];
+    for (uint32_t p = 0; p < planeCount; ++p) {
+        const Math::Plane& plane = frustum.GetPlane(p);
+        nx[p] = _mm_set1_ps(plane.normal.x);
+        ny[p] = _mm_set1_ps(plane.normal.y);
+        nz[p] = _mm_set1_ps(plane.normal.z);
+        nd[p] = _mm_set1_ps(plane.distance + planeSlack[p]);
+        ax[p] = _mm_set1_ps(std::abs(plane.normal.x));
+        ay[p] = _mm_set1_ps(std::abs(plane.normal.y));
+        az[p] = _mm_set1_ps(std::abs(plane.normal.z));
+    }
+
+    const __m128 zero = _mm_setzero_ps();
+    for (; i + 4 <= end; i += 4) {
+        const __m128 cx = _mm_loadu_ps(&m_CenterX[i]);
+        const __m128 cy = _mm_loadu_ps(&m_CenterY[i]);
+        const __m128 cz = _mm_loadu_ps(&m_CenterZ[i]);
+        const __m128 ex = _mm_loadu_ps(&m_ExtentX[i]);
+        const __m128 ey = _mm_loadu_ps(&m_ExtentY[i]);
+        const __m128 ez = _mm_loadu_ps(&m_ExtentZ[i]);
+
+        __m128 outside = zero;
+        for (uint32_t p = 0; p < planeCount; ++p) {
+            const __m128 d = _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(nx[p], cx), _mm_mul_ps(ny[p], cy)),
+                _mm_add_ps(_mm_mul_ps(nz[p], cz), nd[p]));
+            const __m128 r = _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(ax[p], ex), _mm_mul_ps(ay[p], ey)),
+                _mm_mul_ps(az[p], ez));
+            outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(d, r), zero));
+        }
+
+        const int visibleMask = ~_mm_movemask_ps(outside) & 0xF;
+        if (visibleMask == 0) continue;
+        for (uint32_t lane = 0; lane < 4; ++lane) {
+            if (visibleMask & (1 << lane)) {
+                outVisible.push_back(i + lane);
+            }
+        }
+    }
+#endif
+
+    // Scalar tail (and the whole range without SSE)
+    for (; i < end; ++i) {
+        const glm::vec3 center(m_CenterX[i], m_CenterY[i], m_CenterZ[i]);
+        const glm::vec3 extents(m_ExtentX[i], m_ExtentY[i], m_ExtentZ[i]);
+
+        bool outside = false;
+        for (uint32_t p = 0; p < planeCount && !outside; ++p) {
+            const Math::Plane& plane = frustum.GetPlane(p);
+            const float d = plane.GetSignedDistance(center) + planeSlack[p];
+            const float r = glm::dot(glm::abs(plane.normal), extents);
+            outside = d + r < 0.0f;
+        }
+        if (!outside) {
+            outVisible.push_back(i);
+        }
+    }
+}
+
+} // namespace Spatial
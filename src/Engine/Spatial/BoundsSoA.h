@@ -0,0 +1,76 @@
+#ifndef BOUNDS_SOA_H
+#define BOUNDS_SOA_H
+
+#include <cstdint>
+#include <vector>
+#include <glm/glm.hpp>
+#include "Core/Math/BoundingVolume.h"
+#include "Core/Math/Frustum.h"
+
+namespace Spatial {
+
+/**
+ * @brief World-space AABBs stored as structure-of-arrays (center + extents per axis)
+ *
+ * Keeping each component in its own contiguous array lets the culling and query
+ * kernels test four boxes per SSE instruction. Indices are stable until Clear().
+ */
+class BoundsSoA {
+public:
+    void Clear();
+    void Reserve(size_t count);
+
+    /**
+     * @brief Append a box and return its index
+     */
+    uint32_t Add(const Math::AABB& aabb);
+
+    /**
+     * @brief Overwrite the box at an existing index
+     */
+    void Set(uint32_t index, const Math::AABB& aabb);
+
+    [[nodiscard]] size_t Size() const { return m_CenterX.size(); }
+    [[nodiscard]] bool Empty() const { return m_CenterX.empty(); }
+
+    [[nodiscard]] glm::vec3 GetCenter(uint32_t index) const {
+        return {m_CenterX[index], m_CenterY[index], m_CenterZ[index]};
+    }
+    [[nodiscard]] glm::vec3 GetExtents(uint32_t index) const {
+        return {m_ExtentX[index], m_ExtentY[index], m_ExtentZ[index]};
+    }
+    [[nodiscard]] Math::AABB GetAABB(uint32_t index) const {
+        const glm::vec3 center = GetCenter(index);
+        const glm::vec3 extents = GetExtents(index);
+        return {center - extents, center + extents};
+    }
+
+    /**
+     * @brief Append the indices in [begin, end) whose box is not fully outside any plane
+     *
+     * Output order is ascending, so chunked results can be concatenated as-is.
+     */
+    void CullFrustum(const Math::Frustum& frustum, uint32_t begin, uint32_t end,
+                     std::vector<uint32_t>& outVisible) const;
+
+    /**
+     * @brief Like CullFrustum, but each box is first swept along a direction
+     *
+     * Tests the volume covered by moving the box from 0 to sweepLength along
+     * sweepDirection (e.g. a shadow caster extruded along the light direction).
+     */
+    void CullSweptFrustum(const Math::Frustum& frustum, const glm::vec3& sweepDirection, float sweepLength,
+                          uint32_t begin, uint32_t end, std::vector<uint32_t>& outVisible) const;
+
+private:
+    // planeSlack[p] is added to every box's distance from plane p (all zero for plain culling)
+    void CullPlanes(const Math::Frustum& frustum, const float* planeSlack, uint32_t begin, uint32_t end,
+                    std::vector<uint32_t>& outVisible) const;
+
+    std::vector<float> m_CenterX, m_CenterY, m_CenterZ;
+    std::vector<float> m_ExtentX, m_ExtentY, m_ExtentZ;
+};
+
+} // namespace Spatial
+
+#endif // BOUNDS_SOA_H
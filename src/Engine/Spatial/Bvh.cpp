@@ -0,0 +1,311 @@
+#include "Bvh.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+namespace Spatial {
+
+namespace {
+    // Half the surface area; SAH only ever compares ratios
+    float GetHalfArea(const glm::vec3& min, const glm::vec3& max) {
+        const glm::vec3 size = glm::max(max - min, glm::vec3(0.0f));
+        return size.x * size.y + size.y * size.z + size.z * size.x;
+    }
+
+    struct Bin {
+        glm::vec3 min{std::numeric_limits<float>::max()};
+        glm::vec3 max{std::numeric_limits<float>::lowest()};
+        uint32_t count = 0;
+
+        void Grow(const glm::vec3& boxMin, const glm::vec3& boxMax) {
+            min = glm::min(min, boxMin);
+            max = glm::max(max, boxMax);
+        }
+    };
+
+    // Below this depth splits switch from SAH to halving, which bounds the traversal stacks
+    constexpr uint32_t kMaxSahDepth = 48;
+    constexpr uint32_t kStackSize = 128;
+}
+
+void Bvh::Clear() {
+    m_Nodes.clear();
+    m_Begin = m_End = 0;
+    m_Cost = m_BuildCost = 0.0f;
+}
+
+void Bvh::Build(const BoundsSoA& bounds, const uint32_t begin, const uint32_t end, std::vector<uint32_t>& outOrder) {
+    Clear();
+    m_Begin = begin;
+    m_End = std::max(begin, end);
+
+    const uint32_t count = m_End - m_Begin;
+    outOrder.resize(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        outOrder[i] = i;
+    }
+    if (count == 0) return;
+
+    // A binary tree with n leaves has 2n - 1 nodes; leaves hold at least one box
+    m_Nodes.reserve(2 * count);
+    Node& root = m_Nodes.emplace_back();
+    root.first = 0;
+    root.count = count;
+    Subdivide(bounds, 0, outOrder, 0);
+
+    // Leaves were built on positions in outOrder; make them absolute slots
+    for (Node& node : m_Nodes) {
+        if (node.IsLeaf()) node.first += m_Begin;
+    }
+
+    m_Cost = m_BuildCost = ComputeCost();
+}
+
+void Bvh::Subdivide(const BoundsSoA& bounds, const uint32_t nodeIndex, std::vector<uint32_t>& order,
+                    const uint32_t depth) {
+    const uint32_t start = m_Nodes[nodeIndex].first;
+    const uint32_t count = m_Nodes[nodeIndex].count;
+
+    // Node box and the box of the centroids, which is what gets binned
+    glm::vec3 nodeMin(std::numeric_limits<float>::max()), nodeMax(std::numeric_limits<float>::lowest());
+    glm::vec3 centroidMin = nodeMin, centroidMax = nodeMax;
+    for (uint32_t i = start; i < start + count; ++i) {
+        const uint32_t slot = m_Begin + order[i];
+        const glm::vec3 center = bounds.GetCenter(slot);
+        const glm::vec3 extents = bounds.GetExtents(slot);
+        nodeMin = glm::min(nodeMin, center - extents);
+        nodeMax = glm::max(nodeMax, center + extents);
+        centroidMin = glm::min(centroidMin, center);
+        centroidMax = glm::max(centroidMax, center);
+    }
+    m_Nodes[nodeIndex].min = nodeMin;
+    m_Nodes[nodeIndex].max = nodeMax;
+
+    if (count <= kMaxLeafSize) return;
+
+    // Binned SAH over all three axes
+    int bestAxis = -1;
+    uint32_t bestSplit = 0;
+    float bestCost = std::numeric_limits<float>::max();
+    const glm::vec3 centroidExtent = centroidMax - centroidMin;
+
+    for (int axis = 0; axis < 3 && depth < kMaxSahDepth; ++axis) {
+        if (centroidExtent[axis] <= std::numeric_limits<float>::epsilon()) continue;
+
+        std::array<Bin, kBinCount> bins{};
+        const float scale = static_cast<float>(kBinCount) / centroidExtent[axis];
+        for (uint32_t i = start; i < start + count; ++i) {
+            const uint32_t slot = m_Begin + order[i];
+            const glm::vec3 center = bounds.GetCenter(slot);
+            const glm::vec3 extents = bounds.GetExtents(slot);
+            const auto bin = std::min(kBinCount - 1, static_cast<uint32_t>((center[axis] - centroidMin[axis]) * scale));
+            bins[bin].Grow(center - extents, center + extents);
+            ++bins[bin].count;
+        }
+
+        // Sweep from both sides; split s puts bins [0, s] on the left
+        std::array<float, kBinCount - 1> leftCost{};
+        Bin left;
+        uint32_t leftCount = 0;
+        for (uint32_t s = 0; s < kBinCount - 1; ++s) {
+            if (bins[s].count > 0) left.Grow(bins[s].min, bins[s].max);
+            leftCount += bins[s].count;
+            leftCost[s] = leftCount > 0 ? GetHalfArea(left.min, left.max) * static_cast<float>(leftCount) : 0.0f;
+        }
+
+        Bin right;
+        uint32_t rightCount = 0;
+        for (uint32_t s = kBinCount - 1; s > 0; --s) {
+            if (bins[s].count > 0) right.Grow(bins[s].min, bins[s].max);
+            rightCount += bins[s].count;
+
+            const uint32_t split = s - 1;
+            if (rightCount == 0 || rightCount == count) continue;
+            const float cost = leftCost[split] + GetHalfArea(right.min, right.max) * static_cast<float>(rightCount);
+            if (cost < bestCost) {
+                bestCost = cost;
+                bestAxis = axis;
+                bestSplit = split;
+            }
+        }
+    }
+
+    uint32_t leftCount = 0;
+    if (bestAxis >= 0) {
+        // Traversal costs one box test, each box in a leaf one more
+        const float nodeArea = GetHalfArea(nodeMin, nodeMax);
+        const float splitCost = nodeArea > 0.0f ? 1.0f + bestCost / nodeArea : 1.0f;
+        if (splitCost >= static_cast<float>(count) && count <= kMaxForcedLeaf) return;
+
+        const float scale = static_cast<float>(kBinCount) / centroidExtent[bestAxis];
+        const auto middle = std::partition(order.begin() + start, order.begin() + start + count, [&](const uint32_t local) {
+            const float center = bounds.GetCenter(m_Begin + local)[bestAxis];
+            const auto bin = std::min(kBinCount - 1, static_cast<uint32_t>((center - centroidMin[bestAxis]) * scale));
+            return bin <= bestSplit;
+        });
+        leftCount = static_cast<uint32_t>(middle - (order.begin() + start));
+    }
+
+    // Coincident centroids, a degenerate partition or a too deep tree: halve the range so depth stays bounded
+    if (leftCount == 0 || leftCount == count) {
+        if (count <= kMaxForcedLeaf) return;
+        leftCount = count / 2;
+    }
+
+    const auto leftIndex = static_cast<uint32_t>(m_Nodes.size());
+    Node& leftNode = m_Nodes.emplace_back();
+    leftNode.first = start;
+    leftNode.count = leftCount;
+    Node& rightNode = m_Nodes.emplace_back();
+    rightNode.first = start + leftCount;
+    rightNode.count = count - leftCount;
+
+    m_Nodes[nodeIndex].first = leftIndex;
+    m_Nodes[nodeIndex].count = 0;
+
+    Subdivide(bounds, leftIndex, order, depth + 1);
+    Subdivide(bounds, leftIndex + 1, order, depth + 1);
+}
+
+void Bvh::UpdateNodeBounds(const BoundsSoA& bounds, Node& node) const {
+    node.min = glm::vec3(std::numeric_limits<float>::max());
+    node.max = glm::vec3(std::numeric_limits<float>::lowest());
+    for (uint32_t slot = node.first; slot < node.first + node.count; ++slot) {
+        const glm::vec3 center = bounds.GetCenter(slot);
+        const glm::vec3 extents = bounds.GetExtents(slot);
+        node.min = glm::min(node.min, center - extents);
+        node.max = glm::max(node.max, center + extents);
+    }
+}
+
+void Bvh::Refit(const BoundsSoA& bounds) {
+    // Children are always stored after their parent, so a reverse sweep is bottom-up
+    for (size_t i = m_Nodes.size(); i-- > 0;) {
+        Node& node = m_Nodes[i];
+        if (node.IsLeaf()) {
+            UpdateNodeBounds(bounds, node);
+        } else {
+            const Node& left = m_Nodes[node.first];
+            const Node& right = m_Nodes[node.first + 1];
+            node.min = glm::min(left.min, right.min);
+            node.max = glm::max(left.max, right.max);
+        }
+    }
+    m_Cost = ComputeCost();
+}
+
+float Bvh::ComputeCost() const {
+    if (m_Nodes.empty()) return 0.0f;
+
+    const float rootArea = GetHalfArea(m_Nodes[0].min, m_Nodes[0].max);
+    if (rootArea <= 0.0f) return 0.0f;
+
+    float cost = 0.0f;
+    for (const Node& node : m_Nodes) {
+        const float tests = node.IsLeaf() ? static_cast<float>(node.count) : 1.0f;
+        cost += GetHalfArea(node.min, node.max) * tests;
+    }
+    return cost / rootArea;
+}
+
+void Bvh::AppendSubtree(const uint32_t nodeIndex, std::vector<uint32_t>& outSlots) const {
+    // A subtree covers one contiguous slot range, from its leftmost to its rightmost leaf
+    const Node* first = &m_Nodes[nodeIndex];
+    while (!first->IsLeaf()) first = &m_Nodes[first->first];
+    const Node* last = &m_Nodes[nodeIndex];
+    while (!last->IsLeaf()) last = &m_Nodes[last->first + 1];
+
+    for (uint32_t slot = first->first; slot < last->first + last->count; ++slot) {
+        outSlots.push_back(slot);
+    }
+}
+
+void Bvh::CullFrustum(const BoundsSoA& bounds, const Math::Frustum& frustum, std::vector<uint32_t>& outVisible) const {
+    if (m_Nodes.empty()) return;
+
+    // Each entry carries the planes its parent was not already fully inside of
+    struct StackEntry {
+        uint32_t node;
+        uint32_t planeMask;
+    };
+    StackEntry stack[kStackSize];
+    uint32_t stackSize = 0;
+    stack[stackSize++] = {0, (1u << frustum.GetPlaneCount()) - 1u};
+
+    while (stackSize > 0) {
+        const StackEntry entry = stack[--stackSize];
+        const Node& node = m_Nodes[entry.node];
+
+        const glm::vec3 center = (node.min + node.max) * 0.5f;
+        const glm::vec3 extents = (node.max - node.min) * 0.5f;
+        uint32_t planeMask = entry.planeMask;
+        bool outside = false;
+        for (uint32_t p = 0; p < frustum.GetPlaneCount() && !outside; ++p) {
+            if (!(planeMask & (1u << p))) continue;
+            const Math::Plane& plane = frustum.GetPlane(p);
+            const float d = plane.GetSignedDistance(center);
+            const float r = glm::dot(glm::abs(plane.normal), extents);
+            outside = d + r < 0.0f;
+            if (d - r >= 0.0f) planeMask &= ~(1u << p);
+        }
+        if (outside) continue;
+
+        if (planeMask == 0) {
+            AppendSubtree(entry.node, outVisible);
+            continue;
+        }
+
+        if (node.IsLeaf()) {
+            // The SIMD batch test; planes the leaf is inside of cannot reject its boxes, so all may be tested
+            bounds.CullFrustum(frustum, node.first, node.first + node.count, outVisible);
+            continue;
+        }
+
+        // Right first so the left subtree (lower slots) is popped first
+        stack[stackSize++] = {node.first + 1, planeMask};
+        stack[stackSize++] = {node.first, planeMask};
+    }
+}
+
+void Bvh::QueryRay(const Math::Ray& ray, const float maxDistance, std::vector<uint32_t>& outSlots) const {
+    if (m_Nodes.empty()) return;
+
+    const glm::vec3& origin = ray.GetOrigin();
+    glm::vec3 inverseDirection;
+    for (int axis = 0; axis < 3; ++axis) {
+        const float d = ray.GetDirection()[axis];
+        // A huge finite value keeps 0 * inverse well defined for rays parallel to a slab
+        inverseDirection[axis] = std::abs(d) > std::numeric_limits<float>::epsilon()
+                                     ? 1.0f / d
+                                     : std::copysign(std::numeric_limits<float>::max(), d);
+    }
+
+    uint32_t stack[kStackSize];
+    uint32_t stackSize = 0;
+    stack[stackSize++] = 0;
+
+    while (stackSize > 0) {
+        const Node& node = m_Nodes[stack[--stackSize]];
+
+        const glm::vec3 t1 = (node.min - origin) * inverseDirection;
+        const glm::vec3 t2 = (node.max - origin) * inverseDirection;
+        const glm::vec3 tNear = glm::min(t1, t2);
+        const glm::vec3 tFar = glm::max(t1, t2);
+        const float enter = std::max(std::max(tNear.x, tNear.y), std::max(tNear.z, 0.0f));
+        const float exit = std::min(std::min(tFar.x, tFar.y), tFar.z);
+        if (enter > exit || enter > maxDistance) continue;
+
+        if (node.IsLeaf()) {
+            for (uint32_t slot = node.first; slot < node.first + node.count; ++slot) {
+                outSlots.push_back(slot);
+            }
+            continue;
+        }
+
+        stack[stackSize++] = node.first + 1;
+        stack[stackSize++] = node.first;
+    }
+}
+
+} // namespace Spatial
@@ -0,0 +1,101 @@
+#ifndef BVH_H
+#define BVH_H
+
+#include <cstdint>
+#include <vector>
+#include <glm/glm.hpp>
+#include "Core/Math/Frustum.h"
+#include "Core/Math/Ray.h"
+#include "Engine/Spatial/BoundsSoA.h"
+
+namespace Spatial {
+
+/**
+ * @brief Bounding volume hierarchy over a contiguous range of a BoundsSoA
+ *
+ * Built top-down with binned SAH. The tree never owns boxes: Build returns the
+ * slot order the caller has to apply to its own arrays, after which every node
+ * covers a contiguous slot range and an in-order walk visits slots in ascending
+ * order. Queries therefore emit ascending slot indices, like FrustumCuller.
+ *
+ * Static geometry builds once and is only read afterwards. Moving geometry
+ * keeps its topology and calls Refit after the boxes change; the tree reports
+ * its SAH cost so callers can rebuild once refitting has degraded it.
+ */
+class Bvh {
+public:
+    static constexpr uint32_t kMaxLeafSize = 4;   // Leaves never get split below this
+    static constexpr uint32_t kMaxForcedLeaf = 16; // Above this a leaf is split even if SAH disagrees
+    static constexpr uint32_t kBinCount = 12;
+
+    /**
+     * @brief 32-byte node; leaves have count > 0, inner nodes have their children at first and first + 1
+     */
+    struct Node {
+        glm::vec3 min{0.0f};
+        uint32_t first = 0;
+        glm::vec3 max{0.0f};
+        uint32_t count = 0;
+
+        [[nodiscard]] bool IsLeaf() const { return count > 0; }
+    };
+
+    void Clear();
+
+    /**
+     * @brief Build over bounds[begin, end)
+     *
+     * @param outOrder Filled with end - begin entries: the box now in slot begin + i
+     *                 must be moved from slot begin + outOrder[i]
+     */
+    void Build(const BoundsSoA& bounds, uint32_t begin, uint32_t end, std::vector<uint32_t>& outOrder);
+
+    /**
+     * @brief Recompute every node box from bounds (already in slot order); topology is kept
+     */
+    void Refit(const BoundsSoA& bounds);
+
+    /**
+     * @brief Append the slots whose box is not fully outside any plane (ascending)
+     *
+     * Whole subtrees inside all planes are appended without testing their boxes;
+     * the boxes of partially inside leaves go through BoundsSoA::CullFrustum.
+     */
+    void CullFrustum(const BoundsSoA& bounds, const Math::Frustum& frustum, std::vector<uint32_t>& outVisible) const;
+
+    /**
+     * @brief Append the slots of every leaf whose box the ray enters within maxDistance
+     *
+     * This is a broad phase: boxes inside those leaves still need their own test.
+     */
+    void QueryRay(const Math::Ray& ray, float maxDistance, std::vector<uint32_t>& outSlots) const;
+
+    [[nodiscard]] bool Empty() const { return m_Nodes.empty(); }
+    [[nodiscard]] uint32_t GetBegin() const { return m_Begin; }
+    [[nodiscard]] uint32_t GetEnd() const { return m_End; }
+    [[nodiscard]] const std::vector<Node>& GetNodes() const { return m_Nodes; }
+
+    /**
+     * @brief SAH cost relative to the root box (expected box tests per random query)
+     *
+     * GetBuildCost is the value right after Build; Refit only updates GetCost.
+     */
+    [[nodiscard]] float GetCost() const { return m_Cost; }
+    [[nodiscard]] float GetBuildCost() const { return m_BuildCost; }
+
+private:
+    void Subdivide(const BoundsSoA& bounds, uint32_t nodeIndex, std::vector<uint32_t>& order, uint32_t depth);
+    void UpdateNodeBounds(const BoundsSoA& bounds, Node& node) const;
+    void AppendSubtree(uint32_t nodeIndex, std::vector<uint32_t>& outSlots) const;
+    [[nodiscard]] float ComputeCost() const;
+
+    std::vector<Node> m_Nodes;
+    uint32_t m_Begin = 0;
+    uint32_t m_End = 0;
+    float m_Cost = 0.0f;
+    float m_BuildCost = 0.0f;
+};
+
+} // namespace Spatial
+
+#endif // BVH_H
@@ -0,0 +1,113 @@
+#include "MeshRaycast.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace Spatial {
+
+namespace {
+    constexpr float kParallelEpsilon = 1e-8f;
+    constexpr float kMinDistance = 1e-5f; // Same self-hit guard as MeshComponent::IntersectsRay
+
+    glm::vec3 LoadPosition(const float* positions, const size_t strideBytes, const uint32_t index) {
+        const float* p = reinterpret_cast<const float*>(reinterpret_cast<const char*>(positions) + index * strideBytes);
+        return {p[0], p[1], p[2]};
+    }
+}
+
+bool RaycastTriangles(const Math::Ray& worldRay, const glm::mat4& modelMatrix,
+                      const float* positions, const size_t vertexCount, const size_t strideBytes,
+                      const uint32_t* indices, const size_t indexCount, const float maxDistance, MeshRayHit& outHit) {
+    if (!positions || !indices || indexCount < 3) return false;
+
+    const glm::mat4 inverseModel = glm::inverse(modelMatrix);
+    const glm::vec3 origin = glm::vec3(inverseModel * glm::vec4(worldRay.GetOrigin(), 1.0f));
+    const glm::vec3 direction = glm::vec3(inverseModel * glm::vec4(worldRay.GetDirection(), 0.0f));
+
+    float closest = maxDistance;
+    int32_t closestTriangle = -1;
+    glm::vec3 closestNormal(0.0f);
+
+    for (size_t i = 0; i + 2 < indexCount; i += 3) {
+        const uint32_t i0 = indices[i], i1 = indices[i + 1], i2 = indices[i + 2];
+        if (i0 >= vertexCount || i1 >= vertexCount || i2 >= vertexCount) continue;
+
+        const glm::vec3 v0 = LoadPosition(positions, strideBytes, i0);
+        const glm::vec3 edge1 = LoadPosition(positions, strideBytes, i1) - v0;
+        const glm::vec3 edge2 = LoadPosition(positions, strideBytes, i2) - v0;
+
+        const glm::vec3 h = glm::cross(direction, edge2);
+        const float a = glm::dot(edge1, h);
+        if (std::abs(a) < kParallelEpsilon) continue;
+
+        const float f = 1.0f / a;
+        const glm::vec3 s = origin - v0;
+        const float u = f * glm::dot(s, h);
+        if (u < 0.0f || u > 1.0f) continue;
+
+        const glm::vec3 q = glm::cross(s, edge1);
+        const float v = f * glm::dot(direction, q);
+        if (v < 0.0f || u + v > 1.0f) continue;
+
+        const float t = f * glm::dot(edge2, q);
+        if (t > kMinDistance && t < closest) {
+            closest = t;
+            closestTriangle = static_cast<int32_t>(i / 3);
+            closestNormal = glm::cross(edge1, edge2);
+        }
+    }
+
+    if (closestTriangle < 0) return false;
+
+    // Normals go to world space with the inverse transpose (non-uniform scale)
+    glm::vec3 normal = glm::vec3(glm::transpose(inverseModel) * glm::vec4(closestNormal, 0.0f));
+    const float length = glm::length(normal);
+    normal = length > 0.0f ? normal / length : -worldRay.GetDirection();
+    if (glm::dot(normal, worldRay.GetDirection()) > 0.0f) normal = -normal;
+
+    outHit.distance = closest;
+    outHit.point = worldRay.GetOrigin() + worldRay.GetDirection() * closest;
+    outHit.normal = normal;
+    outHit.triangleIndex = closestTriangle;
+    return true;
+}
+
+bool RaycastAABB(const Math::Ray& ray, const glm::vec3& min, const glm::vec3& max, const float maxDistance,
+                 float& outDistance, glm::vec3& outNormal) {
+    const glm::vec3& origin = ray.GetOrigin();
+    const glm::vec3& direction = ray.GetDirection();
+
+    float tEnter = 0.0f;
+    float tExit = maxDistance;
+    int enterAxis = -1;
+
+    for (int axis = 0; axis < 3; ++axis) {
+        if (std::abs(direction[axis]) < std::numeric_limits<float>::epsilon()) {
+            if (origin[axis] < min[axis] || origin[axis] > max[axis]) return false;
+            continue;
+        }
+
+        const float inverse = 1.0f / direction[axis];
+        float t0 = (min[axis] - origin[axis]) * inverse;
+        float t1 = (max[axis] - origin[axis]) * inverse;
+        if (t0 > t1) std::swap(t0, t1);
+
+        if (t0 > tEnter) {
+            tEnter = t0;
+            enterAxis = axis;
+        }
+        tExit = std::min(tExit, t1);
+        if (tEnter > tExit) return false;
+    }
+
+    outDistance = tEnter;
+    if (enterAxis < 0) {
+        outNormal = -direction; // Started inside
+    } else {
+        outNormal = glm::vec3(0.0f);
+        outNormal[enterAxis] = direction[enterAxis] > 0.0f ? -1.0f : 1.0f;
+    }
+    return true;
+}
+
+} // namespace Spatial
@@ -0,0 +1,47 @@
+#ifndef MESH_RAYCAST_H
+#define MESH_RAYCAST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <glm/glm.hpp>
+#include "Core/Math/Ray.h"
+#include "Core/Math/BoundingVolume.h"
+
+namespace Spatial {
+
+/**
+ * @brief Closest triangle hit of a world-space ray against one mesh
+ */
+struct MeshRayHit {
+    float distance = 0.0f;      // Along the world ray
+    glm::vec3 point{0.0f};      // World space
+    glm::vec3 normal{0.0f};     // World space, unit length, facing the ray origin
+    int32_t triangleIndex = -1; // First index of the triangle is 3 * triangleIndex
+};
+
+/**
+ * @brief Intersect a world-space ray with an indexed triangle mesh (Möller–Trumbore)
+ *
+ * The ray is moved into the mesh's local space once instead of transforming
+ * every vertex, and the unnormalized local direction keeps distances in world
+ * units. Both triangle sides count as hits. Nothing is logged.
+ *
+ * @param positions First vertex position (x, y, z floats)
+ * @param strideBytes Distance between consecutive positions, e.g. sizeof(Vertex)
+ * @param maxDistance Hits farther than this are ignored
+ */
+bool RaycastTriangles(const Math::Ray& worldRay, const glm::mat4& modelMatrix,
+                      const float* positions, size_t vertexCount, size_t strideBytes,
+                      const uint32_t* indices, size_t indexCount, float maxDistance, MeshRayHit& outHit);
+
+/**
+ * @brief Entry distance and face normal of a ray against a world-space box
+ *
+ * A ray starting inside the box hits it at distance 0 with the normal pointing back along the ray.
+ */
+bool RaycastAABB(const Math::Ray& ray, const glm::vec3& min, const glm::vec3& max, float maxDistance,
+                 float& outDistance, glm::vec3& outNormal);
+
+} // namespace Spatial
+
+#endif // MESH_RAYCAST_H
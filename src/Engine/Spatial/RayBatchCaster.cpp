@@ -0,0 +1,167 @@
+#include "RayBatchCaster.h"
+#include "Core/JobSystem/JobSystem.h"
+#include "Core/Math/Simd.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Spatial {
+
+namespace {
+    // Stands in for 1/0 so axis-parallel rays stay finite (no inf * 0 = NaN in the slab test)
+    constexpr float kHugeInverse = 1e30f;
+
+    float SafeInverse(const float value) {
+        if (std::abs(value) < std::numeric_limits<float>::epsilon()) {
+            return std::signbit(value) ? -kHugeInverse : kHugeInverse;
+        }
+        return 1.0f / value;
+    }
+
+    uint32_t GetOctant(const glm::vec3& direction) {
+        return (std::signbit(direction.x) ? 1u : 0u) |
+               (std::signbit(direction.y) ? 2u : 0u) |
+               (std::signbit(direction.z) ? 4u : 0u);
+    }
+
+    // Octant first, then the direction quantized to 8 bits per axis, so neighbours in
+    // the sorted order point roughly the same way
+    uint32_t GetCoherenceKey(const glm::vec3& direction) {
+        const auto quantize = [](const float v) {
+            return static_cast<uint32_t>(std::clamp((v * 0.5f + 0.5f) * 255.0f, 0.0f, 255.0f));
+        };
+        return (GetOctant(direction) << 24) | (quantize(direction.x) << 16) |
+               (quantize(direction.y) << 8) | quantize(direction.z);
+    }
+}
+
+void RayBatchCaster::CastClosest(const BoundsSoA& bounds, const std::span<const Math::Ray> rays,
+                                 std::vector<RayBatchHit>& outHits) {
+    outHits.assign(rays.size(), RayBatchHit{});
+    if (rays.empty() || bounds.Empty()) return;
+
+    BuildPackets(rays);
+
+    JobSystem::Get().ParallelFor(m_Packets.size(), kPacketsPerJob, [&](const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            CastPacket(bounds, rays, m_Packets[i], outHits);
+        }
+    });
+}
+
+void RayBatchCaster::BuildPackets(const std::span<const Math::Ray> rays) {
+    m_SortKeys.resize(rays.size());
+    for (size_t i = 0; i < rays.size(); ++i) {
+        m_SortKeys[i] = (static_cast<uint64_t>(GetCoherenceKey(rays[i].GetDirection())) << 32) | i;
+    }
+    std::sort(m_SortKeys.begin(), m_SortKeys.end());
+
+    // Packets never mix octants, so every lane agrees on which box faces are near
+    m_Packets.clear();
+    m_Packets.reserve(rays.size() / kPacketSize + 8);
+    for (const uint64_t key : m_SortKeys) {
+        const auto rayIndex = static_cast<uint32_t>(key & 0xFFFFFFFFu);
+        const auto octant = static_cast<uint32_t>(key >> 56);
+
+        if (m_Packets.empty() || m_Packets.back().count == kPacketSize || m_Packets.back().octant != octant) {
+            m_Packets.push_back(Packet{{}, 0, octant});
+        }
+        Packet& packet = m_Packets.back();
+        packet.rays[packet.count++] = rayIndex;
+    }
+}
+
+void RayBatchCaster::CastPacket(const BoundsSoA& bounds, const std::span<const Math::Ray> rays,
+                                const Packet& packet, std::vector<RayBatchHit>& outHits) const {
+    // Packet lanes in SoA form; unused lanes start with best = 0 so they can never hit
+    alignas(16) float originX[kPacketSize], originY[kPacketSize], originZ[kPacketSize];
+    alignas(16) float inverseX[kPacketSize], inverseY[kPacketSize], inverseZ[kPacketSize];
+    alignas(16) float best[kPacketSize];
+    alignas(16) int32_t bestIndex[kPacketSize];
+
+    for (uint32_t lane = 0; lane < kPacketSize; ++lane) {
+        const bool active = lane < packet.count;
+        const Math::Ray& ray = rays[packet.rays[active ? lane : 0]];
+        originX[lane] = ray.GetOrigin().x;
+        originY[lane] = ray.GetOrigin().y;
+        originZ[lane] = ray.GetOrigin().z;
+        inverseX[lane] = SafeInverse(ray.GetDirection().x);
+        inverseY[lane] = SafeInverse(ray.GetDirection().y);
+        inverseZ[lane] = SafeInverse(ray.GetDirection().z);
+        best[lane] = active ? std::numeric_limits<float>::max() : 0.0f;
+        bestIndex[lane] = -1;
+    }
+
+    const bool negativeX = packet.octant & 1u;
+    const bool negativeY = packet.octant & 2u;
+    const bool negativeZ = packet.octant & 4u;
+    const auto boxCount = static_cast<uint32_t>(bounds.Size());
+
+#if BLACK_SIMD_SSE
+    const __m128 ox = _mm_load_ps(originX), oy = _mm_load_ps(originY), oz = _mm_load_ps(originZ);
+    const __m128 ix = _mm_load_ps(inverseX), iy = _mm_load_ps(inverseY), iz = _mm_load_ps(inverseZ);
+    const __m128 zero = _mm_setzero_ps();
+    __m128 bestT = _mm_load_ps(best);
+    __m128i bestI = _mm_load_si128(reinterpret_cast<const __m128i*>(bestIndex));
+
+    for (uint32_t i = 0; i < boxCount; ++i) {
+        const glm::vec3 center = bounds.GetCenter(i);
+        const glm::vec3 extents = bounds.GetExtents(i);
+        const glm::vec3 nearCorner(negativeX ? center.x + extents.x : center.x - extents.x,
+                                   negativeY ? center.y + extents.y : center.y - extents.y,
+                                   negativeZ ? center.z + extents.z : center.z - extents.z);
+        const glm::vec3 farCorner = 2.0f * center - nearCorner;
+
+        const __m128 tNearX = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(nearCorner.x), ox), ix);
+        const __m128 tNearY = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(nearCorner.y), oy), iy);
+        const __m128 tNearZ = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(nearCorner.z), oz), iz);
+        const __m128 tFarX = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(farCorner.x), ox), ix);
+        const __m128 tFarY = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(farCorner.y), oy), iy);
+        const __m128 tFarZ = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(farCorner.z), oz), iz);
+
+        const __m128 tEnter = _mm_max_ps(_mm_max_ps(tNearX, tNearY), _mm_max_ps(tNearZ, zero));
+        const __m128 tExit = _mm_min_ps(_mm_min_ps(tFarX, tFarY), tFarZ);
+        const __m128 hit = _mm_and_ps(_mm_cmple_ps(tEnter, tExit), _mm_cmplt_ps(tEnter, bestT));
+        if (_mm_movemask_ps(hit) == 0) continue;
+
+        const __m128i hitI = _mm_castps_si128(hit);
+        bestT = _mm_or_ps(_mm_and_ps(hit, tEnter), _mm_andnot_ps(hit, bestT));
+        bestI = _mm_or_si128(_mm_and_si128(hitI, _mm_set1_epi32(static_cast<int32_t>(i))),
+                             _mm_andnot_si128(hitI, bestI));
+    }
+
+    _mm_store_ps(best, bestT);
+    _mm_store_si128(reinterpret_cast<__m128i*>(bestIndex), bestI);
+#else
+    for (uint32_t i = 0; i < boxCount; ++i) {
+        const glm::vec3 center = bounds.GetCenter(i);
+        const glm::vec3 extents = bounds.GetExtents(i);
+        const glm::vec3 nearCorner(negativeX ? center.x + extents.x : center.x - extents.x,
+                                   negativeY ? center.y + extents.y : center.y - extents.y,
+                                   negativeZ ? center.z + extents.z : center.z - extents.z);
+        const glm::vec3 farCorner = 2.0f * center - nearCorner;
+
+        for (uint32_t lane = 0; lane < packet.count; ++lane) {
+            const float tEnter = std::max({(nearCorner.x - originX[lane]) * inverseX[lane],
+                                           (nearCorner.y - originY[lane]) * inverseY[lane],
+                                           (nearCorner.z - originZ[lane]) * inverseZ[lane], 0.0f});
+            const float tExit = std::min({(farCorner.x - originX[lane]) * inverseX[lane],
+                                          (farCorner.y - originY[lane]) * inverseY[lane],
+                                          (farCorner.z - originZ[lane]) * inverseZ[lane]});
+            if (tEnter <= tExit && tEnter < best[lane]) {
+                best[lane] = tEnter;
+                bestIndex[lane] = static_cast<int32_t>(i);
+            }
+        }
+    }
+#endif
+
+    // Each ray belongs to exactly one packet, so workers never write the same slot
+    for (uint32_t lane = 0; lane < packet.count; ++lane) {
+        if (bestIndex[lane] < 0) continue;
+        RayBatchHit& hit = outHits[packet.rays[lane]];
+        hit.index = static_cast<uint32_t>(bestIndex[lane]);
+        hit.distance = best[lane];
+    }
+}
+
+} // namespace Spatial
@@ -0,0 +1,67 @@
+#ifndef RAY_BATCH_CASTER_H
+#define RAY_BATCH_CASTER_H
+
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+#include <glm/glm.hpp>
+#include "Core/Math/Ray.h"
+#include "BoundsSoA.h"
+
+namespace Spatial {
+
+/**
+ * @brief Closest box hit for one ray
+ */
+struct RayBatchHit {
+    static constexpr uint32_t kNoHit = std::numeric_limits<uint32_t>::max();
+
+    uint32_t index = kNoHit; // Index into the BoundsSoA, kNoHit on a miss
+    float distance = std::numeric_limits<float>::max();
+
+    [[nodiscard]] bool IsHit() const { return index != kNoHit; }
+};
+
+/**
+ * @brief Casts many rays against SoA bounds and keeps the closest hit per ray
+ *
+ * Rays are sorted by direction octant and grouped into packets of four that
+ * share direction signs, so each slab test picks the near/far box faces once
+ * per packet and runs four rays per SSE instruction. Packets are spread over
+ * the JobSystem. Hits use the same rules as Math::AABB::IntersectsRay (a ray
+ * starting inside a box hits it at distance 0; ties keep the lower index).
+ */
+class RayBatchCaster {
+public:
+    static constexpr uint32_t kPacketSize = 4;
+    static constexpr size_t kPacketsPerJob = 16;
+
+    /**
+     * @brief Find the closest box for every ray
+     *
+     * @param bounds Boxes to test
+     * @param rays Rays with normalized directions
+     * @param outHits Resized to rays.size(); outHits[i] belongs to rays[i]
+     */
+    void CastClosest(const BoundsSoA& bounds, std::span<const Math::Ray> rays, std::vector<RayBatchHit>& outHits);
+
+private:
+    struct Packet {
+        uint32_t rays[kPacketSize];
+        uint32_t count;
+        uint32_t octant; // Bit per axis, set when the direction is negative
+    };
+
+    void BuildPackets(std::span<const Math::Ray> rays);
+    void CastPacket(const BoundsSoA& bounds, std::span<const Math::Ray> rays, const Packet& packet,
+                    std::vector<RayBatchHit>& outHits) const;
+
+    // Reused between calls
+    std::vector<uint64_t> m_SortKeys; // (coherence key << 32) | ray index
+    std::vector<Packet> m_Packets;
+};
+
+} // namespace Spatial
+
+#endif // RAY_BATCH_CASTER_H
@@ -0,0 +1,287 @@
+#include "SpatialHashGrid.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Spatial {
+
+namespace {
+    // 21 bits per axis in the cell key
+    constexpr int kCellLimit = (1 << 20) - 1;
+
+    float DistanceSquared(const glm::vec3& point, const glm::vec3& min, const glm::vec3& max) {
+        const glm::vec3 delta = glm::max(glm::max(min - point, point - max), glm::vec3(0.0f));
+        return glm::dot(delta, delta);
+    }
+
+    bool Overlaps(const glm::vec3& minA, const glm::vec3& maxA, const glm::vec3& minB, const glm::vec3& maxB) {
+        return minA.x <= maxB.x && maxA.x >= minB.x &&
+               minA.y <= maxB.y && maxA.y >= minB.y &&
+               minA.z <= maxB.z && maxA.z >= minB.z;
+    }
+
+    // Max-heap on (distance, id): the worst of the current k best sits on top
+    bool CloserThan(const SpatialHit& a, const SpatialHit& b) {
+        return a.distanceSquared < b.distanceSquared ||
+               (a.distanceSquared == b.distanceSquared && a.id < b.id);
+    }
+}
+
+SpatialHashGrid::SpatialHashGrid(const float cellSize) {
+    m_CellSize = cellSize > 0.0f ? cellSize : kDefaultCellSize;
+    m_InverseCellSize = 1.0f / m_CellSize;
+}
+
+void SpatialHashGrid::Clear() {
+    m_Entries.clear();
+    m_FreeSlots.clear();
+    m_SlotById.clear();
+    m_Cells.clear();
+    m_Oversized.clear();
+    m_OccupiedMin = glm::ivec3(std::numeric_limits<int>::max());
+    m_OccupiedMax = glm::ivec3(std::numeric_limits<int>::min());
+}
+
+void SpatialHashGrid::SetCellSize(const float cellSize) {
+    if (cellSize <= 0.0f || cellSize == m_CellSize) return;
+
+    std::vector<Entry> entries;
+    entries.reserve(m_SlotById.size());
+    for (const auto& [id, slot] : m_SlotById) {
+        entries.push_back(m_Entries[slot]);
+    }
+
+    Clear();
+    m_CellSize = cellSize;
+    m_InverseCellSize = 1.0f / cellSize;
+    for (const Entry& entry : entries) {
+        Set(entry.id, Math::AABB(entry.min, entry.max));
+    }
+}
+
+glm::ivec3 SpatialHashGrid::GetCell(const glm::vec3& position) const {
+    const glm::vec3 cell = glm::floor(position * m_InverseCellSize);
+    return glm::ivec3(glm::clamp(cell, glm::vec3(static_cast<float>(-kCellLimit)),
+                                 glm::vec3(static_cast<float>(kCellLimit))));
+}
+
+uint64_t SpatialHashGrid::GetCellKey(const glm::ivec3& cell) {
+    constexpr uint64_t mask = (1u << 21) - 1;
+    return (static_cast<uint64_t>(cell.x + kCellLimit) & mask) |
+           ((static_cast<uint64_t>(cell.y + kCellLimit) & mask) << 21) |
+           ((static_cast<uint64_t>(cell.z + kCellLimit) & mask) << 42);
+}
+
+void SpatialHashGrid::Set(const uint32_t id, const Math::AABB& bounds) {
+    const glm::vec3 min = glm::min(bounds.GetMin(), bounds.GetMax());
+    const glm::vec3 max = glm::max(bounds.GetMin(), bounds.GetMax());
+    const glm::ivec3 cellMin = GetCell(min);
+    const glm::ivec3 cellMax = GetCell(max);
+    const glm::ivec3 span = cellMax - cellMin + 1;
+    const bool oversized = static_cast<uint64_t>(span.x) * span.y * span.z > kMaxCellsPerEntry;
+
+    uint32_t slot;
+    if (const auto it = m_SlotById.find(id); it != m_SlotById.end()) {
+        slot = it->second;
+        Entry& entry = m_Entries[slot];
+
+        // Most frames a moving object stays inside the same cells
+        if (entry.oversized == oversized && entry.cellMin == cellMin && entry.cellMax == cellMax) {
+            entry.min = min;
+            entry.max = max;
+            return;
+        }
+        RemoveFromCells(slot);
+    } else {
+        if (!m_FreeSlots.empty()) {
+            slot = m_FreeSlots.back();
+            m_FreeSlots.pop_back();
+        } else {
+            slot = static_cast<uint32_t>(m_Entries.size());
+            m_Entries.emplace_back();
+        }
+        m_SlotById.emplace(id, slot);
+    }
+
+    m_Entries[slot] = Entry{id, min, max, cellMin, cellMax, oversized};
+    AddToCells(slot);
+}
+
+bool SpatialHashGrid::Remove(const uint32_t id) {
+    const auto it = m_SlotById.find(id);
+    if (it == m_SlotById.end()) return false;
+
+    RemoveFromCells(it->second);
+    m_FreeSlots.push_back(it->second);
+    m_SlotById.erase(it);
+    return true;
+}
+
+void SpatialHashGrid::AddToCells(const uint32_t slot) {
+    const Entry& entry = m_Entries[slot];
+    if (entry.oversized) {
+        m_Oversized.push_back(slot);
+        return;
+    }
+
+    for (int z = entry.cellMin.z; z <= entry.cellMax.z; ++z) {
+        for (int y = entry.cellMin.y; y <= entry.cellMax.y; ++y) {
+            for (int x = entry.cellMin.x; x <= entry.cellMax.x; ++x) {
+                m_Cells[GetCellKey({x, y, z})].push_back(slot);
+            }
+        }
+    }
+    m_OccupiedMin = glm::min(m_OccupiedMin, entry.cellMin);
+    m_OccupiedMax = glm::max(m_OccupiedMax, entry.cellMax);
+}
+
+void SpatialHashGrid::RemoveFromCells(const uint32_t slot) {
+    const auto eraseSlot = [slot](std::vector<uint32_t>& slots) {
+        const auto it = std::find(slots.begin(), slots.end(), slot);
+        if (it != slots.end()) {
+            *it = slots.back();
+            slots.pop_back();
+        }
+    };
+
+    const Entry& entry = m_Entries[slot];
+    if (entry.oversized) {
+        eraseSlot(m_Oversized);
+        return;
+    }
+
+    // Emptied cells keep their storage; a dense scene refills the same cells every frame
+    for (int z = entry.cellMin.z; z <= entry.cellMax.z; ++z) {
+        for (int y = entry.cellMin.y; y <= entry.cellMax.y; ++y) {
+            for (int x = entry.cellMin.x; x <= entry.cellMax.x; ++x) {
+                if (const auto it = m_Cells.find(GetCellKey({x, y, z})); it != m_Cells.end()) {
+                    eraseSlot(it->second);
+                }
+            }
+        }
+    }
+}
+
+template <typename Visitor>
+void SpatialHashGrid::ForEachInCellRange(const glm::ivec3& cellMin, const glm::ivec3& cellMax, Visitor&& visit) const {
+    for (const uint32_t slot : m_Oversized) {
+        visit(m_Entries[slot]);
+    }
+
+    // Nothing lives outside the occupied cells, so don't hash empty space
+    const glm::ivec3 first = glm::max(cellMin, m_OccupiedMin);
+    const glm::ivec3 last = glm::min(cellMax, m_OccupiedMax);
+
+    for (int z = first.z; z <= last.z; ++z) {
+        for (int y = first.y; y <= last.y; ++y) {
+            for (int x = first.x; x <= last.x; ++x) {
+                const glm::ivec3 cell(x, y, z);
+                const auto it = m_Cells.find(GetCellKey(cell));
+                if (it == m_Cells.end()) continue;
+
+                for (const uint32_t slot : it->second) {
+                    const Entry& entry = m_Entries[slot];
+                    // An entry spanning several cells is reported from its first cell in the range only
+                    if (glm::max(entry.cellMin, first) == cell) visit(entry);
+                }
+            }
+        }
+    }
+}
+
+void SpatialHashGrid::QueryAABB(const Math::AABB& bounds, std::vector<uint32_t>& outIds) const {
+    outIds.clear();
+    const glm::vec3 min = glm::min(bounds.GetMin(), bounds.GetMax());
+    const glm::vec3 max = glm::max(bounds.GetMin(), bounds.GetMax());
+
+    ForEachInCellRange(GetCell(min), GetCell(max), [&](const Entry& entry) {
+        if (Overlaps(entry.min, entry.max, min, max)) outIds.push_back(entry.id);
+    });
+}
+
+void SpatialHashGrid::QueryRadius(const glm::vec3& center, const float radius, std::vector<uint32_t>& outIds) const {
+    outIds.clear();
+    if (radius < 0.0f) return;
+
+    const float radiusSquared = radius * radius;
+    ForEachInCellRange(GetCell(center - radius), GetCell(center + radius), [&](const Entry& entry) {
+        if (DistanceSquared(center, entry.min, entry.max) <= radiusSquared) outIds.push_back(entry.id);
+    });
+}
+
+void SpatialHashGrid::QueryNearest(const glm::vec3& point, const size_t k, std::vector<SpatialHit>& outHits,
+                                   const float maxDistance) const {
+    outHits.clear();
+    if (k == 0 || m_SlotById.empty()) return;
+
+    const float maxDistanceSquared = maxDistance < std::sqrt(std::numeric_limits<float>::max())
+                                         ? maxDistance * maxDistance
+                                         : std::numeric_limits<float>::max();
+    const auto consider = [&](const Entry& entry) {
+        const SpatialHit hit{entry.id, DistanceSquared(point, entry.min, entry.max)};
+        if (hit.distanceSquared > maxDistanceSquared) return;
+        if (outHits.size() < k) {
+            outHits.push_back(hit);
+            std::push_heap(outHits.begin(), outHits.end(), CloserThan);
+        } else if (CloserThan(hit, outHits.front())) {
+            std::pop_heap(outHits.begin(), outHits.end(), CloserThan);
+            outHits.back() = hit;
+            std::push_heap(outHits.begin(), outHits.end(), CloserThan);
+        }
+    };
+
+    for (const uint32_t slot : m_Oversized) {
+        consider(m_Entries[slot]);
+    }
+
+    // Only oversized entries (or none): there are no cells to search
+    if (m_OccupiedMin.x > m_OccupiedMax.x) {
+        std::sort_heap(outHits.begin(), outHits.end(), CloserThan);
+        return;
+    }
+
+    // Grow a cube of cells around the query cell one shell at a time. An entry is
+    // reported from its cell nearest to the query cell, which is the first shell that
+    // reaches it, so nothing is visited twice.
+    const glm::ivec3 center = GetCell(point);
+    const glm::ivec3 gapToOccupied = glm::max(glm::max(m_OccupiedMin - center, center - m_OccupiedMax), glm::ivec3(0));
+    const int firstShell = std::max({gapToOccupied.x, gapToOccupied.y, gapToOccupied.z});
+
+    const auto visitCell = [&](const glm::ivec3& cell) {
+        if (glm::any(glm::lessThan(cell, m_OccupiedMin)) || glm::any(glm::greaterThan(cell, m_OccupiedMax))) return;
+        const auto it = m_Cells.find(GetCellKey(cell));
+        if (it == m_Cells.end()) return;
+        for (const uint32_t slot : it->second) {
+            const Entry& entry = m_Entries[slot];
+            if (glm::clamp(center, entry.cellMin, entry.cellMax) == cell) consider(entry);
+        }
+    };
+
+    for (int shell = firstShell;; ++shell) {
+        for (int x = center.x - shell; x <= center.x + shell; ++x) {
+            for (int y = center.y - shell; y <= center.y + shell; ++y) {
+                if (std::abs(x - center.x) == shell || std::abs(y - center.y) == shell) {
+                    for (int z = center.z - shell; z <= center.z + shell; ++z) visitCell({x, y, z});
+                } else {
+                    // Interior column: only its two end cells are on the shell
+                    visitCell({x, y, center.z - shell});
+                    if (shell > 0) visitCell({x, y, center.z + shell});
+                }
+            }
+        }
+
+        // Every unvisited entry lies outside the cube, at least this far from the point
+        const glm::vec3 cubeMin = glm::vec3(center - shell) * m_CellSize;
+        const glm::vec3 cubeMax = glm::vec3(center + shell + 1) * m_CellSize;
+        const glm::vec3 gap = glm::min(point - cubeMin, cubeMax - point);
+        const float reach = std::max(0.0f, std::min({gap.x, gap.y, gap.z}));
+
+        const bool coversOccupied = glm::all(glm::lessThanEqual(center - shell, m_OccupiedMin)) &&
+                                    glm::all(glm::greaterThanEqual(center + shell, m_OccupiedMax));
+        const bool heapDone = outHits.size() == k && outHits.front().distanceSquared <= reach * reach;
+        if (coversOccupied || heapDone || reach * reach > maxDistanceSquared) break;
+    }
+
+    std::sort_heap(outHits.begin(), outHits.end(), CloserThan);
+}
+
+} // namespace Spatial
@@ -0,0 +1,124 @@
+#ifndef SPATIAL_HASH_GRID_H
+#define SPATIAL_HASH_GRID_H
+
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+#include <glm/glm.hpp>
+#include "Core/Math/BoundingVolume.h"
+
+namespace Spatial {
+
+/**
+ * @brief One k-nearest result: entry id and squared distance from the query point to its box
+ */
+struct SpatialHit {
+    uint32_t id = 0;
+    float distanceSquared = 0.0f;
+};
+
+/**
+ * @brief Uniform grid of world-space cells hashed by integer cell coordinate
+ *
+ * Meant for many small, fast-moving objects: moving an entry only touches the
+ * cells it leaves and enters, and an entry that stays inside the same cells
+ * just has its box overwritten. There is no tree to refit or rebalance.
+ * Boxes covering more than kMaxCellsPerEntry cells are kept in a separate list
+ * that every query checks directly.
+ *
+ * Pick a cell size around the typical query radius or twice the typical object
+ * size. Queries are const and never modify the grid, so several threads may
+ * query at once as long as nobody is calling Set/Remove.
+ */
+class SpatialHashGrid {
+public:
+    static constexpr float kDefaultCellSize = 4.0f;
+    static constexpr uint32_t kMaxCellsPerEntry = 64;
+
+    explicit SpatialHashGrid(float cellSize = kDefaultCellSize);
+
+    /**
+     * @brief Remove every entry (the cell size is kept)
+     */
+    void Clear();
+
+    /**
+     * @brief Change the cell size and re-insert every entry
+     */
+    void SetCellSize(float cellSize);
+    [[nodiscard]] float GetCellSize() const { return m_CellSize; }
+
+    /**
+     * @brief Insert an entry, or move it if the id is already in the grid
+     */
+    void Set(uint32_t id, const Math::AABB& bounds);
+
+    /**
+     * @brief Remove an entry; returns false if the id was not in the grid
+     */
+    bool Remove(uint32_t id);
+
+    [[nodiscard]] bool Contains(uint32_t id) const { return m_SlotById.contains(id); }
+    [[nodiscard]] size_t Size() const { return m_SlotById.size(); }
+
+    /**
+     * @brief Ids whose box overlaps the given box (outIds is replaced, unordered)
+     */
+    void QueryAABB(const Math::AABB& bounds, std::vector<uint32_t>& outIds) const;
+
+    /**
+     * @brief Ids whose box comes within radius of center (outIds is replaced, unordered)
+     */
+    void QueryRadius(const glm::vec3& center, float radius, std::vector<uint32_t>& outIds) const;
+
+    /**
+     * @brief The k entries whose boxes are closest to point, nearest first
+     *
+     * A point inside a box is at distance 0 from it. Ties are broken by id.
+     *
+     * @param maxDistance Entries farther away than this are ignored
+     */
+    void QueryNearest(const glm::vec3& point, size_t k, std::vector<SpatialHit>& outHits,
+                      float maxDistance = std::numeric_limits<float>::max()) const;
+
+private:
+    struct Entry {
+        uint32_t id = 0;
+        glm::vec3 min{0.0f};
+        glm::vec3 max{0.0f};
+        glm::ivec3 cellMin{0};
+        glm::ivec3 cellMax{0};
+        bool oversized = false;
+    };
+
+    [[nodiscard]] glm::ivec3 GetCell(const glm::vec3& position) const;
+    static uint64_t GetCellKey(const glm::ivec3& cell);
+
+    void AddToCells(uint32_t slot);
+    void RemoveFromCells(uint32_t slot);
+
+    // Calls visit(entry) once per entry stored in the cell range, oversized entries included
+    template <typename Visitor>
+    void ForEachInCellRange(const glm::ivec3& cellMin, const glm::ivec3& cellMax, Visitor&& visit) const;
+
+    float m_CellSize = kDefaultCellSize;
+    float m_InverseCellSize = 1.0f / kDefaultCellSize;
+
+    // Slots are stable; freed slots are reused by later inserts
+    std::vector<Entry> m_Entries;
+    std::vector<uint32_t> m_FreeSlots;
+    std::unordered_map<uint32_t, uint32_t> m_SlotById;
+
+    // Cell key -> slots of the entries overlapping that cell
+    std::unordered_map<uint64_t, std::vector<uint32_t>> m_Cells;
+    std::vector<uint32_t> m_Oversized;
+
+    // Cells that ever held an entry since the last Clear; bounds k-nearest searches
+    glm::ivec3 m_OccupiedMin{std::numeric_limits<int>::max()};
+    glm::ivec3 m_OccupiedMax{std::numeric_limits<int>::min()};
+};
+
+} // namespace Spatial
+
+#endif // SPATIAL_HASH_GRID_H
@@ -1,7 +1,11 @@
 #version 330 core
+// Variants are compiled per material (ShaderLibrary::GetVariant); each keyword becomes a #define
+#pragma shader_feature HAS_TEXTURE RECEIVE_SHADOWS SPECULAR
 
 // Outputs colors in RGBA
-out vec4 FragColor;
+layout(location = 0) out vec4 FragColor;
+// Object instance id for GPU picking (scene view color attachment 1)
+layout(location = 1) out uint ObjectID;
 
 // Imports the normal from the Vertex Shader
 in vec3 Normal;
@@ -17,41 +21,65 @@ in vec4 fragPosLight;
 
 // Gets the Texture Unit from the main function
 uniform sampler2D tex0;
+// Object instance id from the vertex shader (a uniform, or per instance when instanced)
+flat in uint vObjectId;
 //**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//
 uniform sampler2D shadowMap;
 //**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//
-uniform bool hasTexture;
-// Added uniform for camera position
-uniform vec3 camPos;
+// Material parameters (MaterialBlockBuffer, std140; matches MaterialParams)
+struct MaterialBlock {
+    vec4 baseColor;
+    float specularStrength;
+    float shininess;
+    vec2 padding;
+};
+layout (std140) uniform Materials {
+    MaterialBlock materials[512];
+};
+// Block of the material being drawn
+uniform uint materialIndex;
+
+// Per-frame camera and light (FrameUniformBuffer, std140; order matches FrameUniformData)
+layout (std140) uniform FrameData {
+    mat4 view;
+    mat4 projection;
+    mat4 viewProjection;
+    mat4 lightSpaceMatrix;
+    vec4 camPos;         // xyz
+    vec4 lightDirection; // xyz, towards the light
+    vec4 lightColor;     // rgb, a = ambient strength
+};
 
 vec4 directLight()
 {
-    float ambient = 0.20f;
+    MaterialBlock material = materials[materialIndex];
+    float ambient = lightColor.a;
     vec3 normal = normalize(Normal);
-    vec3 lightDirection = normalize(vec3(-1.0f, 1.0f, 1.0f));
-    float diffuse = max(dot(normal, lightDirection), 0.0f);
-
-    float specularLight = 0.50f;
-    vec3 viewDirection = normalize(camPos - crntPos);
-    vec3 reflectionDirection = reflect(-lightDirection, Normal);
-    float specAmount = pow(max(dot(viewDirection, reflectionDirection), 0.0f), 16);
-    float specular = specAmount * specularLight;
+    vec3 toLight = normalize(lightDirection.xyz);
+    float diffuse = max(dot(normal, toLight), 0.0f);
 
-    vec4 lightColor = vec4(1.0, 1.0, 1.0, 1.0);
+    float specular = 0.0f;
+#ifdef SPECULAR
+    vec3 viewDirection = normalize(camPos.xyz - crntPos);
+    vec3 reflectionDirection = reflect(-toLight, Normal);
+    float specAmount = pow(max(dot(viewDirection, reflectionDirection), 0.0f), material.shininess);
+    specular = specAmount * material.specularStrength;
+#endif
 
-    vec4 texColor;
-    if (hasTexture) {
-        texColor = texture(tex0, TexCoord);
-        if (texColor.g == 0.0 && texColor.b == 0.0) {
-            texColor.g = texColor.r;
-            texColor.b = texColor.r;
-        }
-    } else {
-        texColor = vec4(1.0, 1.0, 1.0, 1.0);
+#ifdef HAS_TEXTURE
+    vec4 texColor = texture(tex0, TexCoord);
+    if (texColor.g == 0.0 && texColor.b == 0.0) {
+        texColor.g = texColor.r;
+        texColor.b = texColor.r;
     }
+#else
+    vec4 texColor = vec4(1.0, 1.0, 1.0, 1.0);
+#endif
+    texColor *= material.baseColor;
 
     // --- Shadow calculation ---
     float shadow = 1.0f;
+#ifdef RECEIVE_SHADOWS
     vec3 lightCoords = fragPosLight.xyz / fragPosLight.w;
     if(lightCoords.z <= 1.0f)
     {
@@ -61,16 +89,18 @@ vec4 directLight()
         // shadow = 0.0 gölgede, 1.0 aydınlıkta
         shadow = currentDepth - 0.005 > closestDepth ? 0.0 : 1.0;
     }
+#endif
 
     // Sadece diffuse ve specular gölgelenir, ambient her zaman eklenir
     float lighting = ambient + shadow * (diffuse + specular);
 
-    return texColor * lighting * lightColor;
+    return texColor * lighting * vec4(lightColor.rgb, 1.0);
 }
 
 void main()
 {
     FragColor = directLight();
+    ObjectID = vObjectId;
 
     // outputs final color
 }
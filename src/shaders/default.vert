@@ -1,18 +1,25 @@
 #version 330 core
 
 // Vertex attributes
-layout (location = 0) in vec3 aPos;
-layout (location = 1) in vec3 aNormal;
+layout (location = 0) in vec3 aPos;    // May be quantized to [0, 1]: the model matrix decodes it
+layout (location = 1) in vec2 aNormal; // Octahedral
 layout (location = 2) in vec2 aTexCoord;
 
-// Uniforms
+// Per-frame camera and light (FrameUniformBuffer, std140; order matches FrameUniformData)
+layout (std140) uniform FrameData {
+    mat4 view;
+    mat4 projection;
+    mat4 viewProjection;
+    mat4 lightSpaceMatrix;
+    vec4 camPos;         // xyz
+    vec4 lightDirection; // xyz, towards the light
+    vec4 lightColor;     // rgb, a = ambient strength
+};
+
+// Per-object uniforms
 uniform mat4 model;
-uniform mat4 view;
-uniform mat4 projection;
-
-//**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//
-uniform mat4 lightSpaceMatrix; // For shadow mapping, if needed
-//**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//
+// Object instance id for GPU picking, passed on to the fragment shader
+uniform uint objectId;
 
 
 // Output to fragment shader
@@ -20,17 +27,28 @@ out vec3 Normal;
 out vec2 TexCoord;
 // Outputs the current position for the Fragment Shader
 out vec3 crntPos;
+flat out uint vObjectId;
 
 //**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//
 out vec4 fragPosLight;
 //**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//
 
+// Octahedral normal of GeometryArena's packed vertices (VertexPacking::OctDecode)
+vec3 DecodeNormal(vec2 e)
+{
+    vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+    if (n.z < 0.0)
+        n.xy = (1.0 - abs(n.yx)) * vec2(n.x >= 0.0 ? 1.0 : -1.0, n.y >= 0.0 ? 1.0 : -1.0);
+    return normalize(n);
+}
+
 void main()
 {
 // Calculates the current position of the vertex in world space
     crntPos = vec3(model * vec4(aPos, 1.0));
-    Normal = aNormal;
+    Normal = DecodeNormal(aNormal);
     TexCoord = aTexCoord;
+    vObjectId = objectId;
 
 
     //**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//
@@ -38,5 +56,5 @@ void main()
     //**//**//**//**//**//**//**//**//**//**//**//**//**//**//**//
 
 
-    gl_Position = projection * view * model * vec4(aPos, 1.0);
+    gl_Position = viewProjection * vec4(crntPos, 1.0);
 }
\ No newline at end of file
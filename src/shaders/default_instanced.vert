@@ -0,0 +1,49 @@
+#version 330 core
+
+// Vertex attributes
+layout (location = 0) in vec3 aPos;    // May be quantized to [0, 1]: the model matrix decodes it
+layout (location = 1) in vec2 aNormal; // Octahedral
+layout (location = 2) in vec2 aTexCoord;
+
+// Per-instance attributes (InstanceBuffer): the model matrix takes locations 3-6
+layout (location = 3) in mat4 aModel;
+layout (location = 7) in uint aObjectId;
+
+// Per-frame camera and light (FrameUniformBuffer, std140; order matches FrameUniformData)
+layout (std140) uniform FrameData {
+    mat4 view;
+    mat4 projection;
+    mat4 viewProjection;
+    mat4 lightSpaceMatrix;
+    vec4 camPos;         // xyz
+    vec4 lightDirection; // xyz, towards the light
+    vec4 lightColor;     // rgb, a = ambient strength
+};
+
+// Output to fragment shader (same as default.vert, so default.frag is shared)
+out vec3 Normal;
+out vec2 TexCoord;
+out vec3 crntPos;
+flat out uint vObjectId;
+out vec4 fragPosLight;
+
+// Octahedral normal of GeometryArena's packed vertices (VertexPacking::OctDecode)
+vec3 DecodeNormal(vec2 e)
+{
+    vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+    if (n.z < 0.0)
+        n.xy = (1.0 - abs(n.yx)) * vec2(n.x >= 0.0 ? 1.0 : -1.0, n.y >= 0.0 ? 1.0 : -1.0);
+    return normalize(n);
+}
+
+void main()
+{
+    crntPos = vec3(aModel * vec4(aPos, 1.0));
+    Normal = DecodeNormal(aNormal);
+    TexCoord = aTexCoord;
+    vObjectId = aObjectId;
+
+    fragPosLight = lightSpaceMatrix * vec4(crntPos, 1.0);
+
+    gl_Position = viewProjection * vec4(crntPos, 1.0);
+}
@@ -0,0 +1,30 @@
+#version 330 core
+// Drawn in place of a material's shader while ShaderLibrary still compiles it;
+// pairs with default.vert and default_instanced.vert, so it must stay cheap to build
+
+layout(location = 0) out vec4 FragColor;
+// Object instance id for GPU picking: objects stay selectable while they compile
+layout(location = 1) out uint ObjectID;
+
+in vec3 Normal;
+flat in uint vObjectId;
+
+// Material parameters (MaterialBlockBuffer, std140; matches MaterialParams)
+struct MaterialBlock {
+    vec4 baseColor;
+    float specularStrength;
+    float shininess;
+    vec2 padding;
+};
+layout (std140) uniform Materials {
+    MaterialBlock materials[512];
+};
+uniform uint materialIndex;
+
+void main()
+{
+    // Unlit base color, with a little shading from the normal so shapes stay readable
+    float shade = 0.6 + 0.4 * abs(normalize(Normal).y);
+    FragColor = vec4(materials[materialIndex].baseColor.rgb * shade, 1.0);
+    ObjectID = vObjectId;
+}
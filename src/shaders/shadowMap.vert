@@ -1,7 +1,17 @@
 #version 330 core
 layout (location = 0) in vec3 aPos;
 
-uniform mat4 lightSpaceMatrix;
+// Per-frame camera and light (FrameUniformBuffer, std140; order matches FrameUniformData)
+layout (std140) uniform FrameData {
+    mat4 view;
+    mat4 projection;
+    mat4 viewProjection;
+    mat4 lightSpaceMatrix;
+    vec4 camPos;         // xyz
+    vec4 lightDirection; // xyz, towards the light
+    vec4 lightColor;     // rgb, a = ambient strength
+};
+
 uniform mat4 model;
 
 void main()
@@ -1,7 +1,10 @@
 #version 330 core
+#pragma shader_feature HAS_TEXTURE
 
 in vec3 Normal;
-out vec4 FragColor;
+layout(location = 0) out vec4 FragColor;
+// Object instance id for GPU picking (scene view color attachment 1)
+layout(location = 1) out uint ObjectID;
 
 
 // Texture coordinates
@@ -10,21 +13,34 @@ in vec2 TexCoord;
 
 // Gets the Texture Unit from the main function
 uniform sampler2D tex0;
-uniform bool hasTexture;
+uniform uint objectId;
+
+// Material parameters (MaterialBlockBuffer, std140; matches MaterialParams)
+struct MaterialBlock {
+    vec4 baseColor;
+    float specularStrength;
+    float shininess;
+    vec2 padding;
+};
+layout (std140) uniform Materials {
+    MaterialBlock materials[512];
+};
+// Block of the material being drawn
+uniform uint materialIndex;
 
 void main()
 {
-    vec4 color;
-    if (hasTexture) {
-        vec4 texColor = texture(tex0, TexCoord);
-        // If the texture is grayscale (R only), replicate R to G and B
-        if (texColor.g == 0.0 && texColor.b == 0.0) {
-            texColor.g = texColor.r;
-            texColor.b = texColor.r;
-        }
-        color = texColor;
-    } else {
-        color = vec4(1.0, 1.0, 1.0, 1.0); // fallback white
+    MaterialBlock material = materials[materialIndex];
+#ifdef HAS_TEXTURE
+    vec4 color = texture(tex0, TexCoord);
+    // If the texture is grayscale (R only), replicate R to G and B
+    if (color.g == 0.0 && color.b == 0.0) {
+        color.g = color.r;
+        color.b = color.r;
     }
-    FragColor = color;
+#else
+    vec4 color = vec4(1.0, 1.0, 1.0, 1.0); // fallback white
+#endif
+    FragColor = color * material.baseColor;
+    ObjectID = objectId;
 }
\ No newline at end of file
@@ -1,22 +1,40 @@
 #version 330 core
 
 // Vertex attributes
-layout (location = 0) in vec3 aPos;
-layout (location = 1) in vec3 aNormal;
+layout (location = 0) in vec3 aPos;    // May be quantized to [0, 1]: the model matrix decodes it
+layout (location = 1) in vec2 aNormal; // Octahedral
 layout (location = 2) in vec2 aTexCoord;
 
-// Uniforms
+// Per-frame camera and light (FrameUniformBuffer, std140; order matches FrameUniformData)
+layout (std140) uniform FrameData {
+    mat4 view;
+    mat4 projection;
+    mat4 viewProjection;
+    mat4 lightSpaceMatrix;
+    vec4 camPos;         // xyz
+    vec4 lightDirection; // xyz, towards the light
+    vec4 lightColor;     // rgb, a = ambient strength
+};
+
+// Per-object uniforms
 uniform mat4 model;
-uniform mat4 view;
-uniform mat4 projection;
 
 // Output to fragment shader
 out vec3 Normal;
 out vec2 TexCoord;
 
+// Octahedral normal of GeometryArena's packed vertices (VertexPacking::OctDecode)
+vec3 DecodeNormal(vec2 e)
+{
+    vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+    if (n.z < 0.0)
+        n.xy = (1.0 - abs(n.yx)) * vec2(n.x >= 0.0 ? 1.0 : -1.0, n.y >= 0.0 ? 1.0 : -1.0);
+    return normalize(n);
+}
+
 void main()
 {
-    gl_Position = projection * view * model * vec4(aPos, 1.0);
-    Normal = aNormal;
+    gl_Position = viewProjection * model * vec4(aPos, 1.0);
+    Normal = DecodeNormal(aNormal);
     TexCoord = aTexCoord;
 }
\ No newline at end of file
@@ -36,3 +36,18 @@ TEST(ComponentTest, UpdateCallsComponents) {
     EXPECT_FLOAT_EQ(comp->lastDeltaTime, 0.016f);
 }
 
+
+TEST(ComponentTest, InstanceIDsAreUniqueAndResolvable) {
+    uint32_t firstID = 0;
+    {
+        GameObject first;
+        GameObject second;
+        firstID = first.GetInstanceID();
+        EXPECT_NE(firstID, 0u);
+        EXPECT_NE(firstID, second.GetInstanceID());
+        EXPECT_EQ(GameObject::FindByInstanceID(firstID), &first);
+        EXPECT_EQ(GameObject::FindByInstanceID(second.GetInstanceID()), &second);
+    }
+    EXPECT_EQ(GameObject::FindByInstanceID(firstID), nullptr);
+    EXPECT_EQ(GameObject::FindByInstanceID(0), nullptr);
+}
@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+#include "Engine/Render/Mesh/ArenaAllocator.h"
+
+TEST(ArenaAllocatorTest, AllocatesFirstFitAndRejectsWhatDoesNotFit)
+{
+    ArenaAllocator arena(100);
+    EXPECT_EQ(arena.Allocate(30), 0u);
+    EXPECT_EQ(arena.Allocate(30), 30u);
+    EXPECT_EQ(arena.Allocate(50), ArenaAllocator::kInvalidOffset);
+    EXPECT_EQ(arena.Allocate(0), ArenaAllocator::kInvalidOffset);
+    EXPECT_EQ(arena.GetUsed(), 60u);
+    EXPECT_EQ(arena.GetAllocationCount(), 2u);
+
+    // The hole at the front is reused before the tail
+    arena.Free(0);
+    EXPECT_EQ(arena.Allocate(10), 0u);
+    EXPECT_EQ(arena.Allocate(25), 60u);
+}
+
+TEST(ArenaAllocatorTest, FreedNeighboursCoalesce)
+{
+    ArenaAllocator arena(90);
+    const uint32_t a = arena.Allocate(30);
+    const uint32_t b = arena.Allocate(30);
+    const uint32_t c = arena.Allocate(30);
+    EXPECT_EQ(arena.GetFreeRangeCount(), 0u);
+
+    arena.Free(a);
+    arena.Free(c);
+    EXPECT_EQ(arena.GetFreeRangeCount(), 2u);
+    EXPECT_EQ(arena.GetLargestFreeRange(), 30u);
+    EXPECT_EQ(arena.GetFragmentedSpace(), 30u);
+
+    arena.Free(b);
+    EXPECT_EQ(arena.GetFreeRangeCount(), 1u);
+    EXPECT_EQ(arena.GetLargestFreeRange(), 90u);
+    EXPECT_EQ(arena.GetUsed(), 0u);
+
+    // Unknown offsets are ignored
+    arena.Free(45);
+    EXPECT_EQ(arena.GetUsed(), 0u);
+}
+
+TEST(ArenaAllocatorTest, GrowExtendsTheTrailingFreeRange)
+{
+    ArenaAllocator arena(40);
+    EXPECT_EQ(arena.Allocate(30), 0u);
+    EXPECT_EQ(arena.Allocate(20), ArenaAllocator::kInvalidOffset);
+
+    arena.Grow(80);
+    EXPECT_EQ(arena.GetCapacity(), 80u);
+    EXPECT_EQ(arena.GetFreeRangeCount(), 1u);
+    EXPECT_EQ(arena.Allocate(20), 30u);
+}
+
+TEST(ArenaAllocatorTest, CompactPacksAllocationsAndReportsOnlyMovedRanges)
+{
+    ArenaAllocator arena(100);
+    const uint32_t a = arena.Allocate(10);
+    const uint32_t b = arena.Allocate(20);
+    const uint32_t c = arena.Allocate(30);
+    const uint32_t d = arena.Allocate(10);
+    EXPECT_EQ(a, 0u);
+    EXPECT_EQ(d, 60u);
+    arena.Free(b);
+
+    const std::vector<ArenaAllocator::Move> moves = arena.Compact();
+    ASSERT_EQ(moves.size(), 2u);
+    EXPECT_EQ(moves[0].from, c);
+    EXPECT_EQ(moves[0].to, 10u);
+    EXPECT_EQ(moves[0].size, 30u);
+    EXPECT_EQ(moves[1].from, d);
+    EXPECT_EQ(moves[1].to, 40u);
+
+    EXPECT_EQ(arena.GetFreeRangeCount(), 1u);
+    EXPECT_EQ(arena.GetLargestFreeRange(), 50u);
+    EXPECT_EQ(arena.GetFragmentedSpace(), 0u);
+    // The allocations keep their new offsets for Free
+    arena.Free(10);
+    EXPECT_EQ(arena.GetUsed(), 20u);
+}
@@ -0,0 +1,37 @@
+#include <gtest/gtest.h>
+#include "Core/Math/Frustum.h"
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace {
+    // Camera at the origin looking down -Z, square aspect
+    glm::mat4 MakeViewProjection() {
+        const glm::mat4 projection = glm::perspective(glm::radians(90.0f), 1.0f, 0.1f, 100.0f);
+        const glm::mat4 view = glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+        return projection * view;
+    }
+}
+
+TEST(FrustumTest, CameraFrustumContainsPointsInView)
+{
+    const Math::Frustum frustum(MakeViewProjection());
+
+    EXPECT_TRUE(frustum.ContainsPoint(glm::vec3(0.0f, 0.0f, -10.0f)));
+    EXPECT_FALSE(frustum.ContainsPoint(glm::vec3(0.0f, 0.0f, 10.0f)));
+    EXPECT_FALSE(frustum.ContainsPoint(glm::vec3(20.0f, 0.0f, -10.0f)));
+    EXPECT_FALSE(frustum.ContainsPoint(glm::vec3(0.0f, 0.0f, -200.0f)));
+}
+
+TEST(FrustumTest, RectSubFrustumCoversOnlyItsScreenArea)
+{
+    // Right half of the screen
+    Math::Frustum frustum;
+    frustum.SetFromMatrix(MakeViewProjection(), glm::vec2(0.0f, -1.0f), glm::vec2(1.0f, 1.0f));
+
+    EXPECT_TRUE(frustum.ContainsPoint(glm::vec3(5.0f, 0.0f, -10.0f)));
+    EXPECT_FALSE(frustum.ContainsPoint(glm::vec3(-5.0f, 0.0f, -10.0f)));
+
+    // A box straddling the rectangle's left edge still intersects it
+    EXPECT_TRUE(frustum.IntersectsAABB(glm::vec3(-0.5f, 0.0f, -10.0f), glm::vec3(1.0f)));
+    EXPECT_FALSE(frustum.IntersectsAABB(glm::vec3(-5.0f, 0.0f, -10.0f), glm::vec3(1.0f)));
+}
@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+#include "Engine/Render/View/RenderView.h"
+#include <glm/gtc/matrix_transform.hpp>
+#include <iostream>
+
+namespace {
+    // Stand-ins: batching only compares addresses
+    template <typename T>
+    T* Fake(std::vector<int>& storage, const size_t index) {
+        return reinterpret_cast<T*>(&storage[index]);
+    }
+
+    RenderItem MakeItem(Mesh* mesh, Material* material, const uint32_t id, const bool instanceable = true) {
+        RenderItem item;
+        item.world = glm::translate(glm::mat4(1.0f), glm::vec3(static_cast<float>(id), 0.0f, 0.0f));
+        item.mesh = mesh;
+        item.material = material;
+        item.objectId = id;
+        item.instanceable = instanceable;
+        return item;
+    }
+}
+
+TEST(InstanceBatchTest, MergesRunsWithSameMeshAndMaterial)
+{
+    std::vector<int> storage(4);
+    Mesh* cube = Fake<Mesh>(storage, 0);
+    Mesh* sphere = Fake<Mesh>(storage, 1);
+    Material* wood = Fake<Material>(storage, 2);
+    Material* stone = Fake<Material>(storage, 3);
+
+    std::vector<RenderItem> items = {
+        MakeItem(cube, wood, 1), MakeItem(cube, wood, 2), MakeItem(cube, wood, 3),
+        MakeItem(cube, stone, 4),                               // Run of one: drawn alone
+        MakeItem(sphere, stone, 5), MakeItem(sphere, stone, 6, false), // No instanced shader
+        MakeItem(sphere, stone, 7), MakeItem(sphere, stone, 8),
+    };
+    items.push_back(MakeItem(sphere, stone, 9));
+    items.back().hidden = true; // Occluded: never drawn
+
+    std::vector<InstanceBatch> batches;
+    std::vector<InstanceData> instances;
+    InstanceBatching::Build(items, batches, instances);
+
+    ASSERT_EQ(batches.size(), 5u);
+    EXPECT_TRUE(batches[0].instanced);
+    EXPECT_EQ(batches[0].firstItem, 0u);
+    EXPECT_EQ(batches[0].itemCount, 3u);
+    EXPECT_EQ(batches[0].firstInstance, 0u);
+
+    EXPECT_FALSE(batches[1].instanced);
+    EXPECT_EQ(batches[1].firstItem, 3u);
+    EXPECT_FALSE(batches[2].instanced);
+    EXPECT_EQ(batches[2].firstItem, 4u);
+    EXPECT_FALSE(batches[3].instanced);
+    EXPECT_EQ(batches[3].firstItem, 5u);
+
+    EXPECT_TRUE(batches[4].instanced);
+    EXPECT_EQ(batches[4].firstItem, 6u);
+    EXPECT_EQ(batches[4].itemCount, 2u);
+    EXPECT_EQ(batches[4].firstInstance, 3u);
+
+    ASSERT_EQ(instances.size(), 5u);
+    const uint32_t expectedIds[] = {1, 2, 3, 7, 8};
+    for (size_t i = 0; i < instances.size(); ++i) {
+        EXPECT_EQ(instances[i].objectId, expectedIds[i]);
+        EXPECT_EQ(instances[i].model[3].x, static_cast<float>(expectedIds[i]));
+    }
+}
+
+TEST(InstanceBatchTest, IndirectPathInstancesSingleItems)
+{
+    std::vector<int> storage(3);
+    Mesh* cube = Fake<Mesh>(storage, 0);
+    Mesh* sphere = Fake<Mesh>(storage, 1);
+    Material* wood = Fake<Material>(storage, 2);
+
+    // With multi-draw indirect a run of one becomes a command of one instance
+    const std::vector<RenderItem> items = {
+        MakeItem(cube, wood, 1), MakeItem(sphere, wood, 2), MakeItem(sphere, wood, 3, false),
+    };
+    std::vector<InstanceBatch> batches;
+    std::vector<InstanceData> instances;
+    InstanceBatching::Build(items, batches, instances, 1);
+
+    ASSERT_EQ(batches.size(), 3u);
+    EXPECT_TRUE(batches[0].instanced);
+    EXPECT_TRUE(batches[1].instanced);
+    EXPECT_EQ(batches[1].firstInstance, 1u);
+    EXPECT_FALSE(batches[2].instanced);
+    EXPECT_EQ(instances.size(), 2u);
+}
+
+TEST(InstanceBatchTest, TenThousandCubesInOneDrawCall)
+{
+    std::vector<int> storage(2);
+    Mesh* cube = Fake<Mesh>(storage, 0);
+    Material* material = Fake<Material>(storage, 1);
+    const auto* shader = reinterpret_cast<const Shader*>(&storage[1]);
+
+    // Camera at the origin looking down -Z over a 100x100 grid
+    RenderView view;
+    const glm::mat4 viewMatrix = glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    view.Reset(viewMatrix, glm::mat4(1.0f), 1);
+    for (uint32_t i = 0; i < 10000; ++i) {
+        RenderItem item = MakeItem(cube, material, i + 1);
+        item.world = glm::translate(glm::mat4(1.0f), glm::vec3(static_cast<float>(i % 100),
+                                                               0.0f, -static_cast<float>(i / 100) - 1.0f));
+        item.sortKey = view.MakeSortKey(RenderPass::Opaque, shader, material, cube, -(viewMatrix * item.world[3]).z);
+        view.Add(item);
+    }
+    view.Sort();
+    view.BuildBatches();
+
+    std::cout << "[Instancing] 10000 cubes -> " << view.GetBatches().size() << " draw call(s)" << std::endl;
+    ASSERT_EQ(view.GetBatches().size(), 1u);
+    EXPECT_TRUE(view.GetBatches()[0].instanced);
+    EXPECT_EQ(view.GetBatches()[0].itemCount, 10000u);
+    EXPECT_EQ(view.GetInstances().size(), 10000u);
+    // Instances keep the front-to-back order of the sorted items
+    EXPECT_LE(view.GetInstances().front().model[3].z, 0.0f);
+    EXPECT_GE(view.GetInstances().front().model[3].z, view.GetInstances().back().model[3].z);
+}
+
+TEST(InstanceBatchTest, OwnMaterialsWithEqualStateShareADrawCall)
+{
+    // Every object owns its Material, as Scene::CreatePrimitive makes them
+    std::vector<int> storage(10003);
+    Mesh* cube = Fake<Mesh>(storage, 0);
+    const auto* shader = reinterpret_cast<const Shader*>(&storage[1]);
+    const void* instancedShader = &storage[2];
+
+    RenderView view;
+    const glm::mat4 viewMatrix = glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    view.Reset(viewMatrix, glm::mat4(1.0f), 1);
+    for (uint32_t i = 0; i < 10000; ++i) {
+        RenderItem item = MakeItem(cube, Fake<Material>(storage, 3 + i), i + 1);
+        item.world = glm::translate(glm::mat4(1.0f), glm::vec3(static_cast<float>(i % 100),
+                                                               0.0f, -static_cast<float>(i / 100) - 1.0f));
+        // One cube was recoloured: its parameters live in another block
+        item.drawState = view.GetDrawState(instancedShader, nullptr, i == 5000 ? 7u : 0u);
+        item.sortKey = view.MakeSortKey(RenderPass::Opaque, shader, item.drawState, cube,
+                                        -(viewMatrix * item.world[3]).z);
+        view.Add(item);
+    }
+    view.Sort();
+    view.BuildBatches();
+
+    ASSERT_EQ(view.GetBatches().size(), 2u);
+    EXPECT_TRUE(view.GetBatches()[0].instanced);
+    EXPECT_EQ(view.GetBatches()[0].itemCount, 9999u);
+    EXPECT_FALSE(view.GetBatches()[1].instanced);
+    EXPECT_EQ(view.GetItems()[view.GetBatches()[1].firstItem].objectId, 5001u);
+}
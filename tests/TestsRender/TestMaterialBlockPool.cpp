@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+#include "Engine/Render/Material/MaterialBlockPool.h"
+
+namespace {
+    MaterialParams MakeParams(const float red) {
+        MaterialParams params;
+        params.baseColor = glm::vec4(red, 0.0f, 0.0f, 1.0f);
+        return params;
+    }
+}
+
+TEST(MaterialBlockPoolTest, EqualParamsShareABlock)
+{
+    MaterialBlockPool pool;
+    EXPECT_EQ(pool.Acquire(MaterialParams{}), MaterialBlockPool::kDefaultBlock);
+
+    const uint32_t red = pool.Acquire(MakeParams(1.0f));
+    EXPECT_NE(red, MaterialBlockPool::kDefaultBlock);
+    EXPECT_EQ(pool.Acquire(MakeParams(1.0f)), red);
+    EXPECT_NE(pool.Acquire(MakeParams(0.5f)), red);
+    EXPECT_EQ(pool.GetLiveCount(), 3u);
+    EXPECT_EQ(pool.Get(red).baseColor.x, 1.0f);
+}
+
+TEST(MaterialBlockPoolTest, SoleUserEditDirtiesOnlyItsBlock)
+{
+    MaterialBlockPool pool;
+    const uint32_t index = pool.Acquire(MakeParams(1.0f));
+    pool.ClearDirty();
+
+    EXPECT_EQ(pool.Update(index, MakeParams(0.25f)), index);
+    ASSERT_EQ(pool.GetDirty().size(), 1u);
+    EXPECT_EQ(pool.GetDirty()[0], index);
+    EXPECT_EQ(pool.Get(index).baseColor.x, 0.25f);
+    // The old parameters are no longer found
+    EXPECT_NE(pool.Acquire(MakeParams(1.0f)), index);
+}
+
+TEST(MaterialBlockPoolTest, SharedEditMovesToAnotherBlock)
+{
+    MaterialBlockPool pool;
+    const uint32_t shared = pool.Acquire(MakeParams(1.0f));
+    pool.Acquire(MakeParams(1.0f));
+
+    const uint32_t edited = pool.Update(shared, MakeParams(0.5f));
+    EXPECT_NE(edited, shared);
+    EXPECT_EQ(pool.Get(shared).baseColor.x, 1.0f);
+
+    // Editing back to existing parameters reuses that block
+    EXPECT_EQ(pool.Update(edited, MakeParams(1.0f)), shared);
+    EXPECT_EQ(pool.GetLiveCount(), 2u);
+}
+
+TEST(MaterialBlockPoolTest, ReleasedBlocksAreReusedAndFullPoolFallsBack)
+{
+    MaterialBlockPool pool(3);
+    const uint32_t a = pool.Acquire(MakeParams(0.1f));
+    const uint32_t b = pool.Acquire(MakeParams(0.2f));
+    EXPECT_EQ(pool.Acquire(MakeParams(0.3f)), MaterialBlockPool::kDefaultBlock);
+
+    pool.Release(a);
+    EXPECT_EQ(pool.GetLiveCount(), 2u);
+    EXPECT_EQ(pool.Acquire(MakeParams(0.3f)), a);
+    EXPECT_NE(b, a);
+
+    // The default block is pinned
+    pool.Release(MaterialBlockPool::kDefaultBlock);
+    pool.Release(MaterialBlockPool::kDefaultBlock);
+    EXPECT_EQ(pool.Acquire(MaterialParams{}), MaterialBlockPool::kDefaultBlock);
+}
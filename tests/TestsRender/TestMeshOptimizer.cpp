@@ -0,0 +1,296 @@
+#include <gtest/gtest.h>
+#include "Engine/Render/Mesh/MeshOptimizer.h"
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <numbers>
+#include <tuple>
+
+namespace {
+    struct TestVertex {
+        glm::vec3 position;
+        glm::vec3 normal;
+        glm::vec2 texCoords;
+    };
+
+    struct TestMesh {
+        std::vector<TestVertex> vertices;
+        std::vector<uint32_t> indices;
+    };
+
+    // Row by row, like Primitives::CreatePlane
+    TestMesh MakeGrid(const int cells) {
+        TestMesh mesh;
+        for (int z = 0; z <= cells; ++z) {
+            for (int x = 0; x <= cells; ++x) {
+                const glm::vec2 uv(static_cast<float>(x) / cells, static_cast<float>(z) / cells);
+                mesh.vertices.push_back({glm::vec3(uv.x, 0.0f, uv.y), glm::vec3(0.0f, 1.0f, 0.0f), uv});
+            }
+        }
+        const auto row = static_cast<uint32_t>(cells + 1);
+        for (uint32_t z = 0; z < static_cast<uint32_t>(cells); ++z) {
+            for (uint32_t x = 0; x < static_cast<uint32_t>(cells); ++x) {
+                const uint32_t i = z * row + x;
+                mesh.indices.insert(mesh.indices.end(), {i, i + row, i + 1, i + 1, i + row, i + row + 1});
+            }
+        }
+        return mesh;
+    }
+
+    // UV sphere with three vertices per triangle, as an unindexed import would arrive
+    TestMesh MakeSphereSoup(const int slices, const int stacks) {
+        const auto point = [&](const int i, const int j) {
+            const float phi = std::numbers::pi_v<float> * static_cast<float>(i) / static_cast<float>(stacks);
+            const float theta = 2.0f * std::numbers::pi_v<float> * static_cast<float>(j) / static_cast<float>(slices);
+            const glm::vec3 normal(std::sin(phi) * std::cos(theta), std::cos(phi), std::sin(phi) * std::sin(theta));
+            return TestVertex{normal * 0.5f, normal, glm::vec2(static_cast<float>(j) / slices, static_cast<float>(i) / stacks)};
+        };
+        TestMesh mesh;
+        for (int i = 0; i < stacks; ++i) {
+            for (int j = 0; j < slices; ++j) {
+                for (const auto& [di, dj] : std::array<std::pair<int, int>, 6>{{{0, 0}, {1, 0}, {0, 1}, {0, 1}, {1, 0}, {1, 1}}}) {
+                    mesh.indices.push_back(static_cast<uint32_t>(mesh.vertices.size()));
+                    mesh.vertices.push_back(point(i + di, j + dj));
+                }
+            }
+        }
+        return mesh;
+    }
+
+    // Two concentric sphere soups, wound outwards, the inner one first so Tipsify draws it first
+    TestMesh MakeNestedSpheres(const int slices, const int stacks) {
+        TestMesh mesh;
+        for (const float scale : {0.5f, 1.0f}) {
+            TestMesh shell = MakeSphereSoup(slices, stacks);
+            const auto offset = static_cast<uint32_t>(mesh.vertices.size());
+            for (TestVertex& vertex : shell.vertices) vertex.position *= scale;
+            for (size_t t = 0; t + 2 < shell.indices.size(); t += 3) std::swap(shell.indices[t + 1], shell.indices[t + 2]);
+            for (const uint32_t index : shell.indices) mesh.indices.push_back(offset + index);
+            mesh.vertices.insert(mesh.vertices.end(), shell.vertices.begin(), shell.vertices.end());
+        }
+        return mesh;
+    }
+
+    void Weld(TestMesh& mesh) {
+        std::vector<uint32_t> remap;
+        const size_t welded = MeshOptimizer::BuildWeldRemap(mesh.vertices.data(), mesh.vertices.size(),
+                                                            sizeof(TestVertex), remap);
+        MeshOptimizer::RemapIndices(mesh.indices.data(), mesh.indices.size(), remap);
+        MeshOptimizer::RemapVertices(mesh.vertices, remap, welded);
+    }
+
+    /**
+     * Overdraw proxy: rasterize the mesh orthographically along each direction into a
+     * 64x64 depth buffer with back-face culling and a less depth test, and return the
+     * fragments that passed the test per covered pixel (1 is no overdraw).
+     */
+    float MeasureOverdraw(const TestMesh& mesh, const std::vector<glm::vec3>& directions) {
+        constexpr int kSize = 64;
+        uint32_t shaded = 0;
+        uint32_t covered = 0;
+        for (const glm::vec3& direction : directions) {
+            const glm::vec3 forward = glm::normalize(direction);
+            const glm::vec3 helper = std::abs(forward.y) < 0.9f ? glm::vec3(0.0f, 1.0f, 0.0f) : glm::vec3(1.0f, 0.0f, 0.0f);
+            const glm::vec3 right = glm::normalize(glm::cross(forward, helper));
+            const glm::vec3 up = glm::cross(right, forward);
+            std::vector<float> depth(kSize * kSize, std::numeric_limits<float>::max());
+
+            for (size_t t = 0; t + 2 < mesh.indices.size(); t += 3) {
+                std::array<glm::vec3, 3> p{};
+                for (int k = 0; k < 3; ++k) {
+                    const glm::vec3& position = mesh.vertices[mesh.indices[t + k]].position;
+                    // Mesh within [-1, 1] maps onto the whole buffer
+                    p[k] = glm::vec3((glm::dot(position, right) + 1.0f) * 0.5f * kSize,
+                                     (glm::dot(position, up) + 1.0f) * 0.5f * kSize, glm::dot(position, forward));
+                }
+                // Counter-clockwise as seen from the camera: right x up points back at it
+                const float area = (p[1].x - p[0].x) * (p[2].y - p[0].y) - (p[2].x - p[0].x) * (p[1].y - p[0].y);
+                if (area <= 0.0f) continue;
+
+                const int minX = std::max(0, static_cast<int>(std::floor(std::min({p[0].x, p[1].x, p[2].x}))));
+                const int maxX = std::min(kSize - 1, static_cast<int>(std::ceil(std::max({p[0].x, p[1].x, p[2].x}))));
+                const int minY = std::max(0, static_cast<int>(std::floor(std::min({p[0].y, p[1].y, p[2].y}))));
+                const int maxY = std::min(kSize - 1, static_cast<int>(std::ceil(std::max({p[0].y, p[1].y, p[2].y}))));
+                for (int y = minY; y <= maxY; ++y) {
+                    for (int x = minX; x <= maxX; ++x) {
+                        const glm::vec2 pixel(static_cast<float>(x) + 0.5f, static_cast<float>(y) + 0.5f);
+                        float weights[3];
+                        bool inside = true;
+                        for (int k = 0; k < 3 && inside; ++k) {
+                            const glm::vec3& a = p[(k + 1) % 3];
+                            const glm::vec3& b = p[(k + 2) % 3];
+                            weights[k] = ((b.x - a.x) * (pixel.y - a.y) - (pixel.x - a.x) * (b.y - a.y)) / area;
+                            inside = weights[k] >= 0.0f;
+                        }
+                        if (!inside) continue;
+                        const float z = weights[0] * p[0].z + weights[1] * p[1].z + weights[2] * p[2].z;
+                        float& stored = depth[y * kSize + x];
+                        if (z >= stored) continue;
+                        if (stored == std::numeric_limits<float>::max()) ++covered;
+                        stored = z;
+                        ++shaded;
+                    }
+                }
+            }
+        }
+        return covered > 0 ? static_cast<float>(shaded) / static_cast<float>(covered) : 0.0f;
+    }
+
+    // Triangles as position triples, rotated so the smallest corner comes first (winding kept)
+    std::vector<std::array<float, 9>> Triangles(const TestMesh& mesh) {
+        std::vector<std::array<float, 9>> triangles;
+        for (size_t t = 0; t + 2 < mesh.indices.size(); t += 3) {
+            std::array<glm::vec3, 3> corners{};
+            for (int k = 0; k < 3; ++k) corners[k] = mesh.vertices[mesh.indices[t + k]].position;
+            const auto less = [](const glm::vec3& a, const glm::vec3& b) {
+                return std::tie(a.x, a.y, a.z) < std::tie(b.x, b.y, b.z);
+            };
+            const auto first = std::min_element(corners.begin(), corners.end(), less) - corners.begin();
+            std::array<float, 9> triangle{};
+            for (int k = 0; k < 3; ++k) {
+                const glm::vec3& p = corners[(first + k) % 3];
+                triangle[k * 3] = p.x;
+                triangle[k * 3 + 1] = p.y;
+                triangle[k * 3 + 2] = p.z;
+            }
+            triangles.push_back(triangle);
+        }
+        std::sort(triangles.begin(), triangles.end());
+        return triangles;
+    }
+
+    VertexCacheStats Analyze(const TestMesh& mesh) {
+        return MeshOptimizer::AnalyzeVertexCache(mesh.indices.data(), mesh.indices.size(), mesh.vertices.size());
+    }
+
+    void Report(const char* name, const VertexCacheStats& before, const VertexCacheStats& after) {
+        std::cout << "[MeshOptimizer] " << name << ": ACMR " << before.acmr << " -> " << after.acmr
+                  << ", ATVR " << before.atvr << " -> " << after.atvr << std::endl;
+    }
+}
+
+TEST(MeshOptimizerTest, AnalyzeCountsFifoMisses)
+{
+    // Two triangles sharing an edge: 4 transforms
+    const std::vector<uint32_t> quad = {0, 1, 2, 2, 1, 3};
+    const VertexCacheStats stats = MeshOptimizer::AnalyzeVertexCache(quad.data(), quad.size(), 4);
+    EXPECT_EQ(stats.transforms, 4u);
+    EXPECT_FLOAT_EQ(stats.acmr, 2.0f);
+    EXPECT_FLOAT_EQ(stats.atvr, 1.0f);
+
+    // A cache of 3 has evicted vertex 0 by the time it comes back
+    const std::vector<uint32_t> fan = {0, 1, 2, 3, 4, 0};
+    EXPECT_EQ(MeshOptimizer::AnalyzeVertexCache(fan.data(), fan.size(), 5, 3).transforms, 6u);
+}
+
+TEST(MeshOptimizerTest, WeldMergesIdenticalVerticesOnly)
+{
+    TestMesh mesh = MakeSphereSoup(16, 8);
+    const size_t soupVertices = mesh.vertices.size();
+    const auto before = Triangles(mesh);
+
+    std::vector<uint32_t> remap;
+    const size_t welded = MeshOptimizer::BuildWeldRemap(mesh.vertices.data(), mesh.vertices.size(),
+                                                        sizeof(TestVertex), remap);
+    MeshOptimizer::RemapIndices(mesh.indices.data(), mesh.indices.size(), remap);
+    MeshOptimizer::RemapVertices(mesh.vertices, remap, welded);
+
+    // The grid of (stacks + 1) x (slices + 1) points; seam and pole copies differ in UV and stay apart
+    EXPECT_EQ(mesh.vertices.size(), 17u * 9u);
+    EXPECT_LT(mesh.vertices.size(), soupVertices);
+    EXPECT_EQ(Triangles(mesh), before);
+}
+
+TEST(MeshOptimizerTest, GridGetsBetterCacheReuse)
+{
+    TestMesh mesh = MakeGrid(64);
+    const auto triangles = Triangles(mesh);
+    const VertexCacheStats before = Analyze(mesh);
+
+    MeshOptimizer::Optimize(mesh.vertices, mesh.indices);
+    const VertexCacheStats after = Analyze(mesh);
+    Report("64x64 grid", before, after);
+
+    EXPECT_EQ(Triangles(mesh), triangles);
+    EXPECT_LT(after.acmr, before.acmr * 0.85f);
+    EXPECT_LT(after.atvr, before.atvr);
+    // Fetch order: every vertex is first used in order
+    uint32_t next = 0;
+    for (const uint32_t index : mesh.indices) {
+        ASSERT_LE(index, next);
+        if (index == next) ++next;
+    }
+    EXPECT_EQ(next, mesh.vertices.size());
+}
+
+TEST(MeshOptimizerTest, SoupIsWeldedAndReordered)
+{
+    TestMesh mesh = MakeSphereSoup(32, 16);
+    const auto triangles = Triangles(mesh);
+    const VertexCacheStats before = Analyze(mesh);
+
+    MeshOptimizer::Optimize(mesh.vertices, mesh.indices);
+    const VertexCacheStats after = Analyze(mesh);
+    Report("sphere soup", before, after);
+
+    EXPECT_EQ(Triangles(mesh), triangles);
+    EXPECT_FLOAT_EQ(before.acmr, 3.0f);
+    EXPECT_LT(after.acmr, 1.0f);
+    EXPECT_LT(after.atvr, 1.5f);
+}
+
+TEST(MeshOptimizerTest, OverdrawOrderKeepsTrianglesAndCacheReuse)
+{
+    TestMesh mesh = MakeSphereSoup(32, 16);
+    Weld(mesh);
+
+    std::vector<uint32_t> clusters;
+    MeshOptimizer::OptimizeVertexCache(mesh.indices.data(), mesh.indices.size(), mesh.vertices.size(), &clusters);
+    ASSERT_FALSE(clusters.empty());
+    EXPECT_EQ(clusters.front(), 0u);
+    EXPECT_TRUE(std::is_sorted(clusters.begin(), clusters.end()));
+    const auto triangles = Triangles(mesh);
+    const VertexCacheStats tipsify = Analyze(mesh);
+
+    MeshOptimizer::OptimizeOverdraw(mesh.indices.data(), mesh.indices.size(), &mesh.vertices[0].position.x,
+                                    mesh.vertices.size(), sizeof(TestVertex), clusters);
+    const VertexCacheStats sorted = Analyze(mesh);
+    Report("sphere, cache then overdraw order", tipsify, sorted);
+
+    EXPECT_EQ(Triangles(mesh), triangles);
+    // Clusters restart cold, so reuse may get worse, but only within the threshold
+    EXPECT_LE(sorted.acmr, tipsify.acmr * MeshOptimizer::kOverdrawThreshold);
+}
+
+TEST(MeshOptimizerTest, OverdrawOrderDrawsOccludersFirst)
+{
+    TestMesh mesh = MakeNestedSpheres(32, 16);
+    Weld(mesh);
+    std::vector<uint32_t> clusters;
+    MeshOptimizer::OptimizeVertexCache(mesh.indices.data(), mesh.indices.size(), mesh.vertices.size(), &clusters);
+    const auto triangles = Triangles(mesh);
+    const VertexCacheStats tipsify = Analyze(mesh);
+
+    const std::vector<glm::vec3> directions = {
+        {0.0f, 0.0f, -1.0f}, {0.0f, 0.0f, 1.0f}, {1.0f, 0.0f, 0.0f}, {-1.0f, 0.0f, 0.0f}, {0.0f, -1.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f, 1.0f}, {-1.0f, 0.5f, -2.0f}, {0.3f, -1.0f, 0.7f},
+    };
+    const float tipsifyOverdraw = MeasureOverdraw(mesh, directions);
+
+    MeshOptimizer::OptimizeOverdraw(mesh.indices.data(), mesh.indices.size(), &mesh.vertices[0].position.x,
+                                    mesh.vertices.size(), sizeof(TestVertex), clusters);
+    const VertexCacheStats sorted = Analyze(mesh);
+    const float sortedOverdraw = MeasureOverdraw(mesh, directions);
+    Report("nested spheres, cache then overdraw order", tipsify, sorted);
+    std::cout << "[MeshOptimizer] nested spheres: overdraw " << tipsifyOverdraw << " -> " << sortedOverdraw << std::endl;
+
+    EXPECT_EQ(Triangles(mesh), triangles);
+    EXPECT_LE(sorted.acmr, tipsify.acmr * MeshOptimizer::kOverdrawThreshold);
+    // Tipsify draws the hidden inner sphere (a quarter of the outer one's area) first;
+    // sorted, the outer one goes first and most of that extra shading is rejected
+    EXPECT_GT(tipsifyOverdraw, 1.2f);
+    EXPECT_LT(sortedOverdraw - 1.0f, (tipsifyOverdraw - 1.0f) * 0.25f);
+}
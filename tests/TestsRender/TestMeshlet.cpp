@@ -0,0 +1,221 @@
+#include <gtest/gtest.h>
+#include "Engine/Render/Mesh/Meshlet.h"
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <array>
+#include <iostream>
+#include <numbers>
+#include <random>
+#include <set>
+
+namespace {
+    struct TestVertex {
+        glm::vec3 position;
+        glm::vec3 normal;
+    };
+
+    struct TestMesh {
+        std::vector<TestVertex> vertices;
+        std::vector<uint32_t> indices;
+    };
+
+    // UV sphere with a duplicated seam column, like Primitives::CreateSphere
+    TestMesh MakeSphere(const int slices, const int stacks, const float radius) {
+        TestMesh mesh;
+        for (int i = 0; i <= stacks; ++i) {
+            const float phi = std::numbers::pi_v<float> * static_cast<float>(i) / static_cast<float>(stacks);
+            for (int j = 0; j <= slices; ++j) {
+                const float theta = 2.0f * std::numbers::pi_v<float> * static_cast<float>(j) / static_cast<float>(slices);
+                const glm::vec3 normal(std::sin(phi) * std::cos(theta), std::cos(phi), std::sin(phi) * std::sin(theta));
+                mesh.vertices.push_back({normal * radius, normal});
+            }
+        }
+        for (int i = 0; i < stacks; ++i) {
+            for (int j = 0; j < slices; ++j) {
+                const uint32_t a = i * (slices + 1) + j;
+                const uint32_t b = a + slices + 1;
+                mesh.indices.insert(mesh.indices.end(), {a, a + 1, b, b, a + 1, b + 1});
+            }
+        }
+        return mesh;
+    }
+
+    // What Mesh::Initialize hands to the meshlet build
+    TestMesh MakeOptimizedSphere(const int slices, const int stacks, const float radius) {
+        TestMesh mesh = MakeSphere(slices, stacks, radius);
+        MeshOptimizer::Optimize(mesh.vertices, mesh.indices);
+        return mesh;
+    }
+
+    void BuildMeshlets(const TestMesh& mesh, std::vector<uint32_t>& indices, std::vector<Meshlet>& meshlets) {
+        Meshlets::Build(&mesh.vertices[0].position.x, &mesh.vertices[0].normal.x, mesh.vertices.size(),
+                        sizeof(TestVertex), mesh.indices.data(), mesh.indices.size(), indices, meshlets);
+    }
+
+    std::multiset<std::array<uint32_t, 3>> Triangles(const std::vector<uint32_t>& indices) {
+        std::multiset<std::array<uint32_t, 3>> triangles;
+        for (size_t i = 0; i < indices.size(); i += 3) {
+            triangles.insert({indices[i], indices[i + 1], indices[i + 2]});
+        }
+        return triangles;
+    }
+
+    Math::Frustum MakeFrustum(const glm::vec3& eye, const glm::vec3& target) {
+        const glm::mat4 projection = glm::perspective(glm::radians(60.0f), 1.5f, 0.1f, 200.0f);
+        return Math::Frustum(projection * glm::lookAt(eye, target, glm::vec3(0.0f, 1.0f, 0.0f)));
+    }
+}
+
+TEST(MeshletTest, BuildKeepsEveryTriangleWithinLimits)
+{
+    const TestMesh sphere = MakeOptimizedSphere(64, 32, 1.0f);
+    std::vector<uint32_t> indices;
+    std::vector<Meshlet> meshlets;
+    BuildMeshlets(sphere, indices, meshlets);
+
+    EXPECT_EQ(Triangles(indices), Triangles(sphere.indices));
+
+    uint32_t nextOffset = 0;
+    for (const Meshlet& meshlet : meshlets) {
+        EXPECT_EQ(meshlet.indexOffset, nextOffset);
+        nextOffset += meshlet.indexCount;
+        EXPECT_LE(meshlet.indexCount / 3, Meshlets::kMaxTriangles);
+
+        std::set<uint32_t> vertices(indices.begin() + meshlet.indexOffset,
+                                    indices.begin() + meshlet.indexOffset + meshlet.indexCount);
+        EXPECT_LE(vertices.size(), Meshlets::kMaxVertices);
+    }
+    EXPECT_EQ(nextOffset, indices.size());
+    // Mostly full clusters, not a long tail of fragments; the order window caps a cluster first
+    EXPECT_LT(meshlets.size(), 2 * sphere.indices.size() / 3 / std::min(Meshlets::kMaxTriangles, Meshlets::kOrderWindow));
+}
+
+TEST(MeshletTest, BoundsContainTrianglesAndNormals)
+{
+    const TestMesh sphere = MakeOptimizedSphere(48, 24, 3.0f);
+    std::vector<uint32_t> indices;
+    std::vector<Meshlet> meshlets;
+    BuildMeshlets(sphere, indices, meshlets);
+
+    uint32_t narrowCones = 0;
+    for (const Meshlet& meshlet : meshlets) {
+        const float minDot = std::sqrt(1.0f - meshlet.coneCutoff * meshlet.coneCutoff);
+        narrowCones += meshlet.coneCutoff < 1.0f;
+        for (uint32_t i = meshlet.indexOffset; i < meshlet.indexOffset + meshlet.indexCount; i += 3) {
+            const glm::vec3 a = sphere.vertices[indices[i]].position;
+            const glm::vec3 b = sphere.vertices[indices[i + 1]].position;
+            const glm::vec3 c = sphere.vertices[indices[i + 2]].position;
+            for (const glm::vec3& p : {a, b, c}) {
+                EXPECT_LE(glm::length(p - meshlet.center), meshlet.radius + 1e-4f);
+            }
+
+            const glm::vec3 normal = glm::cross(b - a, c - a);
+            if (meshlet.coneCutoff < 1.0f && glm::length(normal) > 1e-6f) {
+                EXPECT_GE(glm::dot(glm::normalize(normal), meshlet.coneAxis), minDot - 1e-4f);
+            }
+        }
+    }
+    EXPECT_GT(narrowCones, meshlets.size() / 2);
+}
+
+TEST(MeshletTest, CullKeepsEveryFrontFacingTriangleInView)
+{
+    const TestMesh sphere = MakeOptimizedSphere(64, 32, 2.0f);
+    std::vector<uint32_t> indices;
+    std::vector<Meshlet> meshlets;
+    BuildMeshlets(sphere, indices, meshlets);
+
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> coordinate(-1.0f, 1.0f);
+    for (int view = 0; view < 20; ++view) {
+        const glm::vec3 eye = glm::normalize(glm::vec3(coordinate(rng), coordinate(rng), coordinate(rng))) * 6.0f;
+        const glm::vec3 target(coordinate(rng), coordinate(rng), coordinate(rng));
+        const Math::Frustum frustum = MakeFrustum(eye, target);
+
+        uint32_t culled = 0;
+        for (const Meshlet& meshlet : meshlets) {
+            if (Meshlets::IsVisible(meshlet, frustum, eye)) continue;
+            ++culled;
+
+            for (uint32_t i = meshlet.indexOffset; i < meshlet.indexOffset + meshlet.indexCount; i += 3) {
+                const glm::vec3 a = sphere.vertices[indices[i]].position;
+                const glm::vec3 b = sphere.vertices[indices[i + 1]].position;
+                const glm::vec3 c = sphere.vertices[indices[i + 2]].position;
+                const glm::vec3 normal = glm::cross(b - a, c - a);
+                if (glm::length(normal) <= 1e-6f) continue; // Pole slivers have no reliable winding
+                const bool frontFacing = glm::dot(normal, a - eye) < 0.0f;
+                EXPECT_FALSE(frontFacing && frustum.ContainsPoint((a + b + c) / 3.0f)) << "view " << view;
+            }
+        }
+        EXPECT_GT(culled, 0u); // At least the far side of the sphere
+    }
+}
+
+TEST(MeshletTest, BenchmarkTriangleReduction)
+{
+    // 8x8 grid of dense spheres seen from one corner of the grid
+    const TestMesh sphere = MakeOptimizedSphere(64, 32, 1.0f);
+    std::vector<uint32_t> indices;
+    std::vector<Meshlet> meshlets;
+    BuildMeshlets(sphere, indices, meshlets);
+    const auto sphereTriangles = static_cast<uint32_t>(indices.size() / 3);
+
+    const glm::vec3 eye(-4.0f, 3.0f, 4.0f);
+    const glm::mat4 projection = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 100.0f);
+    const glm::mat4 viewProjection = projection * glm::lookAt(eye, glm::vec3(12.0f, 0.0f, -12.0f),
+                                                              glm::vec3(0.0f, 1.0f, 0.0f));
+    const Math::Frustum worldFrustum(viewProjection);
+
+    uint32_t total = 0;
+    uint32_t objectCulled = 0; // Whole meshes that pass object-level frustum culling
+    MeshletStats stats;
+    std::vector<MeshletRange> ranges;
+    for (int x = 0; x < 8; ++x) {
+        for (int z = 0; z < 8; ++z) {
+            const glm::vec3 position(static_cast<float>(x) * 4.0f, 0.0f, -static_cast<float>(z) * 4.0f);
+            const glm::mat4 model = glm::translate(glm::mat4(1.0f), position);
+            total += sphereTriangles;
+            if (!worldFrustum.IntersectsSphere(position, 1.0f)) continue;
+            objectCulled += sphereTriangles;
+
+            // Same mesh-space culling as Mesh::Draw
+            ranges.clear();
+            const glm::vec3 localEye(glm::inverse(model) * glm::vec4(eye, 1.0f));
+            Meshlets::Cull(meshlets, Math::Frustum(viewProjection * model), localEye, ranges, stats);
+        }
+    }
+
+    std::cout << "[Meshlet] " << total << " triangles in 64 spheres: " << objectCulled
+              << " after object frustum culling, " << stats.visibleTriangles << " after meshlet culling ("
+              << stats.visibleMeshlets << "/" << stats.meshlets << " meshlets, " << stats.draws << " sub-draws)"
+              << std::endl;
+    RecordProperty("ObjectCulledTriangles", static_cast<int>(objectCulled));
+    RecordProperty("MeshletCulledTriangles", static_cast<int>(stats.visibleTriangles));
+    EXPECT_EQ(stats.triangles, objectCulled);
+    EXPECT_LT(stats.visibleTriangles, objectCulled * 3 / 4);
+    EXPECT_GT(stats.visibleTriangles, 0u);
+}
+
+TEST(MeshletTest, BuildKeepsTheOptimizedCacheOrder)
+{
+    // Primitives::CreateSphere's 32 segments, and a denser import-sized one
+    for (const int segments : {32, 64}) {
+        TestMesh sphere = MakeSphere(segments, segments, 1.0f);
+
+        // The same steps as Mesh::Initialize
+        MeshOptimizer::Optimize(sphere.vertices, sphere.indices);
+        const VertexCacheStats optimized = MeshOptimizer::AnalyzeVertexCache(
+            sphere.indices.data(), sphere.indices.size(), sphere.vertices.size());
+        ASSERT_GE(sphere.indices.size() / 3, 2 * Meshlets::kMaxTriangles);
+        std::vector<Meshlet> meshlets;
+        Meshlets::BuildInPlace(sphere.vertices, sphere.indices, meshlets);
+        const VertexCacheStats built = MeshOptimizer::AnalyzeVertexCache(
+            sphere.indices.data(), sphere.indices.size(), sphere.vertices.size());
+
+        std::cout << "[Meshlet] " << segments << "-segment sphere: ACMR " << optimized.acmr << " optimized, "
+                  << built.acmr << " after the meshlet build (" << meshlets.size() << " meshlets)" << std::endl;
+        ASSERT_FALSE(meshlets.empty());
+        EXPECT_EQ(meshlets.back().indexOffset + meshlets.back().indexCount, sphere.indices.size());
+        EXPECT_LE(built.acmr, optimized.acmr * MeshOptimizer::kOverdrawThreshold);
+    }
+}
@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+#include "Engine/Render/Culling/OcclusionCuller.h"
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <cmath>
+
+namespace {
+    // Camera at the origin looking down -Z
+    glm::mat4 MakeViewProjection() {
+        const glm::mat4 projection = glm::perspective(glm::radians(60.0f), 2.0f, 0.1f, 100.0f);
+        const glm::mat4 view = glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+        return projection * view;
+    }
+
+    // 2x2 quad in the XY plane, centered on the origin
+    const float kQuadPositions[] = {
+        -1.0f, -1.0f, 0.0f,
+         1.0f, -1.0f, 0.0f,
+         1.0f,  1.0f, 0.0f,
+        -1.0f,  1.0f, 0.0f,
+    };
+    const uint32_t kQuadIndices[] = {0, 1, 2, 2, 3, 0};
+
+    // Wall 10 units ahead, 10 units wide/high
+    void AddWall(OcclusionCuller& culler) {
+        const glm::mat4 model = glm::scale(glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.0f, -10.0f)),
+                                           glm::vec3(5.0f, 5.0f, 1.0f));
+        culler.AddOccluder(kQuadPositions, 4, 3 * sizeof(float), kQuadIndices, 6, model);
+    }
+}
+
+TEST(OcclusionCullerTest, EverythingVisibleWithoutOccluders)
+{
+    OcclusionCuller culler;
+    culler.BeginFrame(MakeViewProjection());
+    culler.Rasterize();
+
+    EXPECT_FALSE(culler.HasOccluders());
+    EXPECT_TRUE(culler.IsVisible(glm::vec3(0.0f, 0.0f, -30.0f), glm::vec3(1.0f)));
+}
+
+TEST(OcclusionCullerTest, WallHidesBoxBehindIt)
+{
+    OcclusionCuller culler;
+    culler.BeginFrame(MakeViewProjection());
+    AddWall(culler);
+    culler.Rasterize();
+
+    EXPECT_EQ(culler.GetStats().triangles, 2u);
+    // Behind the wall and inside its silhouette
+    EXPECT_FALSE(culler.IsVisible(glm::vec3(0.0f, 0.0f, -30.0f), glm::vec3(1.0f)));
+    // In front of the wall
+    EXPECT_TRUE(culler.IsVisible(glm::vec3(0.0f, 0.0f, -5.0f), glm::vec3(1.0f)));
+    // Behind the wall but sticking out to the side
+    EXPECT_TRUE(culler.IsVisible(glm::vec3(20.0f, 0.0f, -30.0f), glm::vec3(1.0f)));
+    // Straddling the wall
+    EXPECT_TRUE(culler.IsVisible(glm::vec3(0.0f, 0.0f, -10.0f), glm::vec3(1.0f)));
+    // Crossing the near plane
+    EXPECT_TRUE(culler.IsVisible(glm::vec3(0.0f), glm::vec3(1.0f)));
+}
+
+TEST(OcclusionCullerTest, OccluderClippedByNearPlane)
+{
+    OcclusionCuller culler;
+    culler.BeginFrame(MakeViewProjection());
+
+    // Floor-to-ceiling wall reaching from behind the camera to far ahead, on the left
+    const float positions[] = {
+        -2.0f, -50.0f,  10.0f,
+        -2.0f, -50.0f, -90.0f,
+        -2.0f,  50.0f, -90.0f,
+        -2.0f,  50.0f,  10.0f,
+    };
+    culler.AddOccluder(positions, 4, 3 * sizeof(float), kQuadIndices, 6, glm::mat4(1.0f));
+    culler.Rasterize();
+
+    EXPECT_GT(culler.GetStats().triangles, 2u);
+    // Room behind the left wall
+    EXPECT_FALSE(culler.IsVisible(glm::vec3(-10.0f, 0.0f, -20.0f), glm::vec3(1.0f)));
+    // Straight ahead
+    EXPECT_TRUE(culler.IsVisible(glm::vec3(0.0f, 0.0f, -20.0f), glm::vec3(1.0f)));
+}
+
+TEST(OcclusionCullerTest, CullKeepsOrderOfVisibleIndices)
+{
+    OcclusionCuller culler;
+    culler.BeginFrame(MakeViewProjection());
+    AddWall(culler);
+    culler.Rasterize();
+
+    Spatial::BoundsSoA bounds;
+    for (int i = 0; i < 1000; ++i) {
+        // Alternate hidden (behind the wall) and visible (beside it) boxes
+        const float x = (i % 2 == 0) ? 0.0f : 25.0f;
+        const glm::vec3 center(x, 0.0f, -20.0f - static_cast<float>(i % 10));
+        bounds.Add(Math::AABB(center - glm::vec3(0.5f), center + glm::vec3(0.5f)));
+    }
+
+    std::vector<uint32_t> visible;
+    for (uint32_t i = 0; i < bounds.Size(); ++i) {
+        visible.push_back(i);
+    }
+    culler.Cull(bounds, visible);
+
+    ASSERT_EQ(visible.size(), 500u);
+    for (size_t i = 0; i < visible.size(); ++i) {
+        EXPECT_EQ(visible[i], 2 * i + 1);
+    }
+    EXPECT_EQ(culler.GetStats().tested, 1000u);
+    EXPECT_EQ(culler.GetStats().occluded, 500u);
+}
+
+TEST(OcclusionCullerTest, FaceOnOccluderKeepsItsOwnBoundsVisible)
+{
+    // Interpolated depth across a face parallel to the screen may round just below the
+    // nearest corner of the occluder's box; the occluder must not hide itself
+    float cubePositions[8 * 3];
+    for (int i = 0; i < 8; ++i) {
+        cubePositions[i * 3] = (i & 1) ? 1.0f : -1.0f;
+        cubePositions[i * 3 + 1] = (i & 2) ? 1.0f : -1.0f;
+        cubePositions[i * 3 + 2] = (i & 4) ? 1.0f : -1.0f;
+    }
+    const uint32_t cubeIndices[] = {
+        0, 1, 3, 0, 3, 2,  4, 6, 7, 4, 7, 5,  0, 4, 5, 0, 5, 1,
+        2, 3, 7, 2, 7, 6,  0, 2, 6, 0, 6, 4,  1, 5, 7, 1, 7, 3,
+    };
+
+    const glm::mat4 projection = glm::perspective(glm::radians(60.0f), 2.0f, 0.1f, 100.0f);
+    int hiddenWalls = 0;
+    int hiddenBoxes = 0;
+    for (int i = 0; i < 2000; ++i) {
+        const float t = static_cast<float>(i);
+        const glm::vec3 eye(std::sin(t * 0.37f) * 3.0f, std::cos(t * 0.53f) * 3.0f, std::sin(t * 0.11f));
+        const glm::mat4 viewProjection =
+            projection * glm::lookAt(eye, eye + glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+        const glm::vec3 center(0.0f, 0.0f, -5.0f - std::fmod(t * 0.731f, 80.0f));
+
+        // 10x10 wall, flat in z, so its box has no depth
+        OcclusionCuller wall;
+        wall.BeginFrame(viewProjection);
+        wall.AddOccluder(kQuadPositions, 4, 3 * sizeof(float), kQuadIndices, 6,
+                         glm::scale(glm::translate(glm::mat4(1.0f), center), glm::vec3(5.0f, 5.0f, 1.0f)));
+        wall.Rasterize();
+        if (!wall.IsVisible(center, glm::vec3(5.0f, 5.0f, 0.0f))) ++hiddenWalls;
+
+        OcclusionCuller box;
+        box.BeginFrame(viewProjection);
+        box.AddOccluder(cubePositions, 8, 3 * sizeof(float), cubeIndices, 36,
+                        glm::scale(glm::translate(glm::mat4(1.0f), center), glm::vec3(2.0f)));
+        box.Rasterize();
+        if (!box.IsVisible(center, glm::vec3(2.0f))) ++hiddenBoxes;
+    }
+    EXPECT_EQ(hiddenWalls, 0);
+    EXPECT_EQ(hiddenBoxes, 0);
+}
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include "Engine/Render/Culling/PortalCuller.h"
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace {
+    // Room A (camera side), room B behind it along -Z, room C beside B along +X:
+    //
+    //   B | C      door A-B: x in [-1, 1] at z = -10
+    //   --+        door B-C: z in [-19, -18] at x = 5, in B's far corner
+    //   A
+    struct Rooms {
+        PortalCuller culler;
+        uint32_t a = 0;
+        uint32_t b = 0;
+        uint32_t c = 0;
+    };
+
+    void Build(Rooms& rooms) {
+        rooms.a = rooms.culler.AddCell(Math::AABB(glm::vec3(-5.0f, 0.0f, -10.0f), glm::vec3(5.0f, 4.0f, 0.0f)));
+        rooms.b = rooms.culler.AddCell(Math::AABB(glm::vec3(-5.0f, 0.0f, -20.0f), glm::vec3(5.0f, 4.0f, -10.0f)));
+        rooms.c = rooms.culler.AddCell(Math::AABB(glm::vec3(5.0f, 0.0f, -20.0f), glm::vec3(15.0f, 4.0f, -10.0f)));
+
+        const glm::vec3 doorAB[] = {
+            {-1.0f, 0.0f, -10.0f}, {1.0f, 0.0f, -10.0f}, {1.0f, 3.0f, -10.0f}, {-1.0f, 3.0f, -10.0f}};
+        const glm::vec3 doorBC[] = {
+            {5.0f, 0.0f, -19.0f}, {5.0f, 0.0f, -18.0f}, {5.0f, 3.0f, -18.0f}, {5.0f, 3.0f, -19.0f}};
+        rooms.culler.AddPortal(rooms.a, rooms.b, doorAB);
+        rooms.culler.AddPortal(rooms.b, rooms.c, doorBC);
+    }
+
+    void Look(PortalCuller& culler, const glm::vec3& eye, const glm::vec3& target) {
+        const glm::mat4 projection = glm::perspective(glm::radians(60.0f), 1.5f, 0.1f, 100.0f);
+        const glm::mat4 view = glm::lookAt(eye, target, glm::vec3(0.0f, 1.0f, 0.0f));
+        culler.ComputeVisibility(eye, Math::Frustum(projection * view));
+    }
+}
+
+TEST(PortalCullerTest, DoorOnlyRevealsRoomBehindIt)
+{
+    Rooms rooms;
+    Build(rooms);
+    Look(rooms.culler, glm::vec3(0.0f, 1.5f, -1.0f), glm::vec3(0.0f, 1.5f, -20.0f));
+
+    EXPECT_TRUE(rooms.culler.IsCellVisible(rooms.a));
+    EXPECT_TRUE(rooms.culler.IsCellVisible(rooms.b));
+    EXPECT_FALSE(rooms.culler.IsCellVisible(rooms.c)); // Its door is outside the narrow view through A-B
+    EXPECT_EQ(rooms.culler.GetStats().visibleCells, 2u);
+    EXPECT_EQ(rooms.culler.GetStats().portalsPassed, 1u);
+}
+
+TEST(PortalCullerTest, ChainOfDoorsRevealsThirdRoom)
+{
+    Rooms rooms;
+    Build(rooms);
+    // Lined up so the B-C door shows through the A-B door
+    Look(rooms.culler, glm::vec3(-4.0f, 1.5f, -2.0f), glm::vec3(5.0f, 1.5f, -18.5f));
+
+    EXPECT_TRUE(rooms.culler.IsCellVisible(rooms.b));
+    EXPECT_TRUE(rooms.culler.IsCellVisible(rooms.c));
+}
+
+TEST(PortalCullerTest, LookingAwayFromDoorSeesOnlyOwnRoom)
+{
+    Rooms rooms;
+    Build(rooms);
+    Look(rooms.culler, glm::vec3(0.0f, 1.5f, -5.0f), glm::vec3(0.0f, 1.5f, 10.0f));
+
+    EXPECT_TRUE(rooms.culler.IsCellVisible(rooms.a));
+    EXPECT_FALSE(rooms.culler.IsCellVisible(rooms.b));
+    EXPECT_FALSE(rooms.culler.IsCellVisible(rooms.c));
+}
+
+TEST(PortalCullerTest, EyeOutsideEveryCellSeesAllCells)
+{
+    Rooms rooms;
+    Build(rooms);
+    Look(rooms.culler, glm::vec3(0.0f, 50.0f, 10.0f), glm::vec3(0.0f, 0.0f, -10.0f));
+
+    EXPECT_EQ(rooms.culler.FindCell(glm::vec3(0.0f, 50.0f, 10.0f)), PortalCuller::kNoCell);
+    EXPECT_EQ(rooms.culler.GetStats().visibleCells, 3u);
+}
+
+TEST(PortalCullerTest, CullDropsOnlyObjectsInHiddenCells)
+{
+    Rooms rooms;
+    Build(rooms);
+    Look(rooms.culler, glm::vec3(0.0f, 1.5f, -1.0f), glm::vec3(0.0f, 1.5f, -20.0f));
+
+    Spatial::BoundsSoA bounds;
+    const glm::vec3 centers[] = {
+        {0.0f, 1.0f, -5.0f},   // A
+        {0.0f, 1.0f, -15.0f},  // B
+        {10.0f, 1.0f, -15.0f}, // C
+        {0.0f, 1.0f, 30.0f},   // Outside every cell
+    };
+    for (const glm::vec3& center : centers) {
+        bounds.Add(Math::AABB(center - glm::vec3(0.5f), center + glm::vec3(0.5f)));
+    }
+
+    std::vector<uint32_t> indices = {0, 1, 2, 3};
+    rooms.culler.Cull(bounds, indices);
+    EXPECT_EQ(indices, (std::vector<uint32_t>{0, 1, 3}));
+    EXPECT_EQ(rooms.culler.GetStats().culled, 1u);
+}
@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+#include "Engine/Render/View/RenderView.h"
+#include <glm/gtc/matrix_transform.hpp>
+
+TEST(RenderViewTest, SortGroupsByShaderThenFrontToBack)
+{
+    RenderView view;
+    view.Reset(glm::mat4(1.0f), glm::mat4(1.0f), 1);
+
+    // Only the addresses are used as keys
+    int shaders[2];
+    const auto* first = reinterpret_cast<const Shader*>(&shaders[0]);
+    const auto* second = reinterpret_cast<const Shader*>(&shaders[1]);
+    const struct { const Shader* shader; float depth; uint32_t id; } entries[] = {
+        {first, 10.0f, 1}, {second, 50.0f, 2}, {first, 2.0f, 3}, {second, 0.5f, 4}, {second, -1.0f, 5},
+    };
+    for (const auto& entry : entries) {
+        RenderItem item;
+        item.sortKey = view.MakeSortKey(RenderPass::Opaque, entry.shader, nullptr, nullptr, entry.depth);
+        item.objectId = entry.id;
+        view.Add(item);
+    }
+    view.Sort();
+
+    // Behind the eye counts as 0
+    std::vector<uint32_t> order;
+    for (const RenderItem& item : view.GetItems()) order.push_back(item.objectId);
+    EXPECT_EQ(order, (std::vector<uint32_t>{3, 1, 5, 4, 2}));
+}
+
+TEST(RenderViewTest, CurrentOnlyForSameFrameAndMatrices)
+{
+    const glm::mat4 viewMatrix = glm::lookAt(glm::vec3(1.0f, 2.0f, 3.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    const glm::mat4 projection = glm::perspective(glm::radians(60.0f), 1.5f, 0.1f, 100.0f);
+
+    RenderView view;
+    EXPECT_FALSE(view.IsCurrent(viewMatrix, projection, 0));
+
+    view.Reset(viewMatrix, projection, 4);
+    EXPECT_TRUE(view.IsCurrent(viewMatrix, projection, 4));
+    EXPECT_FALSE(view.IsCurrent(viewMatrix, projection, 5));
+    EXPECT_FALSE(view.IsCurrent(glm::mat4(1.0f), projection, 4));
+    EXPECT_NEAR(glm::length(view.GetEye() - glm::vec3(1.0f, 2.0f, 3.0f)), 0.0f, 1e-4f);
+
+    view.Invalidate();
+    EXPECT_FALSE(view.IsCurrent(viewMatrix, projection, 4));
+}
@@ -0,0 +1,30 @@
+#include <gtest/gtest.h>
+#include "Engine/Render/Shader/ShaderPermutation.h"
+
+TEST(ShaderPermutationTest, ParsesDeclaredKeywords)
+{
+    const std::string source =
+        "#version 330 core\n"
+        "#pragma shader_feature HAS_TEXTURE  SPECULAR\r\n"
+        "  #pragma shader_feature UNKNOWN_KEYWORD\n"
+        "#pragma optimize(on)\n"
+        "// #pragma shader_feature RECEIVE_SHADOWS\n"
+        "void main() {}\n";
+
+    EXPECT_EQ(ShaderPermutation::ParseKeywords(source), ShaderFeature::HasTexture | ShaderFeature::Specular);
+    EXPECT_EQ(ShaderPermutation::ParseKeywords("void main() {}"), ShaderFeature::None);
+    EXPECT_EQ(ShaderPermutation::ParseKeywords("#pragma shader_feature RECEIVE_SHADOWS"),
+              ShaderFeature::ReceiveShadows);
+}
+
+TEST(ShaderPermutationTest, FeaturesBecomeDefines)
+{
+    EXPECT_TRUE(ShaderPermutation::ToDefines(ShaderFeature::None).empty());
+
+    const std::vector<std::string> expected = {"HAS_TEXTURE", "RECEIVE_SHADOWS", "SPECULAR"};
+    EXPECT_EQ(ShaderPermutation::ToDefines(ShaderFeature::Specular | ShaderFeature::HasTexture |
+                                           ShaderFeature::ReceiveShadows), expected);
+
+    EXPECT_STREQ(ShaderPermutation::GetKeyword(ShaderFeature::Specular), "SPECULAR");
+    EXPECT_EQ(ShaderPermutation::GetKeyword(1u << 20), nullptr);
+}
@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+#include "Engine/Render/Shader/ShaderSource.h"
+#include <fstream>
+
+namespace {
+    std::filesystem::path MakeTempDirectory(const std::string& name) {
+        const std::filesystem::path directory = std::filesystem::temp_directory_path() / name;
+        std::filesystem::remove_all(directory);
+        return directory;
+    }
+}
+
+TEST(ShaderSourceTest, DefinesGoRightAfterVersion)
+{
+    const std::string source = "#version 330 core\nlayout (location = 0) in vec3 aPos;\n";
+    EXPECT_EQ(ShaderSource::InjectDefines(source, {"INSTANCED", "MAX_LIGHTS 4"}),
+              "#version 330 core\n#define INSTANCED\n#define MAX_LIGHTS 4\nlayout (location = 0) in vec3 aPos;\n");
+
+    EXPECT_EQ(ShaderSource::InjectDefines("void main() {}\n", {"A"}), "#define A\nvoid main() {}\n");
+    EXPECT_EQ(ShaderSource::InjectDefines(source, {}), source);
+}
+
+TEST(ShaderSourceTest, NormalizedDefinesIgnoreOrderAndDuplicates)
+{
+    EXPECT_EQ(ShaderSource::NormalizeDefines({"B", "A", "B"}), ShaderSource::NormalizeDefines({"A", "B"}));
+}
+
+TEST(ShaderSourceTest, HashChainsAndDiffers)
+{
+    EXPECT_EQ(ShaderSource::Hash("vertex"), ShaderSource::Hash("vertex"));
+    EXPECT_NE(ShaderSource::Hash("vertex"), ShaderSource::Hash("vertey"));
+    EXPECT_NE(ShaderSource::Hash("b", ShaderSource::Hash("a")), ShaderSource::Hash("a", ShaderSource::Hash("b")));
+}
+
+TEST(ShaderBinaryCacheTest, RoundTripAndRejectsMismatches)
+{
+    const std::filesystem::path directory = MakeTempDirectory("black_engine_shader_cache_test");
+    const uint64_t key = 0x1234abcd5678ef00ull;
+    const std::filesystem::path file = ShaderBinaryCache::GetPath(directory, key);
+
+    ShaderBinaryCache::Blob blob;
+    blob.format = 0x8741;
+    blob.data = {'p', 'r', 'o', 'g', 'r', 'a', 'm'};
+    ASSERT_TRUE(ShaderBinaryCache::Store(file, key, blob)); // Creates the directory
+    EXPECT_FALSE(std::filesystem::exists(file.string() + ".tmp"));
+
+    ShaderBinaryCache::Blob loaded;
+    ASSERT_TRUE(ShaderBinaryCache::Load(file, key, loaded));
+    EXPECT_EQ(loaded.format, blob.format);
+    EXPECT_EQ(loaded.data, blob.data);
+
+    // Another key in the same file (a hash collision or a renamed file) is a miss
+    EXPECT_FALSE(ShaderBinaryCache::Load(file, key + 1, loaded));
+    EXPECT_FALSE(ShaderBinaryCache::Load(directory / "missing.bin", key, loaded));
+
+    // Truncated and padded files are misses too
+    const auto size = std::filesystem::file_size(file);
+    std::filesystem::resize_file(file, size - 1);
+    EXPECT_FALSE(ShaderBinaryCache::Load(file, key, loaded));
+    std::filesystem::resize_file(file, size + 1);
+    EXPECT_FALSE(ShaderBinaryCache::Load(file, key, loaded));
+
+    std::filesystem::remove_all(directory);
+}
@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+#include "Engine/Render/Culling/ShadowCasterCuller.h"
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace {
+    const glm::vec3 kLightDirection(0.0f, -1.0f, 0.0f); // Straight down
+
+    // Camera at the origin looking down -Z, seeing up to 50 units
+    Math::Frustum MakeCameraFrustum() {
+        const glm::mat4 projection = glm::perspective(glm::radians(60.0f), 1.5f, 0.1f, 50.0f);
+        const glm::mat4 view = glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+        return Math::Frustum(projection * view);
+    }
+
+    // Orthographic shadow volume 120 units across, looking down from y = 100
+    Math::Frustum MakeLightFrustum() {
+        const glm::mat4 projection = glm::ortho(-60.0f, 60.0f, -60.0f, 60.0f, 0.1f, 200.0f);
+        const glm::mat4 view = glm::lookAt(glm::vec3(0.0f, 100.0f, 0.0f), glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f));
+        return Math::Frustum(projection * view);
+    }
+
+    Math::AABB MakeBox(const glm::vec3& center) {
+        return Math::AABB(center - glm::vec3(1.0f), center + glm::vec3(1.0f));
+    }
+}
+
+TEST(ShadowCasterCullerTest, KeepsOnlyCastersWhoseShadowCanBeSeen)
+{
+    Spatial::BoundsSoA bounds;
+    bounds.Add(MakeBox(glm::vec3(0.0f, 0.0f, -20.0f)));   // 0: in view, trivially a caster
+    bounds.Add(MakeBox(glm::vec3(200.0f, 0.0f, -20.0f))); // 1: outside the light frustum
+    bounds.Add(MakeBox(glm::vec3(0.0f, 30.0f, -20.0f)));  // 2: above the view, its shadow falls into it
+    bounds.Add(MakeBox(glm::vec3(0.0f, 30.0f, 20.0f)));   // 3: behind the camera, its shadow stays there
+
+    const Math::Frustum cameraFrustum = MakeCameraFrustum();
+    ASSERT_FALSE(cameraFrustum.IntersectsAABB(MakeBox(glm::vec3(0.0f, 30.0f, -20.0f))));
+
+    ShadowCasterCuller culler;
+    std::vector<uint32_t> casters;
+    culler.Cull(bounds, MakeLightFrustum(), cameraFrustum, kLightDirection, 100.0f, casters);
+
+    EXPECT_EQ(casters, (std::vector<uint32_t>{0, 2}));
+    EXPECT_EQ(culler.GetStats().total, 4u);
+    EXPECT_EQ(culler.GetStats().inLightFrustum, 3u);
+    EXPECT_EQ(culler.GetStats().casters, 2u);
+}
+
+TEST(ShadowCasterCullerTest, ShortShadowDoesNotReachTheView)
+{
+    Spatial::BoundsSoA bounds;
+    bounds.Add(MakeBox(glm::vec3(0.0f, 30.0f, -20.0f)));
+
+    ShadowCasterCuller culler;
+    std::vector<uint32_t> casters;
+    // At z = -20 the view reaches about 11.5 units up; 5 units of shadow stop well above that
+    culler.Cull(bounds, MakeLightFrustum(), MakeCameraFrustum(), kLightDirection, 5.0f, casters);
+    EXPECT_TRUE(casters.empty());
+    EXPECT_EQ(culler.GetStats().inLightFrustum, 1u);
+}
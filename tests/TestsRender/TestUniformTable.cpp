@@ -0,0 +1,39 @@
+#include <gtest/gtest.h>
+#include "Engine/Render/Shader/UniformTable.h"
+
+TEST(UniformTableTest, FindsReflectedUniforms)
+{
+    UniformTable table;
+    table.Add("model", {3, 0x8B5C, 1});
+    table.Add("camPos", {7, 0x8B51, 1});
+
+    const UniformInfo* model = table.Find("model");
+    ASSERT_NE(model, nullptr);
+    EXPECT_EQ(model->location, 3);
+    EXPECT_EQ(model->type, 0x8B5Cu);
+    EXPECT_EQ(table.Find(std::string("camPos"))->location, 7);
+    EXPECT_EQ(table.GetCount(), 2u);
+}
+
+TEST(UniformTableTest, ArraysAnswerToBaseName)
+{
+    UniformTable table;
+    table.Add("lights[0]", {5, 0x8B51, 4});
+
+    ASSERT_NE(table.Find("lights"), nullptr);
+    EXPECT_EQ(table.Find("lights")->location, 5);
+    EXPECT_EQ(table.Find("lights")->size, 4);
+    EXPECT_EQ(table.Find("lights[0]")->location, 5);
+}
+
+TEST(UniformTableTest, MissingNamesAndClear)
+{
+    UniformTable table;
+    table.Add("view", {1, 0x8B5C, 1});
+    EXPECT_EQ(table.Find("projection"), nullptr);
+    EXPECT_EQ(table.Find("vie"), nullptr);
+
+    table.Clear();
+    EXPECT_EQ(table.Find("view"), nullptr);
+    EXPECT_EQ(table.GetCount(), 0u);
+}
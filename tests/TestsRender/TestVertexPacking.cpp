@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include "Engine/Render/Mesh/VertexPacking.h"
+#include <cmath>
+#include <cstring>
+#include <numbers>
+
+namespace {
+    struct TestVertex {
+        glm::vec3 position;
+        glm::vec3 normal;
+        glm::vec2 texCoords;
+    };
+
+    float SnormToFloat(const int16_t value) { return std::max(static_cast<float>(value) / 32767.0f, -1.0f); }
+}
+
+TEST(VertexPackingTest, OctahedralNormalsRoundTripBothHemispheres)
+{
+    float worst = 1.0f;
+    for (int i = 0; i <= 32; ++i) {
+        const float phi = std::numbers::pi_v<float> * static_cast<float>(i) / 32.0f;
+        for (int j = 0; j < 64; ++j) {
+            const float theta = 2.0f * std::numbers::pi_v<float> * static_cast<float>(j) / 64.0f;
+            const glm::vec3 normal(std::sin(phi) * std::cos(theta), std::sin(phi) * std::sin(theta), std::cos(phi));
+
+            const glm::vec2 encoded = VertexPacking::OctEncode(normal);
+            EXPECT_LE(std::abs(encoded.x), 1.0f);
+            EXPECT_LE(std::abs(encoded.y), 1.0f);
+            // Through snorm16 like the GPU sees it
+            const glm::vec2 stored(SnormToFloat(static_cast<int16_t>(std::lround(encoded.x * 32767.0f))),
+                                   SnormToFloat(static_cast<int16_t>(std::lround(encoded.y * 32767.0f))));
+            worst = std::min(worst, glm::dot(VertexPacking::OctDecode(stored), normal));
+        }
+    }
+    // Within about a tenth of a degree (float dot products cannot resolve much less)
+    EXPECT_GT(worst, 0.999999f);
+}
+
+TEST(VertexPackingTest, HalfFloatsRoundTrip)
+{
+    for (const float exact : {0.0f, 1.0f, -2.5f, 0.5f, 65504.0f, 0.000060975552f, 5.9604645e-8f}) {
+        EXPECT_EQ(VertexPacking::FromHalf(VertexPacking::ToHalf(exact)), exact) << exact;
+    }
+    EXPECT_TRUE(std::isinf(VertexPacking::FromHalf(VertexPacking::ToHalf(1.0e6f))));
+    EXPECT_EQ(VertexPacking::FromHalf(VertexPacking::ToHalf(1.0e-9f)), 0.0f);
+    // Texture coordinates keep three decimal digits in [0, 1]
+    for (int i = 0; i <= 1000; ++i) {
+        const float uv = static_cast<float>(i) / 1000.0f;
+        EXPECT_NEAR(VertexPacking::FromHalf(VertexPacking::ToHalf(uv)), uv, 0.5f / 2048.0f);
+    }
+}
+
+TEST(VertexPackingTest, QuantizedPositionsDecodeThroughTheModelMatrix)
+{
+    const glm::vec3 boundsMin(-2.0f, 0.0f, 10.0f);
+    const glm::vec3 boundsMax(3.0f, 0.0f, 14.0f); // Flat in y
+    const std::vector<TestVertex> vertices = {
+        {{-2.0f, 0.0f, 10.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, 0.0f}},
+        {{3.0f, 0.0f, 14.0f}, {0.0f, 1.0f, 0.0f}, {1.0f, 1.0f}},
+        {{0.123f, 0.0f, 12.5f}, {0.0f, 0.0f, -1.0f}, {0.25f, 0.75f}},
+    };
+    std::vector<uint8_t> packed;
+    VertexPacking::Pack(VertexFormat::Quantized, &vertices[0].position.x, &vertices[0].normal.x,
+                        &vertices[0].texCoords.x, vertices.size(), sizeof(TestVertex), boundsMin, boundsMax, packed);
+    ASSERT_EQ(packed.size(), vertices.size() * sizeof(QuantizedVertex));
+
+    const glm::mat4 decode = VertexPacking::PositionDecode(VertexFormat::Quantized, boundsMin, boundsMax);
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        QuantizedVertex vertex;
+        std::memcpy(&vertex, packed.data() + i * sizeof(QuantizedVertex), sizeof(vertex));
+        const glm::vec4 normalized(vertex.position[0] / 65535.0f, vertex.position[1] / 65535.0f,
+                                   vertex.position[2] / 65535.0f, 1.0f);
+        const glm::vec3 position(decode * normalized);
+        EXPECT_NEAR(position.x, vertices[i].position.x, 5.0f / 65535.0f);
+        EXPECT_FLOAT_EQ(position.y, 0.0f);
+        EXPECT_NEAR(position.z, vertices[i].position.z, 4.0f / 65535.0f);
+
+        const glm::vec3 normal = VertexPacking::OctDecode({SnormToFloat(vertex.normal[0]), SnormToFloat(vertex.normal[1])});
+        EXPECT_GT(glm::dot(normal, vertices[i].normal), 0.9999f);
+        EXPECT_NEAR(VertexPacking::FromHalf(vertex.texCoords[1]), vertices[i].texCoords.y, 1.0e-3f);
+    }
+
+    // Compact keeps float positions: nothing to decode
+    EXPECT_EQ(VertexPacking::PositionDecode(VertexFormat::Compact, boundsMin, boundsMax), glm::mat4(1.0f));
+}
+
+TEST(VertexPackingTest, ShortIndicesUpTo64KVertices)
+{
+    EXPECT_TRUE(VertexPacking::UsesShortIndices(65536));
+    EXPECT_FALSE(VertexPacking::UsesShortIndices(65537));
+
+    const std::vector<uint32_t> indices = {0, 1, 65535, 42};
+    std::vector<uint16_t> narrowed;
+    VertexPacking::NarrowIndices(indices.data(), indices.size(), narrowed);
+    ASSERT_EQ(narrowed.size(), indices.size());
+    for (size_t i = 0; i < indices.size(); ++i) EXPECT_EQ(narrowed[i], indices[i]);
+
+    // Quantized vertex plus 16-bit index is half of a float vertex plus 32-bit index
+    EXPECT_EQ(VertexPacking::Stride(VertexFormat::Quantized) * 2, sizeof(TestVertex));
+    EXPECT_EQ(VertexPacking::Stride(VertexFormat::Compact), 20u);
+}
@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+#include "Engine/Spatial/Bvh.h"
+#include "Engine/Spatial/MeshRaycast.h"
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <random>
+
+namespace {
+    // Random boxes, reordered the way a Bvh owner has to after Build
+    Spatial::BoundsSoA MakeOrderedBounds(const size_t count, std::mt19937& rng, Spatial::Bvh& bvh) {
+        std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+        std::uniform_real_distribution<float> size(0.2f, 3.0f);
+        std::vector<Math::AABB> boxes(count);
+        Spatial::BoundsSoA bounds;
+        for (Math::AABB& box : boxes) {
+            const glm::vec3 center(position(rng), position(rng), position(rng));
+            const glm::vec3 extents(size(rng), size(rng), size(rng));
+            box = Math::AABB(center - extents, center + extents);
+            bounds.Add(box);
+        }
+
+        std::vector<uint32_t> order;
+        bvh.Build(bounds, 0, static_cast<uint32_t>(count), order);
+        for (uint32_t i = 0; i < count; ++i) {
+            bounds.Set(i, boxes[order[i]]);
+        }
+        return bounds;
+    }
+
+    Math::Frustum MakeFrustum(const glm::vec3& eye, const glm::vec3& target) {
+        const glm::mat4 projection = glm::perspective(glm::radians(60.0f), 1.5f, 0.1f, 150.0f);
+        return Math::Frustum(projection * glm::lookAt(eye, target, glm::vec3(0.0f, 1.0f, 0.0f)));
+    }
+}
+
+TEST(BvhTest, FrustumCullMatchesLinearCull)
+{
+    std::mt19937 rng(11);
+    Spatial::Bvh bvh;
+    const Spatial::BoundsSoA bounds = MakeOrderedBounds(5000, rng, bvh);
+
+    const Math::Frustum frustums[] = {
+        MakeFrustum(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f)),
+        MakeFrustum(glm::vec3(-150.0f, 20.0f, 0.0f), glm::vec3(0.0f)),
+        MakeFrustum(glm::vec3(0.0f, 300.0f, 0.0f), glm::vec3(0.0f, 400.0f, 0.0f)), // Looking away
+    };
+    for (const Math::Frustum& frustum : frustums) {
+        std::vector<uint32_t> expected;
+        bounds.CullFrustum(frustum, 0, static_cast<uint32_t>(bounds.Size()), expected);
+
+        std::vector<uint32_t> visible;
+        bvh.CullFrustum(bounds, frustum, visible);
+        EXPECT_EQ(visible, expected); // Same slots, same ascending order
+    }
+}
+
+TEST(BvhTest, RefitFollowsMovedBoxes)
+{
+    std::mt19937 rng(5);
+    Spatial::Bvh bvh;
+    Spatial::BoundsSoA bounds = MakeOrderedBounds(2000, rng, bvh);
+
+    // Drift every box; the topology stays, so the tree gets looser
+    std::uniform_real_distribution<float> offset(-20.0f, 20.0f);
+    for (uint32_t i = 0; i < bounds.Size(); ++i) {
+        const glm::vec3 center = bounds.GetCenter(i) + glm::vec3(offset(rng), offset(rng), offset(rng));
+        const glm::vec3 extents = bounds.GetExtents(i);
+        bounds.Set(i, Math::AABB(center - extents, center + extents));
+    }
+    bvh.Refit(bounds);
+    EXPECT_GT(bvh.GetCost(), bvh.GetBuildCost());
+
+    const Math::Frustum frustum = MakeFrustum(glm::vec3(10.0f, 0.0f, 50.0f), glm::vec3(0.0f));
+    std::vector<uint32_t> expected;
+    bounds.CullFrustum(frustum, 0, static_cast<uint32_t>(bounds.Size()), expected);
+    std::vector<uint32_t> visible;
+    bvh.CullFrustum(bounds, frustum, visible);
+    EXPECT_EQ(visible, expected);
+}
+
+TEST(BvhTest, RayQueryReturnsEveryHitBox)
+{
+    std::mt19937 rng(9);
+    Spatial::Bvh bvh;
+    const Spatial::BoundsSoA bounds = MakeOrderedBounds(3000, rng, bvh);
+
+    std::uniform_real_distribution<float> coordinate(-1.0f, 1.0f);
+    for (int r = 0; r < 50; ++r) {
+        const Math::Ray ray(glm::vec3(coordinate(rng), coordinate(rng), coordinate(rng)) * 120.0f,
+                            glm::vec3(coordinate(rng), coordinate(rng), coordinate(rng)));
+        const float maxDistance = r % 2 == 0 ? 80.0f : 1000.0f;
+
+        std::vector<uint32_t> candidates;
+        bvh.QueryRay(ray, maxDistance, candidates);
+        EXPECT_TRUE(std::is_sorted(candidates.begin(), candidates.end()));
+
+        for (uint32_t i = 0; i < bounds.Size(); ++i) {
+            const Math::AABB box = bounds.GetAABB(i);
+            float distance = 0.0f;
+            glm::vec3 normal;
+            if (Spatial::RaycastAABB(ray, box.GetMin(), box.GetMax(), maxDistance, distance, normal)) {
+                EXPECT_TRUE(std::binary_search(candidates.begin(), candidates.end(), i)) << "ray " << r << " box " << i;
+            }
+        }
+        // Leaves only narrow things down if they are small
+        EXPECT_LT(candidates.size(), bounds.Size() / 4);
+    }
+}
+
+TEST(BvhTest, SubrangeEmitsAbsoluteSlots)
+{
+    // Three boxes in front of the camera, built as slots [10, 13) of a larger array
+    Spatial::BoundsSoA bounds;
+    for (int i = 0; i < 10; ++i) bounds.Add(Math::AABB(glm::vec3(500.0f), glm::vec3(501.0f)));
+    for (int i = 0; i < 3; ++i) {
+        const glm::vec3 center(static_cast<float>(i) * 3.0f, 0.0f, -10.0f);
+        bounds.Add(Math::AABB(center - glm::vec3(1.0f), center + glm::vec3(1.0f)));
+    }
+
+    Spatial::Bvh bvh;
+    std::vector<uint32_t> order;
+    bvh.Build(bounds, 10, 13, order);
+    ASSERT_EQ(order.size(), 3u);
+
+    std::vector<uint32_t> visible;
+    bvh.CullFrustum(bounds, MakeFrustum(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f)), visible);
+    EXPECT_EQ(visible, (std::vector<uint32_t>{10, 11, 12}));
+}
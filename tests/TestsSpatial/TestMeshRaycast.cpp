@@ -0,0 +1,50 @@
+#include <gtest/gtest.h>
+#include "Engine/Spatial/MeshRaycast.h"
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace {
+    // Unit quad in the XY plane facing +Z, two triangles
+    constexpr float kQuadPositions[] = {
+        -0.5f, -0.5f, 0.0f,
+         0.5f, -0.5f, 0.0f,
+         0.5f,  0.5f, 0.0f,
+        -0.5f,  0.5f, 0.0f,
+    };
+    constexpr uint32_t kQuadIndices[] = {0, 1, 2, 0, 2, 3};
+}
+
+TEST(MeshRaycastTest, HitsScaledMeshWithWorldDistanceAndNormal)
+{
+    // Quad moved to z = -10 and stretched 4x along X
+    const glm::mat4 model = glm::scale(glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.0f, -10.0f)),
+                                       glm::vec3(4.0f, 1.0f, 1.0f));
+    const Math::Ray ray(glm::vec3(1.5f, 0.2f, 0.0f), glm::vec3(0.0f, 0.0f, -1.0f));
+
+    Spatial::MeshRayHit hit;
+    ASSERT_TRUE(Spatial::RaycastTriangles(ray, model, kQuadPositions, 4, 3 * sizeof(float),
+                                          kQuadIndices, 6, 100.0f, hit));
+    EXPECT_NEAR(hit.distance, 10.0f, 1e-4f);
+    EXPECT_NEAR(hit.point.x, 1.5f, 1e-4f);
+    EXPECT_NEAR(hit.point.z, -10.0f, 1e-4f);
+    EXPECT_NEAR(hit.normal.z, 1.0f, 1e-4f);
+    EXPECT_EQ(hit.triangleIndex, 0); // x > y in quad space, lower-right triangle
+
+    // Beyond the stretched edge, and beyond the distance limit
+    EXPECT_FALSE(Spatial::RaycastTriangles(Math::Ray(glm::vec3(2.5f, 0.0f, 0.0f), glm::vec3(0.0f, 0.0f, -1.0f)),
+                                           model, kQuadPositions, 4, 3 * sizeof(float), kQuadIndices, 6, 100.0f, hit));
+    EXPECT_FALSE(Spatial::RaycastTriangles(ray, model, kQuadPositions, 4, 3 * sizeof(float),
+                                           kQuadIndices, 6, 5.0f, hit));
+}
+
+TEST(MeshRaycastTest, BoxHitReportsEntryFace)
+{
+    const Math::Ray ray(glm::vec3(-10.0f, 0.0f, 0.0f), glm::vec3(1.0f, 0.0f, 0.0f));
+    float distance = 0.0f;
+    glm::vec3 normal(0.0f);
+
+    ASSERT_TRUE(Spatial::RaycastAABB(ray, glm::vec3(-1.0f), glm::vec3(1.0f), 100.0f, distance, normal));
+    EXPECT_FLOAT_EQ(distance, 9.0f);
+    EXPECT_EQ(normal, glm::vec3(-1.0f, 0.0f, 0.0f));
+
+    EXPECT_FALSE(Spatial::RaycastAABB(ray, glm::vec3(-1.0f), glm::vec3(1.0f), 8.0f, distance, normal));
+}
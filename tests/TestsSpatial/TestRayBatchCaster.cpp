@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+#include "Engine/Spatial/RayBatchCaster.h"
+#include <chrono>
+#include <iostream>
+#include <random>
+
+namespace {
+    void FillRandomBoxes(Spatial::BoundsSoA& bounds, const size_t count, std::mt19937& rng) {
+        std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+        std::uniform_real_distribution<float> size(0.2f, 3.0f);
+        for (size_t i = 0; i < count; ++i) {
+            const glm::vec3 center(position(rng), position(rng), position(rng));
+            const glm::vec3 extents(size(rng), size(rng), size(rng));
+            bounds.Add(Math::AABB(center - extents, center + extents));
+        }
+    }
+
+    std::vector<Math::Ray> MakeRandomRays(const size_t count, std::mt19937& rng) {
+        std::uniform_real_distribution<float> position(-120.0f, 120.0f);
+        std::uniform_real_distribution<float> direction(-1.0f, 1.0f);
+        std::vector<Math::Ray> rays;
+        rays.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            glm::vec3 d(direction(rng), direction(rng), direction(rng));
+            if (glm::length(d) < 1e-3f) d = glm::vec3(0.0f, 0.0f, -1.0f);
+            rays.emplace_back(glm::vec3(position(rng), position(rng), position(rng)), d);
+        }
+        return rays;
+    }
+}
+
+TEST(RayBatchCasterTest, MatchesSingleRayPicking)
+{
+    std::mt19937 rng(7);
+    Spatial::BoundsSoA bounds;
+    FillRandomBoxes(bounds, 2000, rng);
+    std::vector<Math::Ray> rays = MakeRandomRays(1001, rng);
+    // Axis-parallel rays take the zero-direction path of the slab test
+    rays.emplace_back(glm::vec3(0.0f), glm::vec3(1.0f, 0.0f, 0.0f));
+    rays.emplace_back(glm::vec3(0.0f), glm::vec3(0.0f, -1.0f, 0.0f));
+
+    Spatial::RayBatchCaster caster;
+    std::vector<Spatial::RayBatchHit> hits;
+    caster.CastClosest(bounds, rays, hits);
+    ASSERT_EQ(hits.size(), rays.size());
+
+    size_t hitCount = 0;
+    for (size_t r = 0; r < rays.size(); ++r) {
+        float closest = std::numeric_limits<float>::max();
+        uint32_t closestIndex = Spatial::RayBatchHit::kNoHit;
+        for (uint32_t i = 0; i < bounds.Size(); ++i) {
+            float t = 0.0f;
+            if (bounds.GetAABB(i).IntersectsRay(rays[r], t) && t < closest) {
+                closest = t;
+                closestIndex = i;
+            }
+        }
+
+        ASSERT_EQ(hits[r].IsHit(), closestIndex != Spatial::RayBatchHit::kNoHit) << "ray " << r;
+        if (hits[r].IsHit()) {
+            ++hitCount;
+            EXPECT_NEAR(hits[r].distance, closest, 1e-3f) << "ray " << r;
+        }
+    }
+    EXPECT_GT(hitCount, 0u);
+}
+
+TEST(RayBatchCasterTest, Throughput)
+{
+    std::mt19937 rng(11);
+    Spatial::BoundsSoA bounds;
+    FillRandomBoxes(bounds, 10000, rng);
+    const std::vector<Math::Ray> rays = MakeRandomRays(8192, rng);
+
+    Spatial::RayBatchCaster caster;
+    std::vector<Spatial::RayBatchHit> hits;
+    caster.CastClosest(bounds, rays, hits); // Warm up the worker threads
+
+    const auto start = std::chrono::steady_clock::now();
+    caster.CastClosest(bounds, rays, hits);
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    const double raysPerSecond = static_cast<double>(rays.size()) / std::max(seconds, 1e-9);
+    std::cout << "[RayBatchCaster] " << rays.size() << " rays x " << bounds.Size() << " boxes: "
+              << seconds * 1000.0 << " ms, " << raysPerSecond << " rays/s" << std::endl;
+    RecordProperty("RaysPerSecond", static_cast<int>(raysPerSecond));
+    EXPECT_EQ(hits.size(), rays.size());
+}
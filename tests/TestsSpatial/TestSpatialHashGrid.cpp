@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+#include "Engine/Spatial/SpatialHashGrid.h"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+
+namespace {
+    struct Body {
+        glm::vec3 center;
+        glm::vec3 extents;
+        glm::vec3 velocity;
+
+        [[nodiscard]] Math::AABB GetAABB() const { return {center - extents, center + extents}; }
+    };
+
+    std::vector<Body> MakeBodies(const size_t count, std::mt19937& rng) {
+        std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+        std::uniform_real_distribution<float> size(0.1f, 0.8f);
+        std::uniform_real_distribution<float> speed(-5.0f, 5.0f);
+        std::vector<Body> bodies(count);
+        for (Body& body : bodies) {
+            body.center = glm::vec3(position(rng), position(rng), position(rng));
+            body.extents = glm::vec3(size(rng), size(rng), size(rng));
+            body.velocity = glm::vec3(speed(rng), speed(rng), speed(rng));
+        }
+        // A couple of large boxes take the oversized path
+        bodies[0].extents = glm::vec3(30.0f);
+        bodies[1].extents = glm::vec3(12.0f, 0.5f, 12.0f);
+        return bodies;
+    }
+
+    float DistanceSquared(const glm::vec3& point, const Math::AABB& aabb) {
+        const glm::vec3 delta = glm::max(glm::max(aabb.GetMin() - point, point - aabb.GetMax()), glm::vec3(0.0f));
+        return glm::dot(delta, delta);
+    }
+
+    std::vector<uint32_t> BruteForceRadius(const std::vector<Body>& bodies, const glm::vec3& center, const float radius) {
+        std::vector<uint32_t> ids;
+        for (uint32_t i = 0; i < bodies.size(); ++i) {
+            if (DistanceSquared(center, bodies[i].GetAABB()) <= radius * radius) ids.push_back(i);
+        }
+        return ids;
+    }
+
+    void StepBodies(std::vector<Body>& bodies, const float dt) {
+        for (Body& body : bodies) {
+            body.center += body.velocity * dt;
+        }
+    }
+}
+
+TEST(SpatialHashGridTest, QueriesMatchBruteForceWhileObjectsMove)
+{
+    std::mt19937 rng(3);
+    std::vector<Body> bodies = MakeBodies(3000, rng);
+    Spatial::SpatialHashGrid grid(2.0f);
+    for (uint32_t i = 0; i < bodies.size(); ++i) grid.Set(i, bodies[i].GetAABB());
+
+    std::uniform_real_distribution<float> position(-110.0f, 110.0f);
+    std::vector<uint32_t> ids;
+    std::vector<Spatial::SpatialHit> nearest;
+
+    for (int frame = 0; frame < 5; ++frame) {
+        StepBodies(bodies, 0.1f);
+        for (uint32_t i = 0; i < bodies.size(); ++i) grid.Set(i, bodies[i].GetAABB());
+
+        for (int q = 0; q < 50; ++q) {
+            const glm::vec3 point(position(rng), position(rng), position(rng));
+
+            grid.QueryRadius(point, 9.0f, ids);
+            std::sort(ids.begin(), ids.end());
+            ASSERT_EQ(ids, BruteForceRadius(bodies, point, 9.0f));
+
+            const Math::AABB box(point - glm::vec3(6.0f, 2.0f, 4.0f), point + glm::vec3(6.0f, 2.0f, 4.0f));
+            grid.QueryAABB(box, ids);
+            std::sort(ids.begin(), ids.end());
+            std::vector<uint32_t> expected;
+            for (uint32_t i = 0; i < bodies.size(); ++i) {
+                const Math::AABB aabb = bodies[i].GetAABB();
+                if (glm::all(glm::lessThanEqual(aabb.GetMin(), box.GetMax())) &&
+                    glm::all(glm::greaterThanEqual(aabb.GetMax(), box.GetMin()))) {
+                    expected.push_back(i);
+                }
+            }
+            ASSERT_EQ(ids, expected);
+
+            grid.QueryNearest(point, 8, nearest);
+            std::vector<Spatial::SpatialHit> all;
+            for (uint32_t i = 0; i < bodies.size(); ++i) all.push_back({i, DistanceSquared(point, bodies[i].GetAABB())});
+            std::sort(all.begin(), all.end(), [](const Spatial::SpatialHit& a, const Spatial::SpatialHit& b) {
+                return a.distanceSquared < b.distanceSquared || (a.distanceSquared == b.distanceSquared && a.id < b.id);
+            });
+            ASSERT_EQ(nearest.size(), 8u);
+            for (size_t n = 0; n < nearest.size(); ++n) {
+                EXPECT_EQ(nearest[n].id, all[n].id);
+                EXPECT_FLOAT_EQ(nearest[n].distanceSquared, all[n].distanceSquared);
+            }
+        }
+    }
+
+    EXPECT_TRUE(grid.Remove(5));
+    EXPECT_FALSE(grid.Remove(5));
+    grid.QueryRadius(bodies[5].center, 0.0f, ids);
+    EXPECT_EQ(std::find(ids.begin(), ids.end(), 5u), ids.end());
+    EXPECT_EQ(grid.Size(), bodies.size() - 1);
+}
+
+TEST(SpatialHashGridTest, BenchmarkAgainstBruteForce)
+{
+    std::mt19937 rng(5);
+    std::vector<Body> bodies = MakeBodies(10000, rng);
+    Spatial::SpatialHashGrid grid(2.0f);
+    for (uint32_t i = 0; i < bodies.size(); ++i) grid.Set(i, bodies[i].GetAABB());
+
+    std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+    std::vector<glm::vec3> points(500);
+    for (glm::vec3& point : points) point = glm::vec3(position(rng), position(rng), position(rng));
+
+    constexpr int frames = 3;
+    constexpr float radius = 5.0f;
+    std::vector<uint32_t> ids;
+    size_t gridFound = 0;
+    size_t bruteFound = 0;
+
+    // Per frame: move every object, update the grid, then run the radius queries
+    const auto gridStart = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; ++frame) {
+        StepBodies(bodies, 1.0f / 60.0f);
+        for (uint32_t i = 0; i < bodies.size(); ++i) grid.Set(i, bodies[i].GetAABB());
+        for (const glm::vec3& point : points) {
+            grid.QueryRadius(point, radius, ids);
+            gridFound += ids.size();
+        }
+    }
+    const double gridSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - gridStart).count();
+
+    const auto bruteStart = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; ++frame) {
+        StepBodies(bodies, -1.0f / 60.0f); // Replay the same positions backwards
+        for (const glm::vec3& point : points) {
+            bruteFound += BruteForceRadius(bodies, point, radius).size();
+        }
+    }
+    const double bruteSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - bruteStart).count();
+
+    std::cout << "[SpatialHashGrid] " << bodies.size() << " moving objects, " << points.size()
+              << " radius queries/frame: grid " << gridSeconds * 1000.0 / frames << " ms/frame, brute force "
+              << bruteSeconds * 1000.0 / frames << " ms/frame" << std::endl;
+    RecordProperty("GridMicrosecondsPerFrame", static_cast<int>(gridSeconds * 1e6 / frames));
+    RecordProperty("BruteForceMicrosecondsPerFrame", static_cast<int>(bruteSeconds * 1e6 / frames));
+    EXPECT_GT(gridFound, 0u);
+    EXPECT_GT(bruteFound, 0u);
+}